@@ -2,7 +2,7 @@
 
 #include <cstdint>
 
-const double sincos[] = {
+const double dct_sincos[] = {
     0.6715589548 /*sin15pi/64*/, 0.7409511254, /*cos*/
     0.8032075315 /*cos13pi/64*/, 0.5956993045, /*sin*/
     0.8577286100 /*cos11pi/64*/, 0.5141027442, /*sin*/
@@ -1,5 +1,10 @@
 #include "amms2.h"
 
+#include <immintrin.h>
+
+#include <cmath>
+#include <cstring>
+#include <numbers>
 #include <string>
 
 #include "amm2_table.h"
@@ -243,7 +248,9 @@ int32_t Amms2Decoder::DecodeFrame(uint32_t* buf) {
   return cnt < chunknum;
 }
 
-int32_t Amms2Decoder::Dct32(float* src, float* dst) {
+// The scalar double DCT-32 the SSE one replaced, see SynthReference().
+static void Dct32Reference(const float* src, float* dst) {
+  const double* sincos = dct_sincos;
   double v53, v58, v59, v60, v74, v78, v79, v80, v81;
   double v82, v83, v129, v142, v143, v144, v145, v146;
   double v147, v148, v149, v150, v151, v152, v153, v154;
@@ -473,32 +480,178 @@ int32_t Amms2Decoder::Dct32(float* src, float* dst) {
   dst[29] = (float)v155;
   dst[30] = (float)v74;
   dst[31] = (float)v129;
-  return 0;
+}
+
+static inline __m128 Reverse(__m128 x) {
+  return _mm_shuffle_ps(x, x, _MM_SHUFFLE(0, 1, 2, 3));
+}
+
+// Lee's odd part factors for a size N DCT, 1 / (2 cos((2i + 1) pi / 2N)).
+template <int N>
+static std::array<float, N / 2> MakeLeeTable() {
+  std::array<float, N / 2> table;
+  for (int i = 0; i < N / 2; i++) {
+    table[i] = static_cast<float>(
+        0.5 / std::cos((2 * i + 1) * std::numbers::pi / (2 * N)));
+  }
+  return table;
+}
+
+template <int N>
+static const std::array<float, N / 2> kLeeTable = MakeLeeTable<N>();
+
+// Lanes 1..3 of a followed by lane 0 of b.
+static inline __m128 NextLanes(__m128 a, __m128 b) {
+  __m128 t = _mm_move_ss(a, b);
+  return _mm_shuffle_ps(t, t, _MM_SHUFFLE(0, 3, 2, 1));
+}
+
+// Unscaled DCT-II, out[k] = sum of in[i] * cos((2i + 1) k pi / 2N), on
+// N / 4 vectors kept in registers. Split with Lee's algorithm: the even
+// outputs are the DCT of in[i] + in[N-1-i], the odd ones sums of
+// neighbours in the DCT of the scaled differences.
+template <int N>
+static inline void Dct(const __m128* in, __m128* out) {
+  constexpr int kHalf = N / 8;
+  const float* lee = kLeeTable<N>.data();
+  __m128 even[kHalf], odd[kHalf];
+  for (int i = 0; i < kHalf; i++) {
+    __m128 lo = in[i];
+    __m128 hi = Reverse(in[kHalf * 2 - 1 - i]);
+    even[i] = _mm_add_ps(lo, hi);
+    odd[i] = _mm_mul_ps(_mm_sub_ps(lo, hi), _mm_loadu_ps(lee + i * 4));
+  }
+
+  __m128 even_out[kHalf], odd_out[kHalf];
+  Dct<N / 2>(even, even_out);
+  Dct<N / 2>(odd, odd_out);
+
+  for (int i = 0; i < kHalf; i++) {
+    __m128 next =
+        i + 1 < kHalf
+            ? NextLanes(odd_out[i], odd_out[i + 1])
+            : _mm_castsi128_ps(_mm_srli_si128(_mm_castps_si128(odd_out[i]), 4));
+    __m128 o = _mm_add_ps(odd_out[i], next);
+    out[i * 2] = _mm_unpacklo_ps(even_out[i], o);
+    out[i * 2 + 1] = _mm_unpackhi_ps(even_out[i], o);
+  }
+}
+
+template <>
+inline void Dct<4>(const __m128* in, __m128* out) {
+  const __m128 lee = _mm_setr_ps(kLeeTable<4>[0], kLeeTable<4>[1], 0.f, 0.f);
+  const __m128 cos45 =
+      _mm_set1_ps(static_cast<float>(std::numbers::sqrt2 / 2));
+  const __m128 lane1 = _mm_castsi128_ps(_mm_setr_epi32(0, -1, 0, 0));
+
+  // [e0, e1, o0, o1], the sums and scaled differences of in[i], in[3-i].
+  __m128 r = Reverse(*in);
+  __m128 t = _mm_movelh_ps(_mm_add_ps(*in, r),
+                           _mm_mul_ps(_mm_sub_ps(*in, r), lee));
+  // Size 2 DCTs of both halves, [e0+e1, o0+o1, ..] and [.., (o0-o1) cos].
+  __m128 t0 = _mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 0, 2, 0));
+  __m128 t1 = _mm_shuffle_ps(t, t, _MM_SHUFFLE(3, 1, 3, 1));
+  __m128 sum = _mm_add_ps(t0, t1);
+  __m128 diff = _mm_mul_ps(_mm_sub_ps(t0, t1), cos45);
+  // [e0+e1, o0+o1 + (o0-o1) cos, (e0-e1) cos, (o0-o1) cos]
+  *out = _mm_add_ps(_mm_shuffle_ps(sum, diff, _MM_SHUFFLE(1, 0, 1, 0)),
+                    _mm_and_ps(diff, lane1));
 }
 
 int32_t Amms2Decoder::Synth(float* in_buf, DecodeBuffer& decoded_buffer,
                             int16_t* result) {
-  float* out_buf = &decoded_buffer.data[decoded_buffer.index];
+  constexpr uint32_t kMask = DecodeBuffer::kFifoSize - 1;
+  float* fifo = decoded_buffer.data.data();
+  uint32_t index = decoded_buffer.index;
 
-  Dct32(in_buf, out_buf);
-  out_buf += 16;
+  __m128 in[8], out[8];
+  for (int i = 0; i < 8; i++) {
+    in[i] = _mm_loadu_ps(in_buf + i * 4);
+  }
+  Dct<32>(in, out);
+  for (int i = 0; i < 8; i++) {
+    _mm_store_ps(fifo + index + i * 4, out[i]);
+  }
 
-  float buffer[32] = {0};
-  float* dtable = (float*)synth_table;
+  // Windows the 16 newest DCT outputs, j walks back in pairs of them. The
+  // newest of a pair gives window[16..31], the older one window[32..48].
+  // Lane order and operation order are those of the scalar filter.
+  const float* dtable = reinterpret_cast<const float*>(synth_table);
+  const __m128 first_lane = _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, -1));
+  __m128 acc[8];
+  for (auto& v : acc) {
+    v = _mm_setzero_ps();
+  }
+  for (uint32_t j = 0; j < 8; j++, dtable += 64) {
+    const float* a = fifo + ((index + j * 64) & kMask);
+    const float* b = fifo + ((index + j * 64 + 32) & kMask);
+    for (int q = 0; q < 4; q++) {
+      __m128 x = _mm_load_ps(a + 16 + q * 4);
+      __m128 y = Reverse(_mm_loadu_ps(b + 13 - q * 4));
+      __m128 t = _mm_sub_ps(_mm_mul_ps(x, _mm_loadu_ps(dtable + q * 4)),
+                            _mm_mul_ps(y, _mm_loadu_ps(dtable + 32 + q * 4)));
+      acc[q] = _mm_add_ps(acc[q], t);
+    }
+    for (int q = 0; q < 4; q++) {
+      // Output 16 only has the b term, a's coefficient is masked out. a[32]
+      // is read for it, the FIFO is padded for that.
+      __m128 x = Reverse(_mm_loadu_ps(a + 29 - q * 4));
+      __m128 y = _mm_load_ps(b + q * 4);
+      __m128 d = _mm_loadu_ps(dtable + 16 + q * 4);
+      if (q == 0) {
+        d = _mm_and_ps(d, first_lane);
+      }
+      __m128 t = _mm_add_ps(_mm_mul_ps(x, d),
+                            _mm_mul_ps(y, _mm_loadu_ps(dtable + 48 + q * 4)));
+      acc[4 + q] = _mm_sub_ps(acc[4 + q], t);
+    }
+  }
 
-  for (int j = 0; j < 8; j++) {
+  // Same as truncating v * 32768 + 32768.5 and clamping to 0..65535, NaN
+  // goes to 0.
+  const __m128 scale = _mm_set1_ps(32768.f);
+  const __m128 bias = _mm_set1_ps(32768.5f);
+  const __m128 top = _mm_set1_ps(65535.f);
+  const __m128i offset = _mm_set1_epi32(32768);
+  for (int q = 0; q < 8; q += 2) {
+    __m128i v[2];
+    for (int k = 0; k < 2; k++) {
+      __m128 t = _mm_add_ps(_mm_mul_ps(acc[q + k], scale), bias);
+      t = _mm_min_ps(_mm_max_ps(t, _mm_setzero_ps()), top);
+      v[k] = _mm_sub_epi32(_mm_cvttps_epi32(t), offset);
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(result + q * 4),
+                     _mm_packs_epi32(v[0], v[1]));
+  }
+
+  decoded_buffer.index = (index - 32) & kMask;
+  return 0;
+}
+
+int32_t Amms2Decoder::SynthReference(float* in_buf,
+                                     DecodeBuffer& decoded_buffer,
+                                     int16_t* result) {
+  constexpr uint32_t kMask = DecodeBuffer::kFifoSize - 1;
+  float* fifo = decoded_buffer.data.data();
+  uint32_t index = decoded_buffer.index;
+
+  Dct32Reference(in_buf, fifo + index);
+
+  float buffer[32] = {0};
+  const float* dtable = reinterpret_cast<const float*>(synth_table);
+  for (uint32_t j = 0; j < 8; j++, dtable += 64) {
+    auto out_buf = [&](uint32_t i) {
+      return fifo[(index + j * 64 + 16 + i) & kMask];
+    };
     for (int i = 0; i < 16; i++) {
-      buffer[i] += (out_buf[i] * dtable[i] - out_buf[32 - i] * dtable[32 + i]);
+      buffer[i] += (out_buf(i) * dtable[i] - out_buf(32 - i) * dtable[32 + i]);
     }
 
-    buffer[16] -= out_buf[16] * dtable[16 + 32];
+    buffer[16] -= out_buf(16) * dtable[16 + 32];
 
     for (int i = 17; i < 32; i++) {
-      buffer[i] -= (out_buf[32 - i] * dtable[i] + out_buf[i] * dtable[32 + i]);
+      buffer[i] -= (out_buf(32 - i) * dtable[i] + out_buf(i) * dtable[32 + i]);
     }
-
-    out_buf += 64;
-    dtable += 64;
   }
 
   for (int j = 0; j < 32; j++) {
@@ -514,29 +667,7 @@ int32_t Amms2Decoder::Synth(float* in_buf, DecodeBuffer& decoded_buffer,
     result[j] = val;
   }
 
-  if (decoded_buffer.index == 0) {
-    uint32_t* dst = (uint32_t*)&decoded_buffer.data[544];
-    uint32_t* src = (uint32_t*)&decoded_buffer.data[0];
-
-    for (int j = 0; j < 48; j++) {
-      *dst++ = *src++;
-      *dst++ = *src++;
-      *dst++ = *src++;
-      *dst++ = *src++;
-      *dst++ = *src++;
-      *dst++ = *src++;
-      *dst++ = *src++;
-      *dst++ = *src++;
-      *dst++ = *src++;
-      *dst++ = *src++;
-    }
-
-    decoded_buffer.index = 512;
-
-  } else {
-    decoded_buffer.index -= 32;
-  }
-
+  decoded_buffer.index = (index - 32) & kMask;
   return 0;
 }
 
@@ -550,13 +681,15 @@ int32_t Amms2Decoder::Decode(int16_t* out) {
     return -1;
   }
 
+  auto synth =
+      reference_ ? &Amms2Decoder::SynthReference : &Amms2Decoder::Synth;
   if (channum == 1) {
-    Synth(buf, decoded_buffer_[0], out);
+    (this->*synth)(buf, decoded_buffer_[0], out);
     return 32;
   } else {
     int16_t data[32];
     for (int i = 0; i < 64; i += 32) {
-      Synth(&buf[i], decoded_buffer_[i / 32], data);
+      (this->*synth)(&buf[i], decoded_buffer_[i / 32], data);
       for (int j = 0; j < 32; j++) {
         out[j * 2] = data[j];
       }
@@ -569,6 +702,20 @@ int32_t Amms2Decoder::Decode(int16_t* out) {
   return 0;
 }
 
+void Amms2Decoder::SaveState(state::Writer& writer,
+                             std::span<const uint8_t> rom) const {
+  Amms2Decoder decoder = *this;
+  decoder.stream_.stream_data = nullptr;
+  writer.Put(static_cast<uint32_t>(stream_.stream_data - rom.data()));
+  writer.Put(decoder);
+}
+
+void Amms2Decoder::LoadState(state::Reader& reader, std::span<uint8_t> rom) {
+  uint32_t offset = reader.Get<uint32_t>();
+  reader.Get(*this);
+  stream_.stream_data = &rom[offset < rom.size() ? offset : 0];
+}
+
 void Amms2Decoder::Init(uint8_t* ptr) {
   stream_.stream_data = ptr;
   stream_.byte_index = 0;
@@ -587,20 +734,16 @@ void Amms2Decoder::Init(uint8_t* ptr) {
   quality = 0;
   channum = 0;
 
-  decoded_buffer_->data.fill(0);
-  decoded_buffer_->index = 0;
-  current_sample = 0;
+  for (auto& buffer : decoded_buffer_) {
+    buffer.data.fill(0);
+    buffer.index = 0;
+  }
 }
 
-bool Amms2Decoder::GetSample(int32_t& sample) {
-  if (current_sample == 0) {
-    int32_t result = Decode(samples);
-    if (result < 0) {
-      return false;
-    }
+bool Amms2Decoder::GetFrame(int16_t* out) {
+  if (Decode(samples) < 0) {
+    return false;
   }
-
-  sample = samples[current_sample++];
-  current_sample &= 0x1f;
+  std::memcpy(out, samples, kFrameSamples * sizeof(int16_t));
   return true;
-}
\ No newline at end of file
+}
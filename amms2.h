@@ -2,18 +2,36 @@
 
 #include <array>
 #include <cstdint>
+#include <span>
+
+#include "save_state.h"
 
 class Amms2Decoder {
  public:
+  static constexpr uint32_t kFrameSamples = 32;
+
   void Init(uint8_t* ptr);
-  bool GetSample(int32_t& sample);
+  // Decodes the next kFrameSamples samples, false at the end of the stream.
+  bool GetFrame(int16_t* out);
+
+  // Synthesises with the scalar double DCT and windowing Synth() was
+  // vectorised from, to measure how far it strays, see amms2_test.cpp.
+  void SetReference(bool reference) { reference_ = reference; }
+
+  // The stream is kept as an offset into rom, the decoder must have been
+  // initialised with a stream in it.
+  void SaveState(state::Writer& writer, std::span<const uint8_t> rom) const;
+  void LoadState(state::Reader& reader, std::span<uint8_t> rom);
 
  private:
-  int32_t current_sample;
   int16_t samples[32 + 32];
 
+  // Circular FIFO of the last 16 DCT outputs, the newest at index. Four
+  // floats of padding past the end keep the windowing loads in bounds.
   struct DecodeBuffer {
-    std::array<float, 1024> data;
+    static constexpr uint32_t kFifoSize = 16 * 32;
+
+    alignas(16) std::array<float, kFifoSize + 4> data;
     uint32_t index;
   };
 
@@ -47,6 +65,7 @@ class Amms2Decoder {
   uint8_t modeext;
   uint8_t quality;
   uint8_t channum;
+  bool reference_ = false;
 
   int32_t Decode(int16_t* out);
   int32_t DecodeFrame(uint32_t* buf);
@@ -56,7 +75,8 @@ class Amms2Decoder {
   void ReadFractions(uint32_t* buf);
   void ReadScalef();
   void ReadBitalloc();
-  int32_t Dct32(float* src, float* dst);
 
   int32_t Synth(float* in_buf, DecodeBuffer& decoded_buffer, int16_t* result);
+  int32_t SynthReference(float* in_buf, DecodeBuffer& decoded_buffer,
+                         int16_t* result);
 };
@@ -0,0 +1,121 @@
+// Decodes every AMMS2 stream of a romset's sound roms (u23/u24) with the
+// vectorised synthesis and with the scalar reference it replaced, see
+// Amms2Decoder::SetReference, and checks how far they drift apart.
+//
+//   amms2_test <romset> <rom dir>
+//
+// The rom dir is the romset directory itself or the directory holding it.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "amms2.h"
+#include "roms.h"
+
+// Float against double rounding moves a sample by at most a step or two.
+static constexpr int32_t kMaxError = 2;
+static constexpr double kMinPsnr = 100.0;
+// Streams that don't end within this are cut, about 8 minutes at 16 kHz.
+static constexpr uint32_t kMaxFrames = 1 << 18;
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    std::cout << "usage: amms2_test <romset> <rom dir>\n";
+    return 1;
+  }
+
+  std::string name = argv[1];
+  std::filesystem::path path = argv[2];
+
+  GamesList games;
+  games.Init();
+  uint32_t idx = games.IndexOfName(name.c_str());
+  if (idx == static_cast<uint32_t>(-1)) {
+    std::cout << "unknown romset " << name << "\n";
+    return 1;
+  }
+  if (std::filesystem::is_directory(path / name)) path /= name;
+  if (!games.LoadGame(idx, path.string(), true)) {
+    std::cout << "romset " << name << " not found in " << path.string()
+              << "\n";
+    return 1;
+  }
+
+  // The layout Ymz770 sees, a table of big endian stream offsets per msn.
+  std::vector<uint8_t> rom(0x00800000);
+  games.ReadGameRom(0x08800000, rom);
+  auto offset_of = [&](uint32_t msn) {
+    const uint8_t *p = &rom[msn * 4];
+    return uint32_t{p[0]} << 24 | p[1] << 16 | p[2] << 8 | p[3];
+  };
+
+  auto decoder = std::make_unique<Amms2Decoder>();
+  auto reference = std::make_unique<Amms2Decoder>();
+  reference->SetReference(true);
+
+  std::unordered_set<uint32_t> seen;
+  uint32_t streams = 0;
+  uint64_t samples = 0;
+  uint64_t differ = 0;
+  int32_t max_error = 0;
+  double squared = 0;
+
+  for (uint32_t msn = 0; msn < 256; msn++) {
+    uint32_t offset = offset_of(msn);
+    // Unused entries don't point at a frame header.
+    if (offset > rom.size() - 2 || rom[offset] != 0xff ||
+        (rom[offset + 1] & 0xf0) != 0xf0 || !seen.insert(offset).second) {
+      continue;
+    }
+
+    streams++;
+    decoder->Init(&rom[offset]);
+    reference->Init(&rom[offset]);
+    for (uint32_t frame = 0; frame < kMaxFrames; frame++) {
+      int16_t got[Amms2Decoder::kFrameSamples];
+      int16_t want[Amms2Decoder::kFrameSamples];
+      bool more = decoder->GetFrame(got);
+      if (more != reference->GetFrame(want)) {
+        std::cout << "msn " << msn << ": streams end at different frames\n";
+        return 2;
+      }
+      if (!more) break;
+
+      for (uint32_t i = 0; i < Amms2Decoder::kFrameSamples; i++) {
+        int32_t error = std::abs(got[i] - want[i]);
+        differ += error != 0;
+        max_error = std::max(max_error, error);
+        squared += static_cast<double>(error) * error;
+      }
+      samples += Amms2Decoder::kFrameSamples;
+    }
+  }
+
+  if (!samples) {
+    std::cout << "no streams found in " << name << "\n";
+    return 1;
+  }
+
+  double mse = squared / samples;
+  double psnr = mse ? 10 * std::log10(32767.0 * 32767.0 / mse) : INFINITY;
+  bool pass = max_error <= kMaxError && psnr >= kMinPsnr;
+
+  std::cout << std::fixed << std::setprecision(4);
+  std::cout << name << ": " << streams << " streams, " << samples
+            << " samples\n";
+  std::cout << "differ: " << differ << " (" << 100.0 * differ / samples
+            << "%), max error " << max_error << " (limit " << kMaxError
+            << ")\n";
+  std::cout << std::setprecision(1) << "psnr: " << psnr << " dB (limit "
+            << kMinPsnr << ")\n";
+  std::cout << (pass ? "pass" : "FAIL") << "\n";
+  return pass ? 0 : 2;
+}
@@ -1,6 +1,7 @@
 
 #include "app.h"
 
+#include <algorithm>
 #include <vector>
 
 SDL_AppResult SDL_Fail() {
@@ -8,34 +9,46 @@ SDL_AppResult SDL_Fail() {
   return SDL_APP_FAILURE;
 }
 
+// Games are listed while the scan runs, the file dialog comes back if it
+// finds none.
 void ScanDirectory(App* app, std::string dir) {
   app->ui.game_list.ScanDirectory(dir, app->cave3rd.GetGameList());
-  if (app->ui.game_list.GetGameList().size() > 0) {
-    app->state = kShowGameList;
-  }
+  app->state = kShowGameList;
 }
 
+// Plays what the emulation thread rendered. The stream's rate follows the
+// ring's fill level, so small clock differences between emulated and host
+// time neither drain nor overflow it.
 void SDLCALL AudioStreamCallback(void* userdata, SDL_AudioStream* stream,
                                  int additional_amount, int total_amount) {
-  static std::vector<int16_t> samples;
+  constexpr int kFrames = 512;
+  constexpr float kTarget = AudioRing::kFrames / 4;
+  constexpr float kMaxAdjust = 0.005f;
+  int16_t samples[kFrames * 2];
 
   Cave3rd* cave3rd = (Cave3rd*)userdata;
 
-  samples.clear();
-  int sample_count = additional_amount >> 1;
-  for (int i = 0; i < sample_count; i++) {
-    int16_t sample = cave3rd->GetNextSample();
-    samples.push_back(sample);
+  float error = (cave3rd->GetAudioFill() - kTarget) / kTarget;
+  SDL_SetAudioStreamFrequencyRatio(
+      stream, 1.0f + std::clamp(error * kMaxAdjust, -kMaxAdjust, kMaxAdjust));
+
+  int frame_count = additional_amount >> 2;
+  while (frame_count > 0) {
+    int frames = std::min(frame_count, kFrames);
+    int read = static_cast<int>(cave3rd->ReadAudio(samples, frames));
+    // Silence on an underrun.
+    std::fill(samples + read * 2, samples + frames * 2, 0);
+    SDL_PutAudioStreamData(stream, samples, frames << 2);
+    frame_count -= frames;
   }
-  SDL_PutAudioStreamData(stream, samples.data(), sample_count << 1);
 }
 
 bool InitAudio(App* app) {
   SDL_AudioSpec spec;
 
-  spec.freq = 16000;
+  spec.freq = Cave3rd::kSampleRate;
   spec.format = SDL_AUDIO_S16;
-  spec.channels = 1;
+  spec.channels = 2;
 
   app->audio = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec);
   if (!app->audio) {
@@ -235,6 +248,7 @@ SDL_AppResult SDL_AppInit(void** appstate, int argc, char* argv[]) {
                          "Up", "Down", "Left", "Right"});
 
   app->config.AddConfig("input", app->ui.ui_input.GetInputManager());
+  app->config.AddConfig("emulator", app->cave3rd);
   if (app->config.Load()) {
     auto& game_path = app->config.state_.path;
     if (game_path.size()) {
@@ -285,6 +299,19 @@ SDL_AppResult SDL_AppEvent(void* appstate, SDL_Event* event) {
     case SDL_EVENT_KEY_DOWN:
       if (event->key.scancode == SDL_SCANCODE_TAB) {
         app->input_setting = !app->input_setting;
+      } else if (event->key.scancode == SDL_SCANCODE_F1) {
+        app->cave3rd.SetTurbo(!app->cave3rd.GetTurbo());
+      } else if (event->key.scancode == SDL_SCANCODE_F5) {
+        app->cave3rd.QueueSaveState();
+      } else if (event->key.scancode == SDL_SCANCODE_F7) {
+        app->cave3rd.QueueLoadState();
+      } else if (event->key.scancode == SDL_SCANCODE_F8) {
+        app->cave3rd.SetRewinding(true);
+      }
+      break;
+    case SDL_EVENT_KEY_UP:
+      if (event->key.scancode == SDL_SCANCODE_F8) {
+        app->cave3rd.SetRewinding(false);
       }
       break;
     default:
@@ -313,7 +340,12 @@ SDL_AppResult SDL_AppIterate(void* appstate) {
       app->ui.ui_input.Show();
       app->config.Save();
     } else if (app->state == kShowGameList) {
+      // Read before ShowGameList() drains the results, so none are missed.
+      bool scanning = app->ui.game_list.IsScanning();
       auto game = app->ui.ShowGameList();
+      if (!scanning && app->ui.game_list.GetGameList().empty()) {
+        app->state = kLoadGameList;
+      }
       if (nullptr != game) {
         app->cave3rd.SetGame(game->game_id, game->path);
         app->cave3rd.Start();
@@ -1,1354 +0,0 @@
-unsigned char dfk[] = {
-  0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43,
-  0x00, 0x05, 0x03, 0x04, 0x04, 0x04, 0x03, 0x05, 0x04, 0x04, 0x04, 0x05,
-  0x05, 0x05, 0x06, 0x07, 0x0c, 0x08, 0x07, 0x07, 0x07, 0x07, 0x0f, 0x0b,
-  0x0b, 0x09, 0x0c, 0x11, 0x0f, 0x12, 0x12, 0x11, 0x0f, 0x11, 0x11, 0x13,
-  0x16, 0x1c, 0x17, 0x13, 0x14, 0x1a, 0x15, 0x11, 0x11, 0x18, 0x21, 0x18,
-  0x1a, 0x1d, 0x1d, 0x1f, 0x1f, 0x1f, 0x13, 0x17, 0x22, 0x24, 0x22, 0x1e,
-  0x24, 0x1c, 0x1e, 0x1f, 0x1e, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x05, 0x05,
-  0x05, 0x07, 0x06, 0x07, 0x0e, 0x08, 0x08, 0x0e, 0x1e, 0x14, 0x11, 0x14,
-  0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-  0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-  0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-  0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-  0x1e, 0x1e, 0xff, 0xc0, 0x00, 0x11, 0x08, 0x01, 0x00, 0x00, 0xc0, 0x03,
-  0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x00,
-  0x1c, 0x00, 0x00, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x03, 0x04, 0x07, 0x02,
-  0x01, 0x00, 0x08, 0xff, 0xc4, 0x00, 0x43, 0x10, 0x00, 0x02, 0x01, 0x03,
-  0x02, 0x04, 0x04, 0x02, 0x08, 0x05, 0x03, 0x02, 0x05, 0x04, 0x03, 0x00,
-  0x01, 0x02, 0x03, 0x04, 0x05, 0x11, 0x00, 0x21, 0x06, 0x12, 0x31, 0x41,
-  0x13, 0x22, 0x51, 0x61, 0x71, 0x81, 0x07, 0x14, 0x32, 0x42, 0x91, 0xa1,
-  0xb1, 0xc1, 0x15, 0x23, 0x52, 0xd1, 0xe1, 0x62, 0x72, 0xf0, 0x24, 0x33,
-  0x16, 0x25, 0x43, 0x92, 0xf1, 0x08, 0x34, 0x44, 0x73, 0x82, 0xa2, 0xb2,
-  0xff, 0xc4, 0x00, 0x1a, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03,
-  0x04, 0x00, 0x05, 0x06, 0xff, 0xc4, 0x00, 0x31, 0x11, 0x00, 0x02, 0x02,
-  0x01, 0x03, 0x02, 0x03, 0x07, 0x03, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x02, 0x00, 0x11, 0x03, 0x04, 0x21, 0x31, 0x12, 0x41, 0x05,
-  0x51, 0x61, 0x13, 0x22, 0x32, 0x71, 0x81, 0xb1, 0xf0, 0xa1, 0xc1, 0xd1,
-  0x14, 0x52, 0x91, 0xe1, 0x42, 0x92, 0xf1, 0xff, 0xda, 0x00, 0x0c, 0x03,
-  0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xfd, 0x05, 0x4f,
-  0x1f, 0x28, 0xdc, 0x63, 0x5d, 0x54, 0x4c, 0x13, 0xca, 0x08, 0xdb, 0x54,
-  0xaa, 0xea, 0x8b, 0xcf, 0xe1, 0xc7, 0xd0, 0x1c, 0x0c, 0x77, 0xd7, 0x5f,
-  0x57, 0x22, 0x43, 0xcc, 0xe4, 0x81, 0xd4, 0x03, 0xac, 0x93, 0x65, 0x41,
-  0xb7, 0x5a, 0xe6, 0x43, 0x80, 0x77, 0x27, 0x5c, 0x51, 0x4c, 0xf2, 0x42,
-  0xcc, 0xc4, 0x90, 0x35, 0x05, 0xe2, 0x4a, 0x68, 0x59, 0xb9, 0x88, 0xe6,
-  0x1e, 0xa7, 0x50, 0x45, 0x73, 0x44, 0x7f, 0x0c, 0x2e, 0x54, 0x7a, 0x68,
-  0x81, 0x0c, 0xb4, 0xee, 0xbf, 0x69, 0xf0, 0x07, 0xbe, 0xa9, 0x3b, 0x35,
-  0x54, 0xfe, 0x1c, 0x28, 0x08, 0xf5, 0x03, 0x5d, 0xdc, 0x11, 0xea, 0xa2,
-  0x42, 0x84, 0xa4, 0x64, 0xf5, 0x00, 0x93, 0xa2, 0x36, 0x1a, 0x3f, 0x0f,
-  0xcc, 0x92, 0xba, 0xa9, 0x39, 0xf3, 0x0e, 0xda, 0xe8, 0x7d, 0x67, 0xb6,
-  0xfb, 0x5c, 0x83, 0x02, 0x44, 0x90, 0x86, 0xf4, 0x53, 0xa3, 0x14, 0x36,
-  0x5f, 0x0a, 0x61, 0x21, 0x40, 0x00, 0xdc, 0x0d, 0x58, 0x8d, 0x59, 0x87,
-  0xfd, 0xd3, 0xe8, 0x76, 0x3a, 0x3d, 0x6f, 0x88, 0x7f, 0x06, 0x82, 0x60,
-  0x32, 0xdc, 0xa0, 0x7e, 0x1b, 0x7e, 0xda, 0xa2, 0x01, 0x24, 0xc4, 0x89,
-  0xed, 0xb6, 0x16, 0x62, 0x3d, 0x07, 0x5d, 0x17, 0xc6, 0x87, 0xd3, 0xc8,
-  0xc2, 0x3e, 0x63, 0x30, 0x41, 0x9c, 0x63, 0x1a, 0x99, 0x2a, 0xe2, 0x5f,
-  0xb5, 0x2f, 0x37, 0xc0, 0x6a, 0x81, 0x84, 0x91, 0x12, 0xc4, 0x9c, 0xc1,
-  0x09, 0x51, 0x92, 0x3a, 0x0d, 0x61, 0x9f, 0x49, 0xd7, 0x2b, 0xbb, 0xf1,
-  0x55, 0x44, 0x55, 0x12, 0x24, 0x7e, 0x11, 0x14, 0xec, 0xb0, 0xb0, 0x08,
-  0xf0, 0x98, 0xe4, 0x90, 0x73, 0x2b, 0x64, 0xb1, 0x04, 0x0c, 0xf6, 0xe9,
-  0xb6, 0xe3, 0x5b, 0x35, 0x75, 0xc6, 0x28, 0x62, 0x69, 0x16, 0x55, 0xd8,
-  0x6c, 0xbc, 0xb9, 0xe6, 0x3d, 0x80, 0xd6, 0x3d, 0xf4, 0x81, 0x78, 0x82,
-  0x4b, 0x9c, 0xf3, 0x9a, 0x48, 0xaa, 0x27, 0x42, 0xc9, 0x2a, 0xb2, 0xa8,
-  0x91, 0x8a, 0x2f, 0x3f, 0xf2, 0xc1, 0xfb, 0x58, 0x18, 0x39, 0x3b, 0x01,
-  0xd3, 0x27, 0x59, 0xb5, 0x2c, 0x08, 0xab, 0x9a, 0xb4, 0x40, 0xab, 0x5d,
-  0x5c, 0x5c, 0xae, 0xac, 0xb8, 0xd7, 0x23, 0xdb, 0x4d, 0x65, 0x44, 0xd0,
-  0x53, 0x4c, 0xd0, 0xd3, 0x82, 0xe6, 0x49, 0x1d, 0x33, 0xe4, 0xc1, 0x39,
-  0xce, 0x46, 0xfb, 0xef, 0xbf, 0x4d, 0x0c, 0x9a, 0x82, 0x1a, 0x09, 0x7c,
-  0x28, 0xe3, 0x59, 0xab, 0x64, 0x60, 0xb8, 0x03, 0x9c, 0x2b, 0x7a, 0x7f,
-  0xad, 0xbf, 0xfe, 0xa3, 0xdf, 0x4c, 0x76, 0xb9, 0x9d, 0xad, 0x82, 0x78,
-  0xa1, 0x26, 0xb6, 0x61, 0xfc, 0xce, 0x53, 0xcc, 0x23, 0x04, 0x67, 0x95,
-  0x5b, 0xbe, 0xc4, 0x64, 0xf5, 0xed, 0x81, 0xaf, 0xb8, 0x7e, 0x84, 0x17,
-  0xad, 0xaf, 0x8d, 0x0c, 0xb3, 0x42, 0x9e, 0x14, 0x6f, 0x8d, 0xbc, 0x47,
-  0x3c, 0xb8, 0x5f, 0x80, 0xce, 0xfa, 0x82, 0x99, 0xa1, 0xb9, 0x31, 0x1e,
-  0xa6, 0xc8, 0xf5, 0x35, 0x2d, 0x3d, 0x6b, 0xb3, 0x90, 0x71, 0xc8, 0xad,
-  0x9d, 0xfd, 0xcf, 0x73, 0xf0, 0xdb, 0x5d, 0xa5, 0x1a, 0x40, 0x85, 0x62,
-  0x8d, 0x54, 0x7f, 0xa4, 0x69, 0xaa, 0xae, 0x9d, 0x39, 0x71, 0x11, 0xca,
-  0x80, 0xc1, 0x4f, 0xfa, 0x46, 0xcc, 0xff, 0x00, 0x33, 0xb0, 0xf6, 0x1a,
-  0x13, 0x3c, 0x3d, 0x70, 0x35, 0x40, 0xd1, 0x2a, 0x0a, 0x31, 0x1e, 0xc3,
-  0x5c, 0x18, 0x8f, 0xa6, 0x8c, 0xcf, 0x44, 0x60, 0x96, 0x58, 0xdf, 0x76,
-  0x8c, 0x80, 0xde, 0xc7, 0x51, 0x35, 0x38, 0xdf, 0x4e, 0x0c, 0x15, 0x04,
-  0x34, 0x65, 0x46, 0xa1, 0x9a, 0x36, 0xc1, 0x6f, 0x31, 0xff, 0x00, 0x6f,
-  0xda, 0x1f, 0xdf, 0xe1, 0xa2, 0xcf, 0x4c, 0x7b, 0xa9, 0xc1, 0xd8, 0x1d,
-  0x57, 0x9a, 0x0e, 0x51, 0x91, 0xe5, 0x3e, 0xbd, 0xbf, 0xf8, 0xd3, 0x03,
-  0x73, 0xaa, 0x06, 0x59, 0xcf, 0x88, 0xb1, 0xbc, 0x88, 0x79, 0xc7, 0xf2,
-  0xcb, 0x0c, 0xa4, 0x83, 0xf6, 0x3e, 0xda, 0xb5, 0x61, 0xa7, 0x5a, 0x93,
-  0x5e, 0x89, 0x12, 0x2b, 0x2c, 0x80, 0x05, 0x1b, 0xe4, 0xf2, 0x9c, 0x8f,
-  0x9e, 0x0e, 0x3e, 0x1e, 0xfa, 0xa3, 0x7c, 0x83, 0x96, 0x95, 0xe6, 0x8d,
-  0x3c, 0x85, 0xff, 0x00, 0x98, 0x99, 0xde, 0x39, 0x07, 0x7f, 0x9f, 0xe7,
-  0xb1, 0xd7, 0xbc, 0x1b, 0x5e, 0x94, 0xf7, 0x8c, 0xd5, 0x4a, 0x52, 0x2a,
-  0x8c, 0x24, 0x92, 0x7f, 0x41, 0xc8, 0xc3, 0xfc, 0x8e, 0x0f, 0xc3, 0x3a,
-  0xe8, 0xa0, 0xef, 0x1c, 0x7e, 0x8c, 0x69, 0x2d, 0x13, 0xdd, 0x6a, 0x38,
-  0x4e, 0xed, 0x41, 0x4b, 0xcb, 0x70, 0x0d, 0x2d, 0xba, 0xbf, 0xc3, 0x02,
-  0x68, 0x66, 0x0b, 0xf6, 0x39, 0xfa, 0x91, 0x81, 0xb0, 0x3e, 0x9e, 0xfa,
-  0x07, 0x79, 0xa5, 0xbb, 0xf0, 0xe5, 0xf4, 0x4f, 0x43, 0x33, 0x52, 0x5c,
-  0xe8, 0x64, 0x2a, 0x8e, 0x87, 0x63, 0xec, 0x7d, 0x54, 0xf4, 0xc1, 0xec,
-  0x74, 0xdd, 0x5d, 0x61, 0x91, 0x50, 0x5c, 0x28, 0x24, 0x29, 0x5b, 0x4f,
-  0x30, 0x9e, 0x05, 0xc6, 0x02, 0xca, 0x87, 0x3c, 0xb9, 0xf4, 0x3d, 0x3e,
-  0x04, 0x68, 0xe7, 0xd2, 0x2d, 0x99, 0x2f, 0x11, 0xd3, 0xde, 0xa9, 0xb9,
-  0x63, 0xfa, 0xcd, 0x30, 0x66, 0x52, 0xbd, 0x4e, 0x07, 0xe6, 0x34, 0xa1,
-  0xbb, 0xce, 0xe9, 0xa3, 0x5e, 0x70, 0xa7, 0x8c, 0xca, 0xc6, 0x4e, 0x56,
-  0x67, 0xea, 0x32, 0x75, 0x05, 0x6d, 0xce, 0x7e, 0x56, 0xdf, 0xcc, 0xc3,
-  0xd7, 0x1a, 0xaf, 0x2c, 0x88, 0xa8, 0x4b, 0xc6, 0xc0, 0x63, 0xbb, 0x69,
-  0x6e, 0xf3, 0x28, 0x69, 0xc3, 0x24, 0xa5, 0x46, 0x32, 0x53, 0x98, 0x60,
-  0x0f, 0x97, 0xae, 0xba, 0x00, 0x25, 0xbb, 0x89, 0x63, 0xfc, 0xe9, 0x5d,
-  0x15, 0x47, 0xbf, 0x4d, 0x73, 0x0d, 0x45, 0x44, 0xb5, 0xf1, 0x78, 0x50,
-  0x0f, 0x08, 0x85, 0x07, 0x9b, 0x72, 0x7f, 0x0f, 0xd3, 0x42, 0xe8, 0x68,
-  0xd2, 0xa9, 0xbc, 0xf5, 0x51, 0xd3, 0x29, 0x39, 0x2f, 0x23, 0xe4, 0x7b,
-  0x60, 0x75, 0xd3, 0xd7, 0x0a, 0xaf, 0x0f, 0xda, 0xde, 0x48, 0xe3, 0xaf,
-  0x13, 0xce, 0xe4, 0x01, 0x27, 0x2e, 0xc4, 0x7b, 0x6d, 0xa6, 0x51, 0x03,
-  0x1a, 0x8c, 0x76, 0x7a, 0x05, 0x7a, 0x38, 0x96, 0x54, 0xc1, 0x07, 0x20,
-  0xf2, 0x8f, 0xf3, 0x8d, 0x1e, 0xa4, 0xa3, 0xa6, 0x8f, 0x62, 0x54, 0xff,
-  0x00, 0xb8, 0x8d, 0x2f, 0xd3, 0xdf, 0x6c, 0xed, 0x85, 0x35, 0x6b, 0xf3,
-  0x43, 0x8f, 0xd3, 0x5f, 0x3f, 0x10, 0x5a, 0xd3, 0x60, 0xee, 0x48, 0x3f,
-  0x75, 0x32, 0x3f, 0x1d, 0x37, 0x50, 0x12, 0x44, 0x13, 0x1d, 0x62, 0x36,
-  0xf8, 0xd7, 0xed, 0x41, 0xf9, 0x69, 0x07, 0xe9, 0x2b, 0x8b, 0x8c, 0x4c,
-  0xd6, 0x5b, 0x49, 0x31, 0x90, 0xa3, 0xc7, 0x98, 0x64, 0x1c, 0x1d, 0xf9,
-  0x57, 0xf7, 0x3a, 0x91, 0xb8, 0x9e, 0x88, 0x1c, 0x24, 0x75, 0x0d, 0xf0,
-  0x51, 0xfd, 0xf4, 0x9f, 0xc6, 0x72, 0xc7, 0x55, 0x5f, 0x15, 0x5c, 0x68,
-  0xc8, 0x25, 0x88, 0x64, 0x30, 0xc1, 0xca, 0x92, 0x3f, 0xb6, 0xbb, 0xae,
-  0xe7, 0x0c, 0x7b, 0xef, 0x35, 0xfa, 0x6b, 0x85, 0xbe, 0x5a, 0x28, 0x18,
-  0xa3, 0x90, 0x63, 0x57, 0xd8, 0x77, 0x23, 0x5e, 0x3d, 0xc2, 0xd9, 0x18,
-  0x66, 0x68, 0x5c, 0x01, 0xdf, 0xfe, 0x1d, 0x28, 0x59, 0xa6, 0x12, 0x5a,
-  0x69, 0x5c, 0xd5, 0x90, 0x3c, 0x25, 0xdb, 0x9b, 0x1d, 0x06, 0x34, 0x8f,
-  0xf4, 0x8d, 0xc6, 0x62, 0x09, 0x64, 0xa1, 0xb7, 0xc8, 0x4b, 0x7d, 0x96,
-  0x60, 0x7b, 0xfa, 0x0f, 0xdf, 0xfb, 0x9d, 0x29, 0xc8, 0x61, 0x5c, 0x77,
-  0x0f, 0xf1, 0xdf, 0x1d, 0xc6, 0xb3, 0xb5, 0x1d, 0xb1, 0x63, 0x57, 0x03,
-  0x76, 0x27, 0x64, 0x1d, 0x09, 0x27, 0xfe, 0x67, 0xa0, 0xee, 0x74, 0xa9,
-  0x44, 0xb0, 0xc3, 0x54, 0x97, 0x19, 0x91, 0xe7, 0xb9, 0xca, 0x30, 0x5e,
-  0x43, 0x82, 0x17, 0x20, 0xe0, 0x8e, 0xc3, 0x60, 0x71, 0xd0, 0x00, 0x3a,
-  0xe9, 0x62, 0xde, 0x24, 0x44, 0x5a, 0xfa, 0xa3, 0x92, 0xc4, 0xb2, 0x97,
-  0xf5, 0x1d, 0xf1, 0xed, 0xf9, 0x63, 0x03, 0xbe, 0xa3, 0xba, 0x5d, 0xda,
-  0x28, 0x9d, 0x7c, 0x46, 0x12, 0x48, 0x32, 0xe7, 0x3b, 0xaa, 0xf6, 0x1f,
-  0x13, 0xa8, 0x30, 0x27, 0x99, 0xa9, 0x00, 0x51, 0xb4, 0x66, 0xba, 0xf1,
-  0x5b, 0x49, 0x48, 0x62, 0x01, 0x90, 0xb7, 0x95, 0xca, 0x3f, 0x33, 0xb9,
-  0xc9, 0xfe, 0x52, 0xe3, 0xa1, 0xdb, 0x7f, 0x88, 0xf5, 0xce, 0x99, 0xf8,
-  0x46, 0xa4, 0x50, 0x70, 0x9c, 0x73, 0x56, 0xa4, 0x66, 0x7a, 0xaa, 0x96,
-  0x55, 0x8e, 0x3e, 0x89, 0xb7, 0x2a, 0xa8, 0x3e, 0xde, 0xbe, 0xfa, 0x47,
-  0xfa, 0x39, 0xe1, 0x5a, 0xce, 0x23, 0xaa, 0xfa, 0xf5, 0x53, 0xb5, 0x1d,
-  0x14, 0x6a, 0x39, 0x5c, 0x0f, 0x39, 0x53, 0xda, 0x3c, 0xf4, 0xcf, 0xf5,
-  0x1f, 0x96, 0x9b, 0xb8, 0x98, 0xd1, 0xd9, 0xa3, 0xb6, 0x52, 0x53, 0x20,
-  0x8a, 0x9a, 0x99, 0xe4, 0x94, 0x2e, 0x73, 0xd0, 0x13, 0xb9, 0x3d, 0x49,
-  0x23, 0x43, 0xa6, 0x84, 0x04, 0x82, 0x68, 0x4b, 0xf5, 0x75, 0x76, 0x06,
-  0xe7, 0x8e, 0x45, 0x50, 0x22, 0xf2, 0xb6, 0x0f, 0xf4, 0x9c, 0x60, 0x9f,
-  0xf7, 0x63, 0x42, 0x25, 0xa7, 0xb3, 0x54, 0x54, 0xac, 0x54, 0xb2, 0x93,
-  0x27, 0x22, 0xf9, 0x54, 0x6c, 0xec, 0x4e, 0x4f, 0x7e, 0x80, 0x0f, 0xcf,
-  0x48, 0x91, 0x5d, 0x9a, 0x4a, 0x70, 0x59, 0x89, 0x2f, 0x54, 0xe4, 0xfc,
-  0x8b, 0xb7, 0xee, 0x34, 0xdb, 0xc0, 0xf4, 0x92, 0x9b, 0xe7, 0x8b, 0x30,
-  0x3e, 0x5a, 0x45, 0x94, 0x67, 0xd5, 0xce, 0xdf, 0xa6, 0x83, 0x1e, 0x95,
-  0xb8, 0xca, 0xb6, 0x61, 0x4b, 0xbd, 0xba, 0x8f, 0xf8, 0xc3, 0x24, 0x95,
-  0x21, 0x0d, 0x52, 0x73, 0x3a, 0xff, 0x00, 0x43, 0x01, 0xcd, 0x9f, 0xc8,
-  0xe8, 0x55, 0x65, 0xae, 0x96, 0x29, 0xd5, 0x12, 0xe1, 0x1b, 0x23, 0x82,
-  0x01, 0xc8, 0xfb, 0x58, 0xc8, 0x1f, 0x3d, 0xf5, 0xdf, 0xd2, 0x5a, 0xc9,
-  0x4b, 0x3d, 0x25, 0xcd, 0x17, 0x2a, 0x07, 0x23, 0x7c, 0xb3, 0xb7, 0xcc,
-  0x13, 0xa4, 0xa3, 0x2f, 0x30, 0x60, 0x0f, 0x4f, 0xcc, 0x76, 0xd3, 0x63,
-  0x25, 0x96, 0xe0, 0x22, 0x8d, 0x46, 0x9e, 0x1c, 0x8e, 0x3b, 0x85, 0x4d,
-  0x5d, 0xba, 0x57, 0x19, 0x0a, 0x19, 0x58, 0x76, 0x65, 0x24, 0x67, 0xf4,
-  0xfc, 0x74, 0x32, 0xf9, 0x0c, 0xd4, 0x52, 0x3c, 0x33, 0x20, 0x2c, 0x83,
-  0x3b, 0x6e, 0x08, 0xe9, 0xa8, 0xbe, 0x8c, 0x6a, 0x71, 0xc6, 0x35, 0x42,
-  0x46, 0x0b, 0x1f, 0x81, 0xcd, 0x92, 0x70, 0x06, 0xeb, 0xa7, 0x2b, 0xb5,
-  0xbe, 0x1b, 0x8d, 0xe6, 0x19, 0xa3, 0x8a, 0x59, 0xe1, 0x92, 0x96, 0x48,
-  0x66, 0x68, 0xe3, 0x24, 0x03, 0x8f, 0x29, 0xc9, 0xdb, 0xff, 0x00, 0x8d,
-  0x21, 0x72, 0x8e, 0x41, 0x8c, 0x07, 0x52, 0xcc, 0xa2, 0xed, 0x33, 0x24,
-  0x33, 0x83, 0x93, 0xcc, 0xbe, 0x1b, 0xfb, 0xff, 0x00, 0x43, 0x7e, 0xa3,
-  0x4b, 0xb4, 0xf2, 0xf2, 0xb7, 0x2b, 0x1c, 0x8e, 0x6e, 0x53, 0xf0, 0x3f,
-  0xe0, 0xe9, 0xff, 0x00, 0xe9, 0x56, 0xcc, 0xf6, 0xf2, 0x95, 0xf1, 0x45,
-  0x24, 0x70, 0xd4, 0x62, 0x37, 0xe6, 0x03, 0x67, 0xea, 0x7a, 0x1e, 0xf8,
-  0xcf, 0xe3, 0xa5, 0x5f, 0xfc, 0x3e, 0xc9, 0xc2, 0xf3, 0x5f, 0xda, 0xa0,
-  0x12, 0x02, 0xb1, 0x89, 0x46, 0xca, 0x99, 0xe5, 0x24, 0x9f, 0xea, 0xf6,
-  0xf4, 0xd5, 0xd3, 0x20, 0x2b, 0x72, 0x45, 0x4d, 0xd4, 0x72, 0xb1, 0x5c,
-  0x9e, 0xb6, 0xc4, 0xa2, 0x49, 0x5f, 0xc5, 0x5d, 0xb2, 0x58, 0xee, 0xcb,
-  0xb3, 0x7e, 0x23, 0x94, 0xfc, 0x8e, 0x99, 0xec, 0xf7, 0x56, 0xb9, 0x70,
-  0x2d, 0xd6, 0xd7, 0x2c, 0xa7, 0xeb, 0x56, 0xd1, 0xe3, 0x46, 0x73, 0xb9,
-  0x8c, 0x9d, 0xf1, 0xf0, 0x27, 0xf3, 0xd5, 0x59, 0x78, 0x71, 0xad, 0xbf,
-  0x44, 0x76, 0x9a, 0xbe, 0x54, 0x15, 0xf0, 0x1f, 0xad, 0x54, 0x80, 0x77,
-  0xe5, 0x9b, 0xb1, 0xf8, 0x61, 0x47, 0xcf, 0x49, 0x73, 0xdc, 0xe5, 0xb5,
-  0xd5, 0x2d, 0xc2, 0x9c, 0x96, 0x8a, 0x58, 0x9e, 0x09, 0xd7, 0xfa, 0xa3,
-  0x70, 0x47, 0xe5, 0x9c, 0xfc, 0x74, 0xfd, 0x34, 0x6a, 0x28, 0x6e, 0xa1,
-  0x71, 0x88, 0xd4, 0x4d, 0x3c, 0x7c, 0xcf, 0x34, 0x8f, 0x37, 0x4c, 0xb3,
-  0x0f, 0xc8, 0x63, 0x45, 0xb8, 0x42, 0xd7, 0x05, 0xf5, 0x2a, 0xcc, 0x75,
-  0x91, 0xaf, 0xd5, 0xa7, 0x11, 0x54, 0x46, 0xe3, 0x0c, 0x79, 0x4e, 0xe7,
-  0xe1, 0xdb, 0xe3, 0xa2, 0x10, 0xf0, 0x5d, 0x5c, 0x34, 0x71, 0xcb, 0x20,
-  0x8d, 0x70, 0x41, 0x95, 0x8c, 0x83, 0x61, 0xec, 0x07, 0xf7, 0xd6, 0x61,
-  0x6a, 0xbb, 0x2d, 0xb2, 0xb2, 0xe3, 0x55, 0x3c, 0x8e, 0x63, 0xa7, 0xb9,
-  0x54, 0x34, 0xa1, 0x4f, 0x9a, 0x48, 0xf3, 0xe6, 0x03, 0xdf, 0x0b, 0x91,
-  0xaa, 0xe2, 0xc5, 0xd7, 0x77, 0x25, 0x93, 0x2d, 0x55, 0x4d, 0xd2, 0x0b,
-  0x1d, 0x8e, 0x19, 0x88, 0x8e, 0x9e, 0x12, 0x7e, 0xf2, 0xf3, 0x67, 0x3a,
-  0xb2, 0xb4, 0x36, 0xc8, 0x18, 0x3c, 0x74, 0xb4, 0xc9, 0x83, 0xb1, 0xc0,
-  0xc8, 0xd0, 0x68, 0x2d, 0x34, 0x15, 0x34, 0x34, 0xd5, 0xd4, 0x95, 0x32,
-  0xbc, 0x13, 0x85, 0x65, 0x6f, 0x55, 0x3b, 0xfc, 0x46, 0xda, 0xbe, 0x2c,
-  0xb4, 0x29, 0x9c, 0x24, 0xa4, 0x8e, 0xe5, 0xce, 0xa7, 0x71, 0xaa, 0x58,
-  0x9d, 0x2d, 0xd1, 0xc6, 0x40, 0x4a, 0x64, 0x6c, 0xe3, 0xa0, 0xce, 0x73,
-  0xa9, 0xe9, 0xe7, 0xb7, 0x46, 0xa5, 0x9a, 0x5a, 0x51, 0xec, 0x39, 0x75,
-  0x46, 0x6a, 0x1b, 0x78, 0x62, 0xcf, 0x07, 0x31, 0x3b, 0x92, 0x58, 0xea,
-  0xb4, 0xf0, 0xd0, 0x26, 0xd1, 0xc0, 0x83, 0xe2, 0x4e, 0x84, 0x30, 0xa4,
-  0xd7, 0xab, 0x7c, 0x79, 0x02, 0x58, 0x87, 0xb8, 0xd2, 0x9f, 0x1b, 0x55,
-  0x43, 0x5b, 0x14, 0x15, 0x14, 0xce, 0x1f, 0xc3, 0x66, 0x56, 0xc7, 0x6c,
-  0xef, 0xfb, 0x6a, 0xf3, 0xad, 0x1e, 0xec, 0xc9, 0x0a, 0xa8, 0xf5, 0xd5,
-  0x5b, 0xdc, 0x54, 0xef, 0x68, 0x97, 0xc0, 0xf0, 0x81, 0x05, 0x5b, 0x09,
-  0x8f, 0x71, 0xfb, 0xe8, 0x42, 0x20, 0x5b, 0x97, 0x14, 0xcd, 0x47, 0xc3,
-  0x31, 0x53, 0x07, 0x11, 0xf8, 0x41, 0x82, 0x91, 0xd4, 0xe4, 0x9d, 0xcf,
-  0xc0, 0x7e, 0xde, 0xba, 0x53, 0xe0, 0xdb, 0x53, 0xf1, 0x0d, 0xda, 0x4a,
-  0xba, 0xb3, 0x24, 0x74, 0x10, 0x79, 0xe6, 0x93, 0xfa, 0x54, 0x6f, 0x8c,
-  0xff, 0x00, 0x51, 0xdf, 0x7f, 0x89, 0xf4, 0xd0, 0x9e, 0x27, 0xac, 0x79,
-  0xab, 0x0d, 0x2c, 0x79, 0x6e, 0x56, 0x0a, 0x14, 0x1e, 0xa7, 0x38, 0x03,
-  0xe6, 0x77, 0xfc, 0x35, 0xa0, 0x5d, 0x02, 0xf0, 0xcf, 0xd1, 0xcd, 0x35,
-  0xb6, 0x2e, 0x55, 0x9e, 0xb7, 0x79, 0xd8, 0x75, 0x6c, 0x6e, 0xff, 0x00,
-  0x9e, 0x07, 0xc3, 0x5d, 0xeb, 0x0f, 0xa4, 0x50, 0xe2, 0x4b, 0xbc, 0x53,
-  0xd7, 0x4a, 0xf1, 0x46, 0xb1, 0xc4, 0x36, 0x8a, 0x21, 0xb0, 0x55, 0x1b,
-  0x2a, 0xfe, 0x03, 0x7f, 0x87, 0xbe, 0xac, 0xf0, 0x8d, 0x25, 0x8e, 0xf9,
-  0x66, 0xac, 0x15, 0x89, 0x3c, 0xb5, 0x90, 0xd5, 0x07, 0x92, 0x42, 0x1b,
-  0x0a, 0x9c, 0xa4, 0x20, 0x1c, 0xbb, 0x9e, 0x77, 0x6c, 0x36, 0xe0, 0x00,
-  0x07, 0x5c, 0x69, 0x22, 0xba, 0x79, 0x67, 0x99, 0xb9, 0x09, 0xe6, 0x73,
-  0xf8, 0x0d, 0x6c, 0xbc, 0x1e, 0x92, 0x70, 0x77, 0x0e, 0xc1, 0x49, 0x53,
-  0x19, 0x88, 0xac, 0xa9, 0x55, 0x54, 0xb1, 0x2f, 0x33, 0x4c, 0x18, 0x8f,
-  0x33, 0xb1, 0xd9, 0x42, 0x80, 0x46, 0x3a, 0xe4, 0x83, 0xd3, 0x48, 0xe0,
-  0x01, 0x66, 0x53, 0x1b, 0x1b, 0xa1, 0x1d, 0xf8, 0x2a, 0x33, 0x15, 0x24,
-  0x8b, 0x86, 0x1b, 0xed, 0xcc, 0x30, 0xdc, 0xb9, 0x3c, 0xb9, 0x1d, 0xbc,
-  0xa0, 0x6d, 0xa1, 0x5f, 0x49, 0x5c, 0x33, 0x70, 0xba, 0x70, 0xe4, 0x37,
-  0x0b, 0x64, 0x0f, 0x51, 0x2d, 0x34, 0xac, 0xb3, 0x44, 0x83, 0x2c, 0x63,
-  0x3f, 0x78, 0x0e, 0xf8, 0xdf, 0xf1, 0xd1, 0xde, 0x16, 0x73, 0x2d, 0x2f,
-  0x8f, 0xc8, 0xc8, 0x24, 0x19, 0xc1, 0xf8, 0x9c, 0x1f, 0x70, 0x7a, 0x83,
-  0xe9, 0xa6, 0x25, 0xba, 0x52, 0x59, 0xac, 0x12, 0xd5, 0x54, 0xd4, 0x47,
-  0x0e, 0x5c, 0x88, 0xc3, 0x1f, 0x33, 0xb7, 0x60, 0xa3, 0xa9, 0x3f, 0x0d,
-  0x3a, 0x28, 0x3c, 0xc8, 0xbb, 0x10, 0x6c, 0x4f, 0xce, 0x2b, 0x64, 0x6a,
-  0x8e, 0x07, 0xa1, 0xba, 0x51, 0x53, 0x80, 0xf1, 0x4a, 0xe2, 0xa8, 0xae,
-  0x49, 0x62, 0x24, 0x20, 0xb1, 0xf8, 0x0c, 0x7c, 0xb5, 0xa8, 0xdc, 0x21,
-  0xa6, 0xb7, 0x54, 0x03, 0x1d, 0x44, 0x89, 0x2a, 0xd2, 0x05, 0x64, 0x53,
-  0x1c, 0x60, 0xaa, 0x65, 0x87, 0x99, 0xf6, 0x27, 0x19, 0xc0, 0xce, 0x4e,
-  0x34, 0x1e, 0xff, 0x00, 0x5d, 0x4f, 0x62, 0xb9, 0xff, 0x00, 0x13, 0x89,
-  0x7c, 0x3a, 0x0b, 0x9b, 0x31, 0xa9, 0xa5, 0x18, 0x65, 0x67, 0xef, 0x22,
-  0x80, 0x7c, 0x8c, 0x7b, 0x8d, 0xc1, 0xf6, 0x3a, 0x71, 0xb1, 0x25, 0xa7,
-  0x8b, 0x78, 0x6d, 0x67, 0x8c, 0xc3, 0x29, 0x0d, 0xe1, 0xcc, 0x1e, 0x30,
-  0xd9, 0x65, 0xfb, 0x24, 0x8e, 0xa1, 0x80, 0xc6, 0x08, 0xd6, 0x43, 0xb9,
-  0xa3, 0xb8, 0x9a, 0x1b, 0xa9, 0x14, 0x31, 0x15, 0x10, 0xe1, 0xbf, 0xda,
-  0xb8, 0x94, 0x49, 0x63, 0x9d, 0x6b, 0x22, 0x69, 0xc6, 0x23, 0x33, 0x84,
-  0x3e, 0x6c, 0x64, 0x10, 0x57, 0xbf, 0xf9, 0xd0, 0x3e, 0x23, 0xe1, 0xda,
-  0xaa, 0x2b, 0x3c, 0x17, 0x24, 0x84, 0xf8, 0x90, 0xaf, 0x85, 0x56, 0x8b,
-  0xdf, 0x94, 0xe3, 0x9c, 0x7b, 0x10, 0x01, 0xf8, 0x9f, 0x7d, 0x3d, 0xd0,
-  0x70, 0xcd, 0x9a, 0xcb, 0x72, 0x77, 0xa4, 0xa4, 0x09, 0x3a, 0x12, 0xa1,
-  0x99, 0x89, 0x23, 0x3d, 0x71, 0x9d, 0x16, 0x9a, 0x9f, 0x9e, 0x90, 0xb4,
-  0x88, 0x1a, 0x17, 0xca, 0x1c, 0x8d, 0x8e, 0xdb, 0x8d, 0x4c, 0x64, 0xe8,
-  0x3e, 0xef, 0x12, 0xbd, 0x36, 0x37, 0x99, 0x0f, 0xd1, 0x9d, 0x3a, 0x54,
-  0x71, 0x8c, 0x92, 0x72, 0x86, 0x02, 0x8c, 0xb2, 0x92, 0x33, 0x8f, 0x38,
-  0xc1, 0x1f, 0x8e, 0x9c, 0x38, 0xda, 0xd5, 0x76, 0xaa, 0xb6, 0xa4, 0x36,
-  0xf8, 0x9a, 0x67, 0x0d, 0xcc, 0x67, 0x8e, 0xb6, 0x44, 0x73, 0x90, 0x41,
-  0x53, 0x1e, 0x42, 0xf2, 0xae, 0xc4, 0x1f, 0xc4, 0x6b, 0xee, 0x10, 0xe1,
-  0xb3, 0x64, 0xe2, 0x3b, 0xb1, 0x55, 0xcd, 0x34, 0x91, 0xc6, 0xd4, 0x8f,
-  0xe8, 0xa5, 0x98, 0x94, 0xf8, 0x83, 0xfb, 0x69, 0x98, 0xab, 0x73, 0x1c,
-  0xfe, 0x1a, 0x39, 0x33, 0x7b, 0xf6, 0x20, 0x5c, 0x76, 0xb4, 0x66, 0x69,
-  0x79, 0xb3, 0xdc, 0x2d, 0xfc, 0x1b, 0x3c, 0x37, 0x8a, 0xc9, 0x27, 0x12,
-  0x48, 0x8b, 0x1c, 0x4f, 0x21, 0x70, 0x87, 0x39, 0xf2, 0x93, 0xbe, 0x70,
-  0x18, 0x9e, 0xd8, 0xdb, 0x5d, 0x70, 0xa5, 0x12, 0x9e, 0x0c, 0x92, 0x4b,
-  0xa4, 0x2a, 0x96, 0xcf, 0x10, 0xf3, 0x97, 0x18, 0xe6, 0x1c, 0xe4, 0xe3,
-  0x6d, 0xc8, 0xe9, 0xa3, 0x9f, 0x49, 0x93, 0x43, 0x43, 0x6c, 0x8e, 0xe5,
-  0x5e, 0xab, 0x35, 0x3d, 0x31, 0x1e, 0x1d, 0x3f, 0x36, 0x3c, 0x69, 0x58,
-  0x80, 0x01, 0xf6, 0x00, 0x69, 0x26, 0x86, 0xae, 0xa6, 0xf7, 0x02, 0xca,
-  0x6a, 0x9e, 0x08, 0xe6, 0x93, 0xc5, 0x58, 0x59, 0xb2, 0x83, 0x07, 0x1d,
-  0x3a, 0x6d, 0x8d, 0x51, 0x09, 0x29, 0x7e, 0xb1, 0x91, 0x14, 0xb9, 0x5b,
-  0x8f, 0x62, 0xe9, 0x41, 0x79, 0xa6, 0x9e, 0x9e, 0x91, 0xd6, 0x52, 0x50,
-  0x87, 0x55, 0xd8, 0xf2, 0x9d, 0xb3, 0x8f, 0xc3, 0x59, 0xac, 0xd1, 0x73,
-  0x41, 0x57, 0x43, 0x28, 0xf3, 0x44, 0xc5, 0x71, 0xf9, 0x8d, 0x37, 0xf0,
-  0xdd, 0xb6, 0xa1, 0x38, 0x91, 0xaa, 0xd1, 0xd6, 0x50, 0x8a, 0x4c, 0xb2,
-  0x2e, 0x39, 0x49, 0x61, 0xf6, 0x76, 0xdb, 0x3d, 0xf1, 0xa0, 0x9c, 0x61,
-  0x4c, 0x68, 0xf8, 0xa5, 0x9c, 0x0e, 0x54, 0xa9, 0x5c, 0xfc, 0xfa, 0x8f,
-  0xd0, 0xeb, 0x4a, 0x1b, 0x17, 0x21, 0x91, 0x02, 0x39, 0x51, 0x36, 0x6a,
-  0x7a, 0x7b, 0xe4, 0xe6, 0x4a, 0x57, 0xb8, 0x40, 0x81, 0x70, 0x24, 0x1c,
-  0x9d, 0x8f, 0xcb, 0x5f, 0x9c, 0xe9, 0x55, 0xa1, 0xbf, 0xdd, 0xad, 0x37,
-  0x27, 0x48, 0x6a, 0x05, 0x5c, 0xa0, 0xf8, 0xbb, 0x07, 0x6c, 0xb0, 0x23,
-  0x3d, 0xb2, 0x0f, 0x7d, 0x6d, 0xdc, 0x41, 0xc4, 0xd5, 0xd4, 0xd6, 0xea,
-  0xaa, 0xca, 0x21, 0x0d, 0x5d, 0x4a, 0x13, 0x12, 0x53, 0x45, 0x28, 0x56,
-  0x99, 0x95, 0xbc, 0xc1, 0x41, 0xfb, 0x44, 0x6e, 0x70, 0x37, 0x38, 0xdb,
-  0x58, 0x55, 0xfb, 0x88, 0x28, 0xee, 0x77, 0xb8, 0xef, 0xd4, 0xf4, 0xf2,
-  0x78, 0xb5, 0x68, 0x56, 0xba, 0x99, 0x87, 0xdf, 0x1e, 0x53, 0xca, 0x7b,
-  0x82, 0x39, 0x4e, 0xfb, 0x82, 0x0e, 0x47, 0xae, 0xad, 0x33, 0xd3, 0x51,
-  0x98, 0x32, 0x8d, 0xa1, 0xef, 0xa3, 0x4e, 0x37, 0xaa, 0xb7, 0xda, 0xde,
-  0xdb, 0x74, 0x5a, 0xa3, 0x4b, 0x6e, 0x6f, 0x0d, 0xe6, 0x46, 0x19, 0x44,
-  0xe6, 0xe5, 0xc9, 0x04, 0xe4, 0x81, 0xd3, 0xe1, 0xf0, 0xd3, 0x57, 0x11,
-  0xf1, 0x99, 0x4a, 0xf1, 0x4b, 0x63, 0x9e, 0x7a, 0xf8, 0x10, 0xff, 0x00,
-  0xd4, 0x56, 0x3b, 0x72, 0xc6, 0x83, 0xfd, 0x20, 0x9f, 0x37, 0xcf, 0xaf,
-  0x6d, 0x66, 0xf7, 0x9b, 0x75, 0x3b, 0x51, 0xcd, 0x57, 0x4d, 0x3c, 0x54,
-  0x5e, 0x2c, 0x62, 0x3a, 0xaa, 0x59, 0x1b, 0x0f, 0x9d, 0x88, 0xd8, 0x67,
-  0x0d, 0xb7, 0x4f, 0x4e, 0xb8, 0xd2, 0xeb, 0x56, 0xdc, 0xed, 0x8f, 0xe1,
-  0xc5, 0x28, 0x64, 0x94, 0x06, 0x2b, 0x8e, 0x64, 0x18, 0xfd, 0x0f, 0x6d,
-  0x40, 0xa7, 0x49, 0x20, 0x71, 0x2a, 0xac, 0x68, 0x5c, 0x73, 0xe2, 0x4f,
-  0xa4, 0x4b, 0xfc, 0x35, 0xf1, 0xc3, 0x03, 0x30, 0x8f, 0x94, 0x61, 0x98,
-  0x63, 0x9c, 0x03, 0xdb, 0xfc, 0xe9, 0xef, 0x85, 0x2f, 0xd4, 0x57, 0x6b,
-  0x25, 0x1d, 0x55, 0x75, 0xea, 0x8a, 0x92, 0xb6, 0x75, 0x25, 0xa9, 0x90,
-  0x97, 0x65, 0xf3, 0x10, 0x33, 0xb6, 0xc4, 0xe3, 0x38, 0xd2, 0x9d, 0x12,
-  0xd1, 0xd4, 0x70, 0xb5, 0x2d, 0xfa, 0xa0, 0x45, 0x42, 0x15, 0x4e, 0x1a,
-  0x55, 0x04, 0x13, 0x9c, 0x10, 0x01, 0xdc, 0x83, 0x8e, 0xdb, 0xea, 0x84,
-  0x5f, 0x57, 0xaf, 0xa3, 0x47, 0xa6, 0xa5, 0xf0, 0x64, 0x91, 0x4b, 0x78,
-  0x1c, 0xa0, 0x31, 0x03, 0xef, 0x0c, 0x6e, 0x41, 0xea, 0x3b, 0xfe, 0xba,
-  0x15, 0x0d, 0xcd, 0x22, 0x77, 0x8c, 0x49, 0x81, 0x75, 0x8d, 0x97, 0xfd,
-  0x74, 0xe4, 0x6a, 0x39, 0xab, 0xd6, 0x9e, 0x96, 0x65, 0x11, 0x51, 0xd4,
-  0x17, 0x42, 0xa1, 0xe2, 0x99, 0x94, 0x8f, 0x8a, 0x9e, 0xba, 0x47, 0xb4,
-  0xdd, 0xa7, 0x8d, 0x7e, 0xab, 0x54, 0xe6, 0x6c, 0x6c, 0xad, 0x82, 0x58,
-  0x0f, 0x7d, 0x10, 0xa8, 0xa8, 0x25, 0x94, 0x2a, 0x36, 0x1b, 0x38, 0x62,
-  0xa7, 0x97, 0x23, 0xb1, 0xf8, 0xef, 0xbe, 0x9f, 0x1e, 0x32, 0xe6, 0x84,
-  0x0c, 0xfd, 0x22, 0x07, 0xb3, 0xd3, 0x4e, 0x38, 0x9a, 0x1a, 0x9a, 0xd8,
-  0xc8, 0x86, 0x29, 0x1a, 0x67, 0x7f, 0xba, 0x5f, 0xee, 0x8f, 0xc7, 0x4d,
-  0x5c, 0x57, 0x15, 0xda, 0xf2, 0xb1, 0x0a, 0xb8, 0x1a, 0x94, 0x2c, 0x2c,
-  0x23, 0x4c, 0x0e, 0x60, 0x32, 0x58, 0xec, 0x4f, 0x53, 0x9d, 0x50, 0xa7,
-  0xad, 0x9e, 0x9a, 0x58, 0x6b, 0x12, 0x9c, 0x41, 0x35, 0x31, 0x32, 0x2a,
-  0xb0, 0x0e, 0xa4, 0xe3, 0xa0, 0xec, 0xc0, 0xfc, 0x88, 0xf6, 0x3a, 0x74,
-  0xb8, 0x5d, 0xed, 0x76, 0xba, 0x7a, 0x3b, 0xed, 0xde, 0x95, 0xe6, 0x4f,
-  0x12, 0x16, 0x9a, 0x2a, 0x66, 0xe7, 0xe4, 0x07, 0x72, 0x46, 0x7a, 0x80,
-  0x77, 0xed, 0x9f, 0x9e, 0xb4, 0xe4, 0xc2, 0xb8, 0xc0, 0xef, 0x22, 0xb9,
-  0x4b, 0x18, 0x83, 0xc3, 0x36, 0x15, 0x93, 0xe9, 0x02, 0xdd, 0x66, 0x70,
-  0xaf, 0xe1, 0x54, 0x01, 0x39, 0xec, 0xc6, 0x31, 0xcc, 0xff, 0x00, 0x2c,
-  0xa9, 0x1a, 0xda, 0xaa, 0x62, 0xb7, 0xc3, 0x7c, 0x86, 0x2a, 0xb8, 0x24,
-  0x95, 0xae, 0x34, 0xea, 0x84, 0x83, 0xe5, 0x56, 0x0c, 0xb8, 0x3d, 0x72,
-  0xbb, 0x84, 0xdc, 0x77, 0x03, 0x59, 0xcf, 0xd1, 0xbd, 0x2d, 0x4d, 0x7f,
-  0xd2, 0x3a, 0xde, 0x6d, 0xf0, 0x4b, 0x57, 0x6e, 0x59, 0xea, 0x8b, 0x55,
-  0x2a, 0x1e, 0x41, 0xcd, 0xcd, 0x8c, 0x93, 0xdc, 0xf3, 0x0d, 0xba, 0xeb,
-  0x4e, 0xbc, 0x59, 0x65, 0x9a, 0xae, 0x8a, 0xaa, 0x9e, 0xb6, 0x96, 0x2b,
-  0x85, 0x38, 0x22, 0x18, 0xa6, 0x6f, 0x2c, 0x83, 0x20, 0xf6, 0xdf, 0xee,
-  0xf6, 0x1d, 0xcf, 0xc7, 0x58, 0x5b, 0x89, 0xa9, 0x7e, 0x29, 0x27, 0xd5,
-  0xeb, 0x69, 0xa9, 0x7e, 0xa3, 0x63, 0x82, 0x31, 0x29, 0xcf, 0xf3, 0xea,
-  0x32, 0x62, 0x87, 0x24, 0x92, 0xc7, 0x1b, 0xb9, 0xc9, 0x38, 0x51, 0xf3,
-  0x20, 0x69, 0x55, 0xa3, 0xba, 0x5a, 0x6e, 0xb5, 0x5c, 0x3f, 0x76, 0xaf,
-  0xfa, 0xf2, 0x5c, 0xa2, 0xcd, 0x35, 0x64, 0xaa, 0x17, 0xf9, 0x9d, 0x89,
-  0x1d, 0x17, 0x0d, 0x80, 0x40, 0xdb, 0x05, 0x4e, 0xb4, 0x49, 0x6a, 0x21,
-  0xa4, 0x80, 0x19, 0x5d, 0x23, 0x00, 0x6e, 0x01, 0xd8, 0x7a, 0xe3, 0x59,
-  0x7f, 0xd2, 0x35, 0x6d, 0x45, 0xca, 0xb2, 0x2b, 0x85, 0x21, 0x22, 0x8e,
-  0x81, 0x96, 0x32, 0x7f, 0xd5, 0x27, 0x46, 0xf9, 0x15, 0x5f, 0xc7, 0x5c,
-  0x08, 0x26, 0xa0, 0x17, 0xf1, 0x45, 0x18, 0x2d, 0xb3, 0x51, 0x5d, 0x8d,
-  0x3d, 0xca, 0x63, 0x45, 0x35, 0x30, 0xe5, 0x2b, 0x28, 0xc9, 0x04, 0xfb,
-  0x6e, 0x08, 0x39, 0xed, 0xa6, 0x2f, 0xa3, 0x6b, 0xd8, 0xe1, 0xcb, 0x8c,
-  0xcd, 0x20, 0x7f, 0xa8, 0xd5, 0x10, 0xb2, 0xa8, 0x1b, 0xae, 0x36, 0x0e,
-  0x07, 0xaf, 0xb7, 0xa6, 0xa4, 0xfa, 0x44, 0x9e, 0x2a, 0xa8, 0xec, 0xb7,
-  0xa5, 0x60, 0x3f, 0x88, 0x52, 0xe1, 0xbf, 0xfd, 0x89, 0xd7, 0xf5, 0x3f,
-  0x86, 0x96, 0xcc, 0xe1, 0x69, 0x5e, 0x4f, 0xe9, 0x19, 0xd7, 0x26, 0x11,
-  0x57, 0x2b, 0x93, 0x52, 0x5d, 0x7a, 0x6a, 0x6e, 0x55, 0xb0, 0x52, 0x5c,
-  0x69, 0xd2, 0xe3, 0x41, 0x2c, 0x73, 0x46, 0xe3, 0x21, 0xd1, 0xb2, 0x1b,
-  0xfc, 0xea, 0xad, 0xc2, 0xa9, 0x64, 0xb4, 0x47, 0x48, 0xb1, 0x72, 0x3c,
-  0x6e, 0x0e, 0xc3, 0xa8, 0xdf, 0x27, 0xe3, 0xac, 0xbf, 0xe8, 0xb6, 0xe7,
-  0x35, 0x35, 0xea, 0xe3, 0x41, 0x4b, 0x56, 0x63, 0x5a, 0x95, 0x5a, 0xda,
-  0x75, 0x27, 0x28, 0xe0, 0xec, 0xe3, 0x1f, 0x1c, 0x1d, 0xbd, 0x75, 0xa1,
-  0x9a, 0xf8, 0x64, 0xca, 0xdc, 0x61, 0x6a, 0x66, 0x3b, 0x78, 0xa8, 0x39,
-  0x90, 0xfe, 0xe3, 0x58, 0xb2, 0xaf, 0x43, 0x11, 0x1b, 0x15, 0x95, 0x04,
-  0xf6, 0x9c, 0xa8, 0xc0, 0xc7, 0x5d, 0x7c, 0x76, 0xc9, 0x3a, 0xe6, 0x71,
-  0x4b, 0x16, 0x25, 0x59, 0xa0, 0x74, 0xc6, 0x56, 0x45, 0x61, 0x8d, 0x2d,
-  0x71, 0xbd, 0x5c, 0xef, 0xc3, 0xb5, 0xbe, 0x03, 0xc9, 0x4f, 0x19, 0x4e,
-  0x51, 0x26, 0x79, 0x59, 0xb2, 0x71, 0xb7, 0xcb, 0x50, 0x54, 0xea, 0x35,
-  0x34, 0x16, 0xda, 0xe6, 0x6d, 0xf4, 0xb3, 0x7d, 0x6e, 0x20, 0xbf, 0x2d,
-  0xae, 0x85, 0xf9, 0xe9, 0x28, 0x89, 0x05, 0x81, 0xd9, 0xa4, 0xee, 0x7e,
-  0x03, 0xa7, 0xe3, 0xae, 0x2d, 0x96, 0x88, 0x5e, 0xcb, 0x66, 0x25, 0x98,
-  0x62, 0xe9, 0xe1, 0x96, 0xce, 0x32, 0x0e, 0x33, 0xaa, 0x10, 0x24, 0x69,
-  0x0e, 0x11, 0x55, 0x40, 0xdb, 0x00, 0x69, 0x8d, 0x20, 0x91, 0x38, 0x42,
-  0xd0, 0x51, 0x82, 0x49, 0x3d, 0xd8, 0x98, 0x8b, 0x0c, 0x8f, 0x4c, 0xe3,
-  0xd3, 0x23, 0x5e, 0xd0, 0x41, 0x8d, 0x02, 0x89, 0xe6, 0xf5, 0x17, 0x62,
-  0x4c, 0x6e, 0xb6, 0xc6, 0xb6, 0xda, 0xba, 0xe8, 0x16, 0x63, 0x2c, 0x5c,
-  0xcb, 0xe1, 0x92, 0x37, 0xc6, 0x3b, 0xfb, 0xe8, 0x27, 0xd2, 0x6d, 0x39,
-  0x36, 0xea, 0x6a, 0xf5, 0x5c, 0xb4, 0x4d, 0x83, 0xed, 0xdc, 0x7e, 0xfa,
-  0x2a, 0xd1, 0x1a, 0x7a, 0x8f, 0x07, 0x9d, 0xa4, 0x39, 0xf3, 0xbb, 0x6c,
-  0x58, 0xf7, 0x3b, 0x74, 0xf8, 0x76, 0xd0, 0x8e, 0x3f, 0x90, 0xff, 0x00,
-  0xe1, 0xd4, 0x9d, 0x98, 0xf8, 0x42, 0xba, 0x28, 0x49, 0x3d, 0xf9, 0x95,
-  0xf5, 0x35, 0xdc, 0x47, 0xba, 0x33, 0x38, 0xbc, 0x51, 0xf1, 0x03, 0xd7,
-  0x7d, 0x6a, 0xdd, 0x5b, 0x71, 0xab, 0xa9, 0x1c, 0xab, 0x12, 0xc7, 0x21,
-  0x69, 0x00, 0xce, 0x00, 0xc7, 0xde, 0xdc, 0xf5, 0xfc, 0x75, 0xd5, 0xc2,
-  0xad, 0xfc, 0x41, 0x2c, 0xd4, 0xb0, 0xc5, 0x77, 0xc6, 0x2a, 0xe7, 0x8f,
-  0xa1, 0x70, 0x71, 0xcd, 0x8e, 0x9e, 0x26, 0x36, 0x2c, 0x35, 0xaa, 0x7d,
-  0x08, 0xc7, 0x6f, 0x96, 0x6a, 0xea, 0xb9, 0x23, 0x73, 0x72, 0x5c, 0x08,
-  0xdc, 0xfd, 0x95, 0x8c, 0xf5, 0x0b, 0xef, 0xb6, 0xfe, 0xdf, 0x3d, 0x41,
-  0xf4, 0xbf, 0xc1, 0x82, 0x60, 0xfc, 0x41, 0x6b, 0x87, 0x12, 0x0f, 0xfe,
-  0xee, 0x24, 0x1f, 0x68, 0x7f, 0x58, 0x1e, 0xbe, 0xba, 0x24, 0xc4, 0x03,
-  0x79, 0x8c, 0x0f, 0x01, 0x79, 0xfc, 0x78, 0xcb, 0x86, 0x04, 0x03, 0x9d,
-  0xd4, 0xfa, 0x8d, 0x57, 0x96, 0x9c, 0x49, 0x4c, 0x23, 0x86, 0xbd, 0x65,
-  0x93, 0x6c, 0x42, 0x53, 0x0e, 0x7d, 0x40, 0xdf, 0xa7, 0xbe, 0xbb, 0xaf,
-  0x92, 0x46, 0x9b, 0xea, 0xd4, 0xe9, 0xfc, 0xcf, 0xbc, 0xec, 0x36, 0x51,
-  0xa9, 0x69, 0x69, 0x1a, 0x0a, 0x72, 0x61, 0x5c, 0xf3, 0xfd, 0xb9, 0x0f,
-  0xda, 0x6f, 0xf1, 0xed, 0xa1, 0x3a, 0xa4, 0x15, 0xb4, 0x55, 0x10, 0xd2,
-  0x53, 0x20, 0xae, 0x12, 0x05, 0x76, 0x3e, 0x17, 0x31, 0xe4, 0x8c, 0xf5,
-  0xf2, 0x9e, 0xe7, 0xd7, 0x03, 0xaf, 0xae, 0xad, 0x58, 0xee, 0x52, 0x55,
-  0x55, 0x34, 0x13, 0x96, 0x13, 0x93, 0x80, 0xeb, 0x90, 0x49, 0x1b, 0xf5,
-  0xf5, 0xf7, 0xd4, 0xeb, 0x0f, 0x8d, 0x09, 0x8a, 0x5d, 0xd3, 0xf4, 0xf7,
-  0xd2, 0xe5, 0xc6, 0x45, 0xa3, 0xba, 0xa3, 0x53, 0x54, 0xb1, 0x55, 0xc1,
-  0x0e, 0xa3, 0xbe, 0x77, 0xc7, 0xae, 0x98, 0x6f, 0x01, 0xda, 0x31, 0xd5,
-  0xdd, 0xae, 0xb4, 0xf3, 0xac, 0x55, 0xd7, 0x37, 0x8a, 0x37, 0x3b, 0xc8,
-  0xaa, 0x03, 0x11, 0x9e, 0xa4, 0x0d, 0xc9, 0xfd, 0x74, 0xd9, 0x62, 0x34,
-  0xd3, 0x5a, 0x11, 0x68, 0xae, 0xf5, 0x52, 0x82, 0x77, 0x33, 0x0c, 0xfc,
-  0x76, 0x23, 0x3f, 0x86, 0x97, 0xa9, 0xa4, 0xb4, 0x5d, 0xed, 0xb3, 0x52,
-  0xdb, 0x53, 0x96, 0xb5, 0x80, 0x62, 0xf5, 0x2b, 0x99, 0x1c, 0xf7, 0xc9,
-  0xee, 0xbd, 0xb0, 0x36, 0x1e, 0x9a, 0x00, 0x94, 0xb5, 0x34, 0x12, 0x3c,
-  0xb2, 0xa4, 0x91, 0x4b, 0x4c, 0x19, 0xf9, 0x24, 0x38, 0xf0, 0xc0, 0xf4,
-  0xf5, 0x07, 0xd7, 0x5a, 0xb4, 0xae, 0x11, 0xaa, 0xa4, 0xb3, 0x02, 0x44,
-  0xd2, 0x84, 0xd5, 0x2a, 0x3c, 0x29, 0x5a, 0x39, 0xa9, 0xa3, 0x38, 0xca,
-  0x67, 0x20, 0xfb, 0xa9, 0xd1, 0x5b, 0x15, 0xd2, 0x5a, 0x76, 0x34, 0x71,
-  0xc2, 0x2b, 0x2d, 0xf5, 0x79, 0x49, 0x62, 0x5f, 0xb4, 0xa3, 0x7c, 0xb2,
-  0x9f, 0xe9, 0xc6, 0x72, 0xbf, 0x86, 0x0f, 0x54, 0x74, 0xa8, 0xaa, 0x4a,
-  0x1a, 0x4a, 0x86, 0x6c, 0x07, 0x55, 0x25, 0x3e, 0x23, 0xf2, 0xd7, 0x34,
-  0xf7, 0x81, 0x6b, 0x94, 0xc7, 0x2f, 0x8d, 0x1c, 0xa2, 0x63, 0x24, 0x1c,
-  0xad, 0xca, 0x46, 0x4f, 0x5c, 0xf6, 0x1b, 0xf5, 0xd6, 0xcc, 0x8c, 0x84,
-  0x74, 0x19, 0x04, 0x04, 0x6f, 0x18, 0xed, 0xd7, 0x4a, 0xff, 0x00, 0xa3,
-  0xee, 0x24, 0xcd, 0x3c, 0xd3, 0x7f, 0x0b, 0xa9, 0xcb, 0xc6, 0x7a, 0x8c,
-  0x7b, 0x8f, 0x51, 0xd0, 0x8e, 0xe3, 0x7d, 0x3d, 0x4f, 0xc5, 0x0b, 0x7d,
-  0xae, 0xa6, 0xba, 0xdb, 0xa9, 0xde, 0x9a, 0x56, 0x11, 0xac, 0x8c, 0xa7,
-  0x39, 0x71, 0xcc, 0x09, 0x38, 0xdc, 0x28, 0x53, 0x8c, 0x82, 0x0f, 0x98,
-  0x74, 0xc6, 0x4e, 0x6b, 0xc5, 0x3c, 0x40, 0x2e, 0x96, 0x74, 0xa4, 0xa9,
-  0x85, 0x65, 0x98, 0x30, 0x68, 0xa6, 0x5c, 0x0c, 0x63, 0xae, 0x71, 0xb1,
-  0xcf, 0xb7, 0xe1, 0xa2, 0xdf, 0x45, 0x73, 0xd4, 0xad, 0x14, 0xf1, 0xbc,
-  0xde, 0x1c, 0x31, 0xbc, 0x80, 0x36, 0x39, 0xb2, 0xc8, 0x8a, 0xe0, 0x32,
-  0x80, 0x4e, 0x08, 0x70, 0x32, 0x3d, 0x3d, 0xb5, 0xe4, 0x6a, 0x31, 0x05,
-  0xe6, 0x7a, 0x5a, 0x6c, 0x9d, 0x5b, 0x4d, 0x15, 0x5a, 0xaa, 0x78, 0xd5,
-  0x26, 0x9e, 0x59, 0xd9, 0x46, 0x39, 0x9d, 0xb3, 0xaa, 0xd5, 0x16, 0xca,
-  0x8a, 0xb3, 0x57, 0x42, 0x6e, 0xf5, 0x14, 0x90, 0xcf, 0x12, 0x93, 0x0a,
-  0xc4, 0x8c, 0xac, 0x47, 0x4c, 0xe4, 0x64, 0x74, 0x1d, 0x34, 0x62, 0xdb,
-  0x2c, 0x95, 0x68, 0x91, 0xdb, 0xe9, 0x84, 0x93, 0x91, 0xfc, 0xc4, 0x0d,
-  0xcd, 0xe1, 0xfa, 0xe5, 0xba, 0x03, 0x9c, 0x6a, 0x5b, 0x4f, 0x07, 0xd5,
-  0x50, 0x83, 0x51, 0x72, 0xb9, 0x54, 0xd7, 0xca, 0xc7, 0x26, 0x9d, 0x55,
-  0x47, 0x39, 0xff, 0x00, 0x53, 0xf6, 0x5f, 0x6f, 0x4e, 0xfa, 0x90, 0x33,
-  0x8f, 0x34, 0x66, 0x6b, 0x55, 0x34, 0x37, 0x5e, 0x1a, 0x83, 0x87, 0x6a,
-  0xea, 0x8d, 0x0d, 0x6d, 0x1d, 0x53, 0x49, 0x4d, 0x24, 0x9b, 0x00, 0xc7,
-  0xee, 0x1f, 0x4d, 0xc9, 0xf8, 0x82, 0x31, 0x9d, 0x08, 0x57, 0xb8, 0x51,
-  0x49, 0x25, 0xbe, 0xed, 0x01, 0x8a, 0x52, 0xb8, 0x57, 0xea, 0x92, 0x0f,
-  0x50, 0x7b, 0xeb, 0x40, 0xfa, 0x45, 0xe1, 0x53, 0x52, 0xcb, 0x5b, 0x70,
-  0x8e, 0x30, 0xf5, 0x09, 0xe1, 0x87, 0x80, 0x60, 0x46, 0x17, 0xa2, 0x7a,
-  0x10, 0x07, 0xe9, 0xac, 0xf6, 0x5a, 0xcb, 0xe7, 0x0c, 0xd4, 0x25, 0x2c,
-  0xbe, 0x0d, 0xda, 0x81, 0x97, 0x29, 0x0d, 0x4a, 0x73, 0x2b, 0x2f, 0x70,
-  0x3b, 0x8f, 0x91, 0xd5, 0x53, 0x20, 0xe2, 0x13, 0x81, 0xba, 0x7a, 0xc6,
-  0xe2, 0x0b, 0xb2, 0x56, 0xd4, 0xd2, 0x55, 0x2f, 0x83, 0x39, 0x8a, 0xa2,
-  0x92, 0x42, 0xd4, 0xf2, 0xe3, 0x3c, 0x87, 0xd0, 0xfa, 0xa9, 0xe8, 0x47,
-  0xbe, 0x9c, 0x6d, 0x7c, 0x55, 0xc5, 0xb7, 0x2a, 0x79, 0x4c, 0xf7, 0x3b,
-  0x45, 0x00, 0x47, 0xe5, 0x27, 0x95, 0x55, 0xbf, 0xf6, 0x9c, 0xfc, 0x73,
-  0xa1, 0x89, 0x3f, 0x04, 0xdd, 0xdb, 0xc5, 0x58, 0xeb, 0xac, 0x55, 0x2c,
-  0x3c, 0xca, 0x0f, 0x8d, 0x10, 0x3f, 0x3f, 0x30, 0x1a, 0xf2, 0x4e, 0x0b,
-  0x7b, 0x91, 0x12, 0x5a, 0x2f, 0x76, 0x9a, 0xb9, 0xa3, 0xde, 0x30, 0x65,
-  0xf0, 0xdc, 0xfb, 0x60, 0xe9, 0x98, 0x23, 0x1b, 0x61, 0x22, 0x0b, 0x2f,
-  0x06, 0x59, 0xaa, 0xac, 0x8b, 0x98, 0xb5, 0x6f, 0x16, 0xd4, 0xca, 0xdd,
-  0x4a, 0xd2, 0xc7, 0x81, 0xf8, 0x8d, 0xb4, 0x06, 0xf5, 0x51, 0x6d, 0x72,
-  0xaf, 0x46, 0xf5, 0xf2, 0xca, 0xad, 0x8f, 0x16, 0xa6, 0x5c, 0xe7, 0x6e,
-  0xc3, 0xb6, 0x3f, 0xb6, 0xa9, 0xc9, 0x15, 0x4a, 0x56, 0x9b, 0x7c, 0xd4,
-  0xef, 0x1d, 0x62, 0xc9, 0xe1, 0xb4, 0x27, 0xa8, 0x6c, 0xe3, 0x1f, 0xe7,
-  0x57, 0x90, 0xdb, 0x2d, 0x13, 0xb7, 0x8b, 0xc9, 0x73, 0xac, 0x87, 0x2a,
-  0xaa, 0x9b, 0xc2, 0x8d, 0x9d, 0xc9, 0x3f, 0x7b, 0x7d, 0x38, 0x55, 0x5d,
-  0xc4, 0x16, 0x5b, 0x68, 0x46, 0xc5, 0x64, 0x8e, 0x3b, 0x7a, 0xdd, 0xaf,
-  0xd3, 0x7d, 0x4e, 0xdf, 0xf7, 0x13, 0xa4, 0x93, 0xfb, 0x28, 0xf4, 0xf7,
-  0xff, 0x00, 0xe7, 0x46, 0x23, 0xa8, 0x8e, 0xb2, 0xe5, 0x49, 0x5d, 0x74,
-  0x68, 0xad, 0x96, 0xea, 0x3c, 0x35, 0x05, 0x19, 0xd8, 0x81, 0xd9, 0xdb,
-  0xf2, 0x3f, 0xf3, 0x70, 0xdc, 0x3b, 0x47, 0x71, 0xe2, 0xbe, 0x24, 0x80,
-  0x57, 0x19, 0x26, 0xce, 0x19, 0xb3, 0xb2, 0xaa, 0x67, 0x60, 0x07, 0x60,
-  0x4f, 0xef, 0xad, 0x56, 0xf5, 0x67, 0xb7, 0x9b, 0x79, 0x59, 0xa9, 0x20,
-  0x96, 0x6a, 0x67, 0x53, 0x97, 0x41, 0x9e, 0x53, 0xb7, 0xf6, 0xd4, 0x9d,
-  0x89, 0xde, 0x59, 0x51, 0x54, 0xd3, 0x4c, 0xea, 0xed, 0x77, 0xaa, 0xbb,
-  0xde, 0x95, 0x2c, 0xf5, 0x0f, 0x05, 0x33, 0x82, 0x12, 0x52, 0xbc, 0xbe,
-  0x29, 0x1f, 0x68, 0x82, 0x47, 0x6d, 0xb4, 0x47, 0xe9, 0x7a, 0x2f, 0xa8,
-  0x7d, 0x17, 0x59, 0x61, 0xe7, 0x2f, 0x25, 0x55, 0x69, 0x99, 0x9c, 0x9d,
-  0xfc, 0xb1, 0x90, 0x3f, 0x5d, 0x1e, 0xab, 0x82, 0x9a, 0x5b, 0xa5, 0xbd,
-  0x5d, 0x04, 0x68, 0xd2, 0x08, 0x41, 0x45, 0xd9, 0x39, 0xb6, 0xe8, 0x3e,
-  0x07, 0x43, 0xbf, 0xfa, 0x90, 0x31, 0x0a, 0x6b, 0x7d, 0xb2, 0x05, 0x0a,
-  0x94, 0xd4, 0xed, 0x28, 0x51, 0xdb, 0xcd, 0x8f, 0xd0, 0x6b, 0x93, 0xe1,
-  0x83, 0x21, 0x04, 0x80, 0x27, 0x9c, 0x02, 0xab, 0x45, 0x40, 0x85, 0x0f,
-  0x23, 0xb4, 0xde, 0x52, 0x3a, 0xed, 0x80, 0x3f, 0x53, 0xa7, 0xb5, 0xbb,
-  0x50, 0xd6, 0xd4, 0xd6, 0x52, 0xc6, 0xe0, 0xcb, 0x49, 0x21, 0x86, 0x74,
-  0x23, 0xbf, 0xae, 0x3b, 0x83, 0xac, 0xc7, 0x87, 0x6b, 0x55, 0xa2, 0xa2,
-  0x70, 0x70, 0x04, 0x9b, 0x8f, 0xff, 0x00, 0x9e, 0x87, 0x71, 0x1d, 0xde,
-  0xb6, 0xcb, 0xc6, 0xb7, 0x4b, 0x85, 0x19, 0x0d, 0x22, 0x54, 0xbf, 0x32,
-  0x1e, 0x92, 0x26, 0x77, 0x53, 0xf2, 0xfc, 0x35, 0xc1, 0x6d, 0xa4, 0xc9,
-  0x91, 0x7d, 0x2b, 0x70, 0xc8, 0xa4, 0xaa, 0x6b, 0xad, 0x12, 0x96, 0xa5,
-  0x90, 0xe2, 0x55, 0xea, 0x63, 0x6e, 0xdf, 0x2c, 0x69, 0x45, 0x5e, 0x9e,
-  0x0b, 0x78, 0x92, 0x66, 0x11, 0xa2, 0x8f, 0x99, 0xf8, 0x6b, 0x66, 0xa0,
-  0xb8, 0x50, 0xdf, 0xec, 0xe2, 0xaa, 0x9f, 0x12, 0x43, 0x30, 0x21, 0x91,
-  0xba, 0xa9, 0xee, 0xa7, 0xdc, 0x6b, 0x34, 0xe3, 0xbe, 0x15, 0xfe, 0x0e,
-  0xab, 0x5f, 0x4f, 0x19, 0x6a, 0x69, 0x7c, 0xb9, 0x66, 0x27, 0xc3, 0x39,
-  0x3d, 0x3d, 0x35, 0xd5, 0x53, 0xae, 0xe2, 0x3d, 0x5d, 0x7c, 0xd5, 0xf5,
-  0x1f, 0x57, 0x58, 0xda, 0x1a, 0x70, 0x37, 0x8c, 0x1f, 0x33, 0xff, 0x00,
-  0xb8, 0xfe, 0xda, 0x9a, 0xb2, 0x9a, 0xa2, 0x54, 0xa6, 0x74, 0x48, 0xdd,
-  0x50, 0xf8, 0x4b, 0x18, 0x18, 0x60, 0xa7, 0xf6, 0xfd, 0x35, 0x3d, 0xba,
-  0x9e, 0x33, 0x53, 0x23, 0xe0, 0x00, 0x10, 0x0c, 0x9f, 0x9e, 0x75, 0x15,
-  0x5d, 0x74, 0x32, 0x4a, 0x60, 0x85, 0x80, 0x40, 0x70, 0xf2, 0x63, 0x3b,
-  0x7f, 0xa4, 0x77, 0x3a, 0x22, 0x08, 0x2a, 0xd7, 0x2c, 0x96, 0xee, 0x22,
-  0x46, 0x4a, 0x47, 0x69, 0x23, 0x93, 0x22, 0x39, 0x18, 0xa9, 0x3f, 0x1d,
-  0x1d, 0xba, 0x99, 0x2b, 0x7c, 0x6a, 0xaa, 0xf9, 0x1a, 0x79, 0x9d, 0x39,
-  0x4a, 0x47, 0x90, 0x88, 0x99, 0xfb, 0x2a, 0x3d, 0x3f, 0x33, 0xa0, 0x97,
-  0xd8, 0x95, 0x6b, 0xa5, 0x92, 0x25, 0x95, 0x5b, 0x23, 0xc3, 0x0e, 0x48,
-  0x24, 0x60, 0x6e, 0x73, 0xbf, 0xbe, 0xa6, 0xb1, 0xdc, 0x56, 0x28, 0xa6,
-  0x5a, 0x99, 0xd7, 0x28, 0xb9, 0x19, 0xce, 0x73, 0xdf, 0x44, 0x7a, 0x41,
-  0x18, 0x68, 0x6e, 0xc9, 0xe3, 0xc4, 0xcf, 0x3a, 0xe3, 0x18, 0x5e, 0x6d,
-  0xd5, 0x7d, 0xf1, 0xd4, 0xfe, 0x3a, 0xb1, 0x78, 0xa9, 0xb1, 0xbd, 0xd2,
-  0x8e, 0x57, 0x91, 0x0c, 0x51, 0xa3, 0x33, 0x46, 0xbf, 0x78, 0xe4, 0x6d,
-  0xed, 0xeb, 0xa4, 0x2b, 0x85, 0x6c, 0x13, 0x00, 0xc8, 0xce, 0xa8, 0x49,
-  0x23, 0x90, 0x11, 0x9f, 0x9e, 0xab, 0xdb, 0xe7, 0x3f, 0x5e, 0x56, 0x6c,
-  0x95, 0x63, 0xbf, 0x31, 0xc9, 0xc6, 0xaa, 0xec, 0x72, 0x1b, 0x31, 0x16,
-  0x94, 0x10, 0x23, 0xfb, 0xbd, 0x2c, 0xf5, 0x2f, 0x24, 0x0a, 0x91, 0x53,
-  0x8d, 0xe3, 0x50, 0x7a, 0x69, 0x87, 0xe8, 0xea, 0xa6, 0xbc, 0xdd, 0xda,
-  0x46, 0xa5, 0xae, 0xa8, 0xb1, 0xd3, 0xc6, 0xff, 0x00, 0x58, 0x0b, 0x29,
-  0x48, 0x62, 0x6d, 0x8a, 0x92, 0x72, 0x07, 0x31, 0xe9, 0x8e, 0xa7, 0x38,
-  0xd2, 0x00, 0xaf, 0x57, 0x99, 0x52, 0x15, 0x01, 0x55, 0x3b, 0x0c, 0x69,
-  0xa3, 0x83, 0xaa, 0xae, 0x77, 0x4a, 0xfb, 0x5f, 0x0c, 0xc5, 0x72, 0xa6,
-  0xa7, 0xa5, 0x96, 0xb8, 0xd4, 0x72, 0xce, 0x07, 0x86, 0x8c, 0xaa, 0xc4,
-  0xb3, 0x11, 0x82, 0x57, 0x19, 0xca, 0xe7, 0x07, 0x53, 0x70, 0x7a, 0x76,
-  0x94, 0xc4, 0xc0, 0x36, 0xe6, 0xa7, 0xe8, 0x9f, 0xa3, 0xdf, 0xaa, 0xb4,
-  0xd5, 0x72, 0xd3, 0xaa, 0x00, 0xe8, 0x1b, 0x99, 0x7b, 0xee, 0x73, 0xd7,
-  0x7e, 0xc3, 0xaf, 0xa6, 0x9b, 0xfc, 0x24, 0x2d, 0xcc, 0xd9, 0x3b, 0xf7,
-  0x3a, 0x5a, 0xb0, 0xd0, 0x53, 0x58, 0xda, 0x35, 0x8e, 0xa9, 0xea, 0xe5,
-  0x9e, 0x16, 0x60, 0xd8, 0x00, 0x3e, 0x3c, 0xc4, 0x8c, 0x7a, 0xe7, 0x3a,
-  0x39, 0x34, 0xe5, 0xe8, 0x9a, 0x6a, 0x77, 0x56, 0xca, 0xf3, 0x29, 0xed,
-  0xac, 0xc4, 0x83, 0x29, 0x5b, 0xce, 0x2f, 0xd6, 0xe4, 0xb9, 0xda, 0xe6,
-  0xa4, 0x63, 0x86, 0x61, 0x94, 0x63, 0xf7, 0x58, 0x74, 0x3a, 0xc8, 0x38,
-  0xaf, 0x87, 0xeb, 0x23, 0x87, 0xc0, 0xaa, 0x81, 0xa1, 0x96, 0x36, 0xe7,
-  0x86, 0x4c, 0x79, 0x73, 0xf1, 0xf4, 0x3a, 0x71, 0x9b, 0x8e, 0x66, 0x88,
-  0x94, 0x4a, 0x55, 0x99, 0xd7, 0x62, 0x43, 0x61, 0x7f, 0x1e, 0xff, 0x00,
-  0x2d, 0x0b, 0xb8, 0x71, 0x95, 0xca, 0xaa, 0x33, 0x19, 0xa7, 0xa3, 0x54,
-  0x3d, 0x41, 0x42, 0xff, 0x00, 0xa9, 0xd4, 0xec, 0x73, 0x37, 0x69, 0xf1,
-  0xe6, 0x51, 0x40, 0x6d, 0x33, 0xda, 0xca, 0x0a, 0x2a, 0xb3, 0xff, 0x00,
-  0x57, 0x4e, 0x21, 0x99, 0x77, 0x32, 0x22, 0xee, 0x3f, 0xdc, 0xbd, 0xc7,
-  0xb8, 0xd3, 0x55, 0x93, 0x86, 0x78, 0x4a, 0xe9, 0x6a, 0x33, 0x55, 0xd3,
-  0x54, 0xd2, 0xd4, 0xc7, 0x9e, 0x66, 0xa5, 0x62, 0x63, 0x71, 0xfd, 0x4a,
-  0x0f, 0x4f, 0x86, 0x84, 0x5e, 0xde, 0x39, 0x63, 0xf1, 0xea, 0x65, 0x48,
-  0x8a, 0xee, 0x0a, 0xa0, 0x00, 0xfc, 0x87, 0x5d, 0x54, 0xa0, 0x96, 0xef,
-  0xf5, 0x59, 0x61, 0x8a, 0xeb, 0x2d, 0x04, 0x27, 0xab, 0xd3, 0x26, 0x09,
-  0x1f, 0xd3, 0x92, 0x7f, 0x1d, 0xb4, 0xca, 0xc4, 0x0e, 0x65, 0x35, 0x18,
-  0x8b, 0x55, 0x2e, 0xf2, 0x2b, 0xdf, 0x0b, 0xd8, 0x1a, 0xe8, 0xaf, 0x6d,
-  0xaf, 0xb9, 0x54, 0x10, 0x3c, 0xde, 0x28, 0x08, 0x0f, 0xb6, 0x7a, 0xeb,
-  0xc8, 0x2c, 0x34, 0x90, 0xb0, 0x74, 0xa5, 0x7a, 0x87, 0x1f, 0x66, 0x18,
-  0x50, 0xb0, 0xff, 0x00, 0x3f, 0x12, 0x74, 0x6f, 0x85, 0xed, 0x2e, 0x23,
-  0x9a, 0xba, 0xb6, 0xad, 0xa6, 0x8d, 0x18, 0x88, 0x9a, 0x7c, 0x12, 0x31,
-  0xf6, 0x89, 0xf9, 0xfe, 0xfa, 0xbb, 0x72, 0xb9, 0x2a, 0xd3, 0xa2, 0xd3,
-  0xd4, 0x87, 0x0f, 0xf7, 0x57, 0x2b, 0xc9, 0x8f, 0x50, 0x3a, 0xe7, 0x4e,
-  0xbd, 0x6f, 0xde, 0x67, 0x5c, 0x89, 0x84, 0x57, 0x4e, 0xf0, 0xff, 0x00,
-  0x00, 0xdb, 0x23, 0xb6, 0x50, 0x9a, 0xa9, 0xde, 0x2f, 0xae, 0x4e, 0x79,
-  0xa5, 0x3c, 0xcb, 0x85, 0x27, 0x60, 0xa3, 0xd9, 0x47, 0x7f, 0x5c, 0xe9,
-  0x86, 0xe8, 0xb0, 0x4f, 0x04, 0xec, 0x64, 0x8c, 0xbc, 0xb1, 0x95, 0x1b,
-  0x8d, 0xfd, 0x3f, 0x30, 0x34, 0x84, 0xd7, 0x8a, 0xc8, 0xac, 0x74, 0xcd,
-  0x15, 0x44, 0x91, 0x49, 0xce, 0xca, 0x39, 0x5c, 0x8d, 0x87, 0x5c, 0xfc,
-  0xf4, 0x5e, 0xcf, 0x5d, 0x51, 0x75, 0xa4, 0x78, 0x2a, 0xea, 0x27, 0x74,
-  0xa6, 0xa6, 0x69, 0x5c, 0xb0, 0x2a, 0x55, 0xb2, 0x39, 0x06, 0x7b, 0x9c,
-  0xee, 0x35, 0x52, 0xbd, 0x2a, 0x66, 0x42, 0xc5, 0x9a, 0xcc, 0xf2, 0xd3,
-  0x12, 0xcf, 0x72, 0xa6, 0x77, 0x1e, 0x54, 0x95, 0x00, 0xf8, 0xe7, 0x7f,
-  0xcb, 0xf5, 0xd2, 0x47, 0xd3, 0x35, 0x6a, 0xd7, 0x71, 0x4d, 0xcc, 0x06,
-  0x25, 0x21, 0x89, 0x69, 0xc7, 0xc7, 0x97, 0x27, 0xf3, 0xd3, 0xa4, 0xf3,
-  0xbd, 0xb6, 0x80, 0x55, 0x42, 0xa5, 0xa4, 0x84, 0x34, 0x99, 0x3b, 0xf4,
-  0x04, 0x92, 0x7e, 0x1d, 0x75, 0x9c, 0x5b, 0x69, 0xdf, 0x88, 0x78, 0x9e,
-  0x28, 0xea, 0xd8, 0x91, 0x3c, 0xc6, 0xa2, 0xa5, 0x86, 0xde, 0x5c, 0xf3,
-  0x1f, 0xc7, 0xca, 0x3e, 0x7a, 0x54, 0xdc, 0x54, 0x63, 0xcd, 0xca, 0x96,
-  0xda, 0x8f, 0xab, 0xc4, 0x23, 0x0f, 0xf6, 0x77, 0x07, 0xdf, 0xfe, 0x0d,
-  0x58, 0xe3, 0x07, 0x13, 0xdd, 0x12, 0xe0, 0xa4, 0x14, 0xac, 0x85, 0x64,
-  0xc8, 0xfe, 0xac, 0x61, 0xbf, 0x4d, 0x2e, 0x1a, 0x87, 0x69, 0xdb, 0x93,
-  0xec, 0x28, 0xc6, 0x8a, 0x51, 0xcd, 0xf5, 0xcb, 0x73, 0xd1, 0xb6, 0xf2,
-  0x44, 0x4c, 0x90, 0xfb, 0x8f, 0xbc, 0xbf, 0xbe, 0xae, 0x06, 0xf7, 0x20,
-  0x4c, 0xaf, 0x62, 0xbe, 0x4f, 0xc3, 0x17, 0x23, 0x3c, 0x6a, 0x64, 0xa1,
-  0x9f, 0x0b, 0x3c, 0x63, 0xb7, 0xfa, 0x87, 0xb8, 0xff, 0x00, 0x1a, 0x7e,
-  0xbd, 0x57, 0x52, 0x5c, 0xac, 0x71, 0xb0, 0x71, 0x35, 0x34, 0xab, 0xb1,
-  0x1b, 0x86, 0x1a, 0xcd, 0xe6, 0x54, 0x92, 0x16, 0x8d, 0xd7, 0x2a, 0xc3,
-  0x04, 0x6b, 0xae, 0x13, 0xbd, 0x8b, 0x3c, 0xf3, 0x5a, 0x6e, 0x27, 0x9a,
-  0x82, 0xa3, 0xec, 0xc8, 0x7f, 0xf4, 0x89, 0xfb, 0xc3, 0xdb, 0xd7, 0x5c,
-  0xcb, 0xde, 0x05, 0x34, 0x62, 0xed, 0xfe, 0x9a, 0x6a, 0x1b, 0x80, 0x44,
-  0x69, 0x0d, 0x1c, 0x99, 0xe5, 0x3d, 0x01, 0xf6, 0x3a, 0x1e, 0x0f, 0xf3,
-  0xcc, 0x81, 0x40, 0x2f, 0xdb, 0xd0, 0x76, 0x1a, 0xd3, 0xeb, 0x62, 0xb2,
-  0xc1, 0x41, 0x3c, 0x17, 0x46, 0x41, 0x46, 0xfb, 0x89, 0x19, 0x86, 0xde,
-  0xeb, 0xac, 0x96, 0xb2, 0xbe, 0x96, 0x2a, 0x99, 0x29, 0xa9, 0xaa, 0x4c,
-  0xb4, 0xea, 0x4f, 0x2c, 0xe1, 0x48, 0x2c, 0x33, 0xb7, 0xe5, 0xa5, 0x55,
-  0xb3, 0x51, 0x98, 0x81, 0xbc, 0x2c, 0x6b, 0xd2, 0x69, 0x21, 0xa6, 0x6a,
-  0x31, 0x5d, 0x2c, 0x6a, 0x42, 0x8c, 0x79, 0x97, 0xb8, 0xdf, 0xbf, 0x4e,
-  0xfa, 0xa5, 0x53, 0x6a, 0xae, 0xa8, 0xbb, 0xc7, 0x01, 0x8e, 0x1a, 0x69,
-  0x17, 0x02, 0x49, 0x22, 0x18, 0x03, 0x3b, 0xef, 0xea, 0x4e, 0x75, 0x0d,
-  0xa6, 0xe5, 0xfc, 0x3d, 0xda, 0xa6, 0x05, 0x47, 0x63, 0xf7, 0x98, 0xf4,
-  0xf9, 0x77, 0xd5, 0x8a, 0xee, 0x22, 0xf1, 0xb9, 0xbc, 0x04, 0x51, 0xcf,
-  0xff, 0x00, 0x75, 0x8f, 0x57, 0xf5, 0xc6, 0xad, 0x48, 0x9e, 0xa6, 0x4e,
-  0xcb, 0x73, 0x07, 0xce, 0x88, 0x95, 0x75, 0x36, 0x85, 0x94, 0xb4, 0x6a,
-  0xc4, 0xc6, 0xee, 0x46, 0xd2, 0x01, 0xbe, 0xfe, 0xf8, 0x23, 0xf0, 0xd5,
-  0x4a, 0x25, 0x3c, 0xed, 0x28, 0xe9, 0xf6, 0x46, 0xbd, 0x86, 0x17, 0xad,
-  0xa9, 0x22, 0x18, 0x98, 0x29, 0x3e, 0x99, 0xd1, 0x98, 0x6d, 0x15, 0x05,
-  0x40, 0xe4, 0x11, 0xaf, 0xb9, 0xe9, 0xa0, 0x4d, 0xef, 0x14, 0x6d, 0x3d,
-  0xa6, 0x45, 0x8e, 0x04, 0x6c, 0x79, 0xc8, 0xc9, 0x3a, 0xd0, 0xbe, 0x88,
-  0x5a, 0xef, 0x35, 0xf8, 0xd3, 0xd1, 0xa4, 0xb3, 0xd2, 0xd1, 0xc2, 0xd3,
-  0xcd, 0x14, 0x71, 0x23, 0x30, 0x79, 0x3c, 0xa0, 0xa9, 0x23, 0x98, 0x1e,
-  0xfb, 0x11, 0xd0, 0x1e, 0xda, 0x48, 0x10, 0x08, 0x95, 0xa4, 0x90, 0xff,
-  0x00, 0x2a, 0x25, 0x19, 0x3e, 0xba, 0x7e, 0xfa, 0x05, 0xe2, 0x5a, 0x7b,
-  0x4d, 0xe6, 0xaa, 0xdf, 0x5c, 0x89, 0x1f, 0xf1, 0x56, 0x52, 0x93, 0xf4,
-  0x2a, 0xeb, 0x90, 0xa8, 0x4f, 0xa1, 0xc9, 0xf9, 0xe3, 0xd7, 0x53, 0xca,
-  0x2d, 0x0c, 0xae, 0x26, 0xe9, 0x60, 0x66, 0xe5, 0x79, 0xad, 0x8a, 0x92,
-  0xb2, 0x85, 0xa9, 0xe1, 0x68, 0x0d, 0x27, 0x97, 0xc0, 0x65, 0xe5, 0x2a,
-  0xbd, 0x80, 0xf5, 0x18, 0xef, 0xa2, 0x69, 0x34, 0x42, 0x17, 0x9a, 0x91,
-  0xd6, 0x6a, 0x49, 0xc1, 0x2f, 0x08, 0x61, 0xcc, 0x84, 0xf5, 0x20, 0x77,
-  0xf8, 0x6a, 0x3b, 0x65, 0x82, 0x83, 0xf8, 0x50, 0x86, 0x56, 0x9a, 0xa1,
-  0x5c, 0xf3, 0x86, 0x91, 0xbc, 0xc8, 0x71, 0x8d, 0x88, 0xf8, 0x64, 0xfa,
-  0x9d, 0xce, 0xa8, 0xd5, 0x70, 0xa4, 0xa8, 0x4b, 0x51, 0xd4, 0x2b, 0x8e,
-  0xcb, 0x26, 0xc7, 0xf1, 0x1a, 0xc8, 0x07, 0x9c, 0xd2, 0x48, 0xe2, 0x24,
-  0x5e, 0x29, 0xd2, 0x9a, 0xb0, 0xa4, 0x6c, 0x0c, 0x6d, 0xb8, 0xc7, 0x4e,
-  0xbd, 0xbf, 0xb6, 0x81, 0xdc, 0x2e, 0x1e, 0x1c, 0xa6, 0x96, 0x95, 0x3c,
-  0x7a, 0x92, 0x3a, 0x0e, 0x88, 0x3d, 0x5b, 0xfb, 0x69, 0xce, 0xe3, 0x4a,
-  0x69, 0xa6, 0x30, 0x55, 0xc6, 0xc1, 0xbb, 0x8c, 0x86, 0x1a, 0x01, 0x55,
-  0x47, 0x22, 0xcc, 0xff, 0x00, 0x52, 0xa6, 0x8c, 0x03, 0xb0, 0x24, 0x85,
-  0x00, 0x7a, 0x9c, 0x6f, 0xeb, 0xa5, 0x09, 0x3d, 0x0c, 0x5a, 0xab, 0x1d,
-  0x2d, 0xb7, 0xac, 0x05, 0x15, 0xb9, 0xa4, 0x94, 0x54, 0xdc, 0x66, 0xe7,
-  0x23, 0x7e, 0x52, 0x70, 0x3e, 0x7f, 0xdb, 0x52, 0x25, 0x6c, 0x75, 0xb5,
-  0xab, 0x47, 0x43, 0x89, 0x08, 0xdd, 0xa4, 0xff, 0x00, 0xd3, 0x8c, 0x7a,
-  0xfb, 0xfb, 0x01, 0xab, 0x75, 0x9c, 0x2f, 0x57, 0x5a, 0x01, 0xaa, 0xba,
-  0x72, 0x8f, 0xe8, 0x31, 0xe1, 0x07, 0xcb, 0x39, 0x3a, 0x37, 0xc3, 0xd6,
-  0x4a, 0x7b, 0x5d, 0x20, 0x8a, 0x21, 0xe2, 0xc8, 0x4e, 0x5e, 0x42, 0xbc,
-  0xa1, 0x8f, 0xc3, 0xae, 0x3d, 0xb4, 0xdd, 0x1e, 0x71, 0x5f, 0x54, 0x00,
-  0xf7, 0x27, 0x5c, 0xb0, 0xa5, 0x19, 0xa4, 0x4a, 0x7a, 0x81, 0x02, 0x46,
-  0x3c, 0xf8, 0x1c, 0xce, 0x7f, 0x6f, 0x53, 0xa0, 0xc2, 0x3e, 0x6f, 0xe5,
-  0x46, 0xc9, 0x99, 0x0e, 0xe5, 0xba, 0x0f, 0x9f, 0x6d, 0x13, 0xb9, 0x4d,
-  0x4e, 0xf5, 0x92, 0x09, 0xde, 0x85, 0x99, 0x0f, 0x20, 0xf1, 0x19, 0xb2,
-  0x07, 0xa6, 0x06, 0xc3, 0x43, 0x68, 0x1d, 0x69, 0xeb, 0x9d, 0xd5, 0xd1,
-  0xe3, 0x45, 0x2c, 0x4a, 0xe7, 0x18, 0x1e, 0x9f, 0x3c, 0x0d, 0x69, 0x45,
-  0xa1, 0x3c, 0xc6, 0x6b, 0x32, 0x6b, 0x9c, 0x26, 0x16, 0x82, 0x9e, 0x4d,
-  0x91, 0x22, 0xc2, 0x95, 0x39, 0x04, 0xfd, 0xef, 0xcf, 0x46, 0xf8, 0x76,
-  0xaa, 0xa2, 0x4e, 0x19, 0x1e, 0x2b, 0xbb, 0x0a, 0xa9, 0xcf, 0x85, 0xcd,
-  0x8c, 0xf8, 0x51, 0x9e, 0x51, 0xf1, 0xcb, 0x67, 0xe4, 0x06, 0x82, 0x40,
-  0x92, 0xdc, 0xa8, 0x23, 0x8d, 0x0e, 0x66, 0x4a, 0x8e, 0x5c, 0xff, 0x00,
-  0xbc, 0xff, 0x00, 0x7d, 0x35, 0x52, 0xc5, 0x0c, 0x55, 0x09, 0x4f, 0x00,
-  0xff, 0x00, 0xa7, 0xa3, 0x8d, 0x62, 0x8f, 0xe0, 0xa3, 0x1f, 0x99, 0xc9,
-  0xf9, 0xe9, 0x32, 0x9d, 0xaa, 0x36, 0x3e, 0x62, 0xdf, 0xd2, 0x25, 0x53,
-  0xd3, 0x5b, 0x63, 0xa5, 0x47, 0x2b, 0xe3, 0x12, 0xb2, 0x63, 0xfa, 0x00,
-  0xcb, 0x0f, 0xd0, 0x68, 0x0f, 0x08, 0xbc, 0xf6, 0xca, 0xd8, 0x6e, 0x13,
-  0xa3, 0x24, 0x73, 0x32, 0xbb, 0x0c, 0x7d, 0xa4, 0xce, 0xdd, 0x7d, 0xf7,
-  0xf9, 0x6a, 0xef, 0x1e, 0x78, 0xd5, 0xf7, 0xb8, 0x28, 0xa2, 0x46, 0x93,
-  0xc3, 0x8c, 0xcb, 0x2e, 0x07, 0x41, 0x9d, 0xf3, 0xf8, 0x68, 0xbd, 0xf2,
-  0x8e, 0x95, 0x6c, 0xb4, 0x95, 0x34, 0x8b, 0xcb, 0x0a, 0xa7, 0x2b, 0x77,
-  0xea, 0x36, 0x27, 0xe7, 0xb6, 0x8e, 0x21, 0xb4, 0x2e, 0x7b, 0x4c, 0xae,
-  0x9e, 0x21, 0x05, 0x21, 0x90, 0xa8, 0x2e, 0x0e, 0xe3, 0xe3, 0xb6, 0x35,
-  0x04, 0x6f, 0x2c, 0x0e, 0xb2, 0xae, 0x54, 0xe7, 0x2a, 0xda, 0xb3, 0x28,
-  0x32, 0x4c, 0xb0, 0x21, 0xe8, 0x7c, 0xdf, 0x1d, 0x5a, 0xa9, 0x11, 0x25,
-  0x2f, 0x82, 0xe0, 0x30, 0x3b, 0x0f, 0xef, 0xab, 0x03, 0x22, 0x45, 0xca,
-  0x15, 0x53, 0xa4, 0xad, 0xe2, 0x81, 0xca, 0x4f, 0xda, 0x5e, 0xd9, 0xf5,
-  0x1a, 0x1d, 0x5b, 0x14, 0x75, 0x31, 0x95, 0x39, 0xcf, 0xdd, 0x6f, 0x4d,
-  0x5f, 0x9e, 0x8e, 0x78, 0xa2, 0xf1, 0x0a, 0x96, 0x8c, 0x7d, 0xe1, 0xdb,
-  0xe3, 0xaa, 0x4e, 0x01, 0x07, 0x07, 0x1e, 0xe3, 0x4f, 0x27, 0x15, 0xae,
-  0xf4, 0x73, 0x4a, 0x42, 0x4e, 0x64, 0x70, 0x83, 0x0b, 0xe6, 0x24, 0x01,
-  0xed, 0xaa, 0x10, 0x51, 0x78, 0x6a, 0xe4, 0x92, 0x4a, 0x90, 0x46, 0xda,
-  0x69, 0xaa, 0x8d, 0xf7, 0x20, 0x83, 0xaa, 0x09, 0x33, 0xd3, 0x48, 0xce,
-  0x15, 0x79, 0xb0, 0x40, 0x24, 0x67, 0x1e, 0xfa, 0x0b, 0xee, 0x9b, 0x8a,
-  0x45, 0xc0, 0xb5, 0xb4, 0xf1, 0xbd, 0x3c, 0x02, 0x2c, 0x23, 0x95, 0xcc,
-  0x83, 0xae, 0xf9, 0x3f, 0x9e, 0xa4, 0xb6, 0xda, 0xcc, 0xd2, 0x60, 0x65,
-  0x87, 0x72, 0x76, 0x03, 0x57, 0xa3, 0xa7, 0x8e, 0x69, 0x39, 0xcf, 0x5e,
-  0xa4, 0x7a, 0xe8, 0xc5, 0x27, 0x24, 0x63, 0x94, 0x00, 0xb8, 0xe9, 0xe9,
-  0xa5, 0x10, 0xce, 0x68, 0x68, 0x56, 0x8b, 0x0e, 0x07, 0x31, 0xe8, 0x47,
-  0xa0, 0xf6, 0xd1, 0x03, 0x86, 0x8c, 0xc8, 0x5b, 0x92, 0x25, 0x19, 0x67,
-  0x27, 0x60, 0x35, 0x56, 0xa6, 0xe1, 0x45, 0x0a, 0x79, 0x9c, 0xcd, 0x20,
-  0xfb, 0xa9, 0xd3, 0xe6, 0x75, 0x1a, 0x51, 0x57, 0xdd, 0x22, 0x59, 0x66,
-  0x06, 0x0a, 0x3e, 0x7f, 0xe5, 0xc4, 0xbd, 0x58, 0xfb, 0x7b, 0x7b, 0xe9,
-  0xa1, 0x12, 0xad, 0x4c, 0xc6, 0xe0, 0xfc, 0xb1, 0x2b, 0x2d, 0x1c, 0x4d,
-  0x81, 0x9e, 0xb2, 0x37, 0xa9, 0xd5, 0x94, 0xc4, 0x5e, 0x1c, 0x8b, 0x9c,
-  0xc4, 0xc1, 0xc6, 0xf8, 0xe8, 0x73, 0xfb, 0x6a, 0xd5, 0x55, 0x3c, 0x70,
-  0xb8, 0x82, 0x30, 0x02, 0x42, 0x3b, 0x7a, 0xf7, 0xfc, 0xf6, 0xf9, 0x6a,
-  0xab, 0x2f, 0x33, 0x05, 0x3f, 0x64, 0x6e, 0x7f, 0x6d, 0x1a, 0xda, 0x74,
-  0xfd, 0x45, 0xc1, 0x7f, 0x49, 0x1c, 0x23, 0xc4, 0x14, 0xf1, 0x43, 0x4f,
-  0x71, 0x4a, 0x3a, 0xbc, 0x00, 0x69, 0x6a, 0xc8, 0x8d, 0xf3, 0xec, 0x4f,
-  0x95, 0xbe, 0x47, 0x4d, 0x75, 0xf3, 0x98, 0x68, 0xa5, 0x99, 0x06, 0x4a,
-  0xa1, 0x23, 0xdf, 0x5f, 0x8b, 0x26, 0xa6, 0x1c, 0xdb, 0x1f, 0xb4, 0x7a,
-  0x63, 0x4c, 0x9c, 0x39, 0x53, 0xc5, 0x31, 0x51, 0xca, 0x96, 0xcb, 0xad,
-  0xda, 0x2a, 0x48, 0x94, 0x97, 0x11, 0xd4, 0x38, 0x8d, 0x7e, 0x5d, 0x06,
-  0xb3, 0xb6, 0x0b, 0xe0, 0xca, 0x2e, 0x4f, 0x39, 0xb4, 0xd4, 0x3b, 0x4f,
-  0x2b, 0x4b, 0x33, 0x33, 0x16, 0x39, 0x27, 0x1d, 0x75, 0x55, 0xea, 0xa8,
-  0xa3, 0x27, 0xc4, 0x91, 0x15, 0x47, 0xf5, 0xca, 0x17, 0x7f, 0xc7, 0x58,
-  0x9b, 0x55, 0x57, 0x54, 0xe0, 0xd5, 0xd6, 0x55, 0x4e, 0xdd, 0xfc, 0x49,
-  0x98, 0xfe, 0xfa, 0x27, 0x63, 0xe1, 0xfb, 0x8d, 0x64, 0x32, 0xd5, 0xc7,
-  0x6e, 0x95, 0xa9, 0x83, 0x1f, 0xe7, 0x34, 0x47, 0x97, 0x6f, 0x43, 0x8d,
-  0x30, 0xd3, 0xd0, 0xe6, 0x1f, 0x6b, 0x7d, 0xa6, 0x91, 0x59, 0xc5, 0xfc,
-  0x39, 0x42, 0x48, 0x35, 0x91, 0xcb, 0x20, 0xfb, 0x94, 0xe3, 0xc4, 0x63,
-  0xf8, 0x6d, 0xf9, 0xe8, 0x45, 0x1f, 0x1b, 0x56, 0x5d, 0xf8, 0x86, 0x92,
-  0xdf, 0x6f, 0xa4, 0x8e, 0x9a, 0x9e, 0x67, 0x64, 0xe6, 0x9d, 0xb2, 0xce,
-  0x40, 0x38, 0x1b, 0x6c, 0xbd, 0x3d, 0xf4, 0x87, 0x35, 0x32, 0xc5, 0x52,
-  0xeb, 0xca, 0xa3, 0x0d, 0xbe, 0x06, 0xdd, 0x35, 0xf4, 0x75, 0x12, 0x51,
-  0xba, 0xd5, 0xd3, 0x9e, 0x59, 0xa9, 0xaa, 0x16, 0x54, 0x3e, 0x84, 0x1c,
-  0xe9, 0xd7, 0x02, 0x8d, 0xe2, 0x9c, 0x86, 0x6d, 0x09, 0x6c, 0xb9, 0x9d,
-  0xfc, 0x6b, 0x64, 0x44, 0xef, 0xe5, 0x8b, 0x3f, 0xb6, 0xbe, 0x92, 0xdf,
-  0x4f, 0x41, 0x56, 0x6b, 0xaf, 0x55, 0x94, 0x66, 0x9f, 0x62, 0xc1, 0xfc,
-  0x88, 0x71, 0x9c, 0x2e, 0x4f, 0xc8, 0xfc, 0xb4, 0x6a, 0xcb, 0x72, 0x86,
-  0xed, 0x69, 0xa6, 0xb9, 0x52, 0x80, 0x12, 0xa2, 0x25, 0x70, 0x07, 0x63,
-  0xdc, 0x7c, 0x8e, 0x46, 0xb1, 0xbf, 0xa4, 0x8a, 0xba, 0xeb, 0xc7, 0x19,
-  0xd6, 0x52, 0xcb, 0x30, 0xf0, 0xa9, 0x9b, 0xc2, 0xa5, 0x88, 0x9c, 0x2e,
-  0x00, 0xdc, 0xfa, 0x73, 0x12, 0x73, 0x9f, 0x86, 0x80, 0xbb, 0xa8, 0x49,
-  0x9a, 0xa5, 0xb2, 0xe1, 0x62, 0xa8, 0x8a, 0x49, 0x2d, 0x32, 0x5b, 0xaa,
-  0x0d, 0x3a, 0xe4, 0xb4, 0x0a, 0x79, 0x91, 0x8f, 0x4d, 0xfa, 0x75, 0xcf,
-  0xe1, 0xab, 0x14, 0x20, 0x47, 0x4a, 0xce, 0x7a, 0x9d, 0x64, 0xdc, 0x1f,
-  0x7a, 0x9f, 0x87, 0x8c, 0xd4, 0x15, 0xf4, 0xf2, 0x2c, 0x12, 0xb8, 0x91,
-  0xd7, 0x93, 0x12, 0x2b, 0x63, 0x19, 0xdf, 0xa8, 0xc6, 0x9c, 0x6e, 0x7c,
-  0x75, 0xc3, 0xf4, 0xf6, 0xa7, 0x78, 0x6a, 0xcc, 0xb2, 0x05, 0xf2, 0xc4,
-  0xb1, 0x9e, 0x62, 0x7b, 0x7c, 0x35, 0x9f, 0x22, 0x35, 0xca, 0xa3, 0x00,
-  0x21, 0x7e, 0x1f, 0x9a, 0x28, 0x78, 0x9a, 0xa5, 0x2a, 0xa2, 0x01, 0xab,
-  0x91, 0x44, 0x4e, 0xc3, 0xee, 0x8c, 0xe0, 0x7c, 0x0e, 0xff, 0x00, 0x3d,
-  0x45, 0x74, 0xa0, 0x10, 0x4c, 0x6d, 0x6d, 0x2b, 0x88, 0xe5, 0x93, 0x9a,
-  0x9c, 0x33, 0x10, 0xa0, 0x1d, 0xcf, 0x4e, 0xb8, 0x3f, 0xf3, 0xd5, 0x2b,
-  0x86, 0x78, 0xc2, 0x7e, 0x25, 0x89, 0x28, 0x6e, 0x31, 0x24, 0x37, 0x6a,
-  0x48, 0xf9, 0xa9, 0xe4, 0x89, 0x70, 0x26, 0x8d, 0x77, 0x2a, 0x47, 0x66,
-  0x5e, 0xbe, 0xe3, 0x3d, 0xf4, 0xf1, 0xc4, 0x35, 0x91, 0xd5, 0x70, 0x9c,
-  0x75, 0x75, 0x58, 0x49, 0xf9, 0x43, 0x28, 0xef, 0x9e, 0x9f, 0x9f, 0xef,
-  0xed, 0xab, 0x57, 0x4c, 0x40, 0x7a, 0xa6, 0x55, 0x43, 0x08, 0x40, 0xd2,
-  0x93, 0x9e, 0x6e, 0x84, 0xfa, 0x6a, 0x20, 0x4d, 0x4d, 0x67, 0x43, 0xca,
-  0x0f, 0xe5, 0xab, 0xb5, 0x58, 0x10, 0x78, 0x69, 0x80, 0x5b, 0x6d, 0xbd,
-  0x35, 0xc4, 0x31, 0x0a, 0x48, 0xd9, 0x9f, 0xa9, 0x5f, 0x4e, 0xfa, 0x71,
-  0x04, 0x9e, 0x9a, 0x72, 0x2e, 0x0b, 0x4e, 0x3a, 0x32, 0x90, 0x77, 0xd1,
-  0x0e, 0x20, 0xb1, 0x5b, 0xea, 0xa8, 0x68, 0x6b, 0xa9, 0xe3, 0x14, 0xcf,
-  0x2c, 0x45, 0x25, 0x31, 0x8c, 0x03, 0x22, 0x9c, 0x12, 0x47, 0x4d, 0xc1,
-  0x07, 0x41, 0x68, 0xb1, 0x83, 0x50, 0xfd, 0x50, 0x9d, 0xff, 0x00, 0x3d,
-  0x3a, 0xd8, 0x6a, 0xd4, 0x5b, 0x5c, 0x9c, 0x11, 0x0b, 0xac, 0xcb, 0x90,
-  0x0e, 0xcc, 0x39, 0x5b, 0xae, 0xde, 0x9a, 0x31, 0x66, 0x71, 0x5f, 0xc3,
-  0x37, 0x17, 0xda, 0x9a, 0x68, 0x65, 0xc9, 0xd8, 0x1c, 0xa9, 0xfe, 0xda,
-  0x19, 0x53, 0xc1, 0xfc, 0x48, 0x17, 0x2b, 0x4c, 0x8e, 0xbb, 0xee, 0x93,
-  0xa1, 0x1b, 0x75, 0xdf, 0x3a, 0xd1, 0xa7, 0x09, 0xe3, 0xc9, 0xe1, 0xfd,
-  0x8e, 0x62, 0x57, 0xe1, 0xa2, 0x54, 0x26, 0xba, 0x3a, 0x76, 0xa8, 0x89,
-  0x69, 0x4a, 0xbb, 0x05, 0x22, 0x4c, 0x65, 0x77, 0xc6, 0xc3, 0xb0, 0xd1,
-  0x30, 0x74, 0xcc, 0x9e, 0x9b, 0x82, 0xb8, 0x95, 0x27, 0x11, 0xcd, 0x4f,
-  0x14, 0x04, 0xa8, 0x7f, 0xe6, 0xd4, 0x22, 0x82, 0xa7, 0x7c, 0xe4, 0x1f,
-  0x4d, 0x4c, 0xdc, 0x23, 0x56, 0x8f, 0x8a, 0x9a, 0xd8, 0x14, 0x6f, 0x93,
-  0x19, 0x2f, 0xd3, 0xe3, 0x8d, 0x6b, 0x4d, 0x4b, 0x79, 0x7a, 0xc1, 0x55,
-  0x50, 0x29, 0xea, 0x64, 0x03, 0x94, 0x73, 0x38, 0xc0, 0x1d, 0x36, 0x1a,
-  0x5a, 0xe3, 0x8a, 0x5a, 0x9b, 0x7d, 0x6d, 0x24, 0xd3, 0xa2, 0x21, 0xae,
-  0x8c, 0x4a, 0x15, 0x06, 0x00, 0x20, 0xe0, 0x8f, 0xc0, 0x03, 0xf3, 0xd2,
-  0xf5, 0x00, 0x6a, 0x70, 0x58, 0xad, 0x5d, 0x64, 0xa1, 0xb5, 0xd0, 0x01,
-  0x12, 0x19, 0xaa, 0x65, 0x60, 0x82, 0x49, 0x37, 0x3f, 0x21, 0xd0, 0x68,
-  0xcd, 0x3c, 0x31, 0x47, 0x4a, 0x92, 0xe7, 0x22, 0x18, 0xce, 0x3e, 0x3e,
-  0xba, 0xa9, 0xc4, 0x92, 0x72, 0xcf, 0x0e, 0x7a, 0x47, 0x19, 0x7f, 0x9f,
-  0x41, 0xa9, 0x61, 0x7e, 0x7b, 0x22, 0x47, 0xdd, 0x94, 0x03, 0xbf, 0xb6,
-  0x4e, 0x9a, 0x70, 0x80, 0x27, 0x53, 0xf5, 0x59, 0x25, 0x63, 0xbc, 0x8f,
-  0x81, 0xf0, 0xd4, 0x14, 0x31, 0x24, 0xb5, 0x01, 0x1d, 0xf9, 0x15, 0xe4,
-  0x0a, 0x5b, 0xd0, 0x6c, 0x33, 0xab, 0x17, 0x36, 0x01, 0x96, 0x04, 0xe9,
-  0x1e, 0x06, 0xaa, 0xd3, 0xe4, 0xc6, 0x48, 0xee, 0xc7, 0xf5, 0xd3, 0x08,
-  0xa6, 0x36, 0xd6, 0x58, 0xf8, 0x7a, 0x9e, 0x65, 0xa4, 0xad, 0xad, 0xae,
-  0xb7, 0x54, 0x27, 0x79, 0xa9, 0x4b, 0x24, 0x83, 0xb3, 0x2b, 0x21, 0x39,
-  0x07, 0xd7, 0x1a, 0x21, 0xe3, 0x5b, 0xec, 0x53, 0x70, 0xfd, 0x3d, 0x1d,
-  0xd6, 0x96, 0xb6, 0x23, 0x24, 0xcd, 0x58, 0xf1, 0x3e, 0x63, 0xf0, 0xa5,
-  0x65, 0x42, 0x1b, 0x23, 0x63, 0xca, 0x09, 0xc1, 0xdc, 0x6d, 0xaf, 0xbe,
-  0x8e, 0xaf, 0xde, 0x34, 0xcb, 0x63, 0xbb, 0xd2, 0xc3, 0x73, 0xa4, 0x7d,
-  0xe3, 0xa6, 0xa8, 0xc7, 0x9c, 0xf7, 0x55, 0x63, 0xf6, 0x58, 0xf6, 0x23,
-  0x1b, 0xf5, 0xf5, 0xd4, 0x5c, 0x31, 0x53, 0x62, 0x82, 0x5a, 0xbb, 0x3d,
-  0x7d, 0xae, 0x9b, 0xeb, 0x35, 0x95, 0x68, 0x82, 0xbe, 0x57, 0x25, 0x68,
-  0xe0, 0xe6, 0xf3, 0xaf, 0x2b, 0x7d, 0x96, 0xd8, 0x2f, 0x31, 0xdc, 0x64,
-  0xe7, 0xa6, 0xbc, 0xad, 0x5e, 0x4c, 0xa8, 0x42, 0x13, 0xb1, 0xfd, 0xa7,
-  0xd3, 0x78, 0x5e, 0x0d, 0x36, 0x55, 0x39, 0x55, 0x0d, 0xa8, 0xa2, 0x2c,
-  0x11, 0xb8, 0xa2, 0x77, 0xdf, 0xef, 0xf5, 0x97, 0x26, 0xb3, 0xd9, 0x6c,
-  0xf6, 0x2a, 0xab, 0xf5, 0x2d, 0xc2, 0xd7, 0x71, 0x9d, 0x67, 0xe4, 0x82,
-  0x3a, 0x87, 0x3e, 0x61, 0xcc, 0x46, 0x52, 0x21, 0xe6, 0x6c, 0x7a, 0xbf,
-  0x28, 0xdb, 0x3b, 0xed, 0x9a, 0xff, 0x00, 0xf9, 0xc5, 0x2a, 0xc7, 0x7e,
-  0xba, 0x49, 0x56, 0xf5, 0xf3, 0xa0, 0x34, 0xf0, 0x83, 0xe1, 0xa2, 0x44,
-  0xca, 0x40, 0x62, 0xa3, 0x6e, 0x52, 0x3a, 0x20, 0xc0, 0xc6, 0xe7, 0x4d,
-  0x57, 0xbe, 0x16, 0xa2, 0xe2, 0x9e, 0x31, 0xa9, 0x9a, 0xaa, 0xe9, 0x49,
-  0x0c, 0xef, 0x4c, 0x0c, 0x74, 0x96, 0xf8, 0x0b, 0xd5, 0x39, 0xe4, 0xe6,
-  0xe7, 0x75, 0x6c, 0x06, 0x1b, 0xe3, 0x39, 0xdf, 0x00, 0x02, 0x0e, 0x81,
-  0xd1, 0x1a, 0xeb, 0x05, 0x23, 0x52, 0x55, 0xde, 0x45, 0x5d, 0x33, 0xf3,
-  0xa4, 0x54, 0x2f, 0x4c, 0xdc, 0xc8, 0xeb, 0xd7, 0x98, 0x4a, 0x01, 0x88,
-  0x8c, 0x83, 0x81, 0x9c, 0xe8, 0x2b, 0x3e, 0x4c, 0xe3, 0xda, 0x0b, 0x03,
-  0xf6, 0xef, 0x50, 0xb2, 0xe1, 0xc1, 0xa2, 0x6f, 0x62, 0xc0, 0x31, 0xa2,
-  0x6c, 0x6f, 0x47, 0xb0, 0x35, 0xf9, 0xe9, 0x14, 0x6b, 0x57, 0x96, 0xa9,
-  0x93, 0x1e, 0x6f, 0x0d, 0x5b, 0xf3, 0x23, 0x55, 0x5a, 0x3c, 0xcb, 0x24,
-  0x4d, 0x90, 0xb2, 0x20, 0x20, 0xfb, 0x8d, 0x12, 0xb9, 0xc7, 0x9a, 0x84,
-  0xa9, 0x20, 0x93, 0x82, 0xaf, 0xf0, 0x3d, 0xfe, 0x5a, 0x89, 0x63, 0x59,
-  0x22, 0x2a, 0xdb, 0x10, 0x76, 0x23, 0xa8, 0x3a, 0xf6, 0x07, 0x13, 0xe6,
-  0x23, 0x67, 0xd0, 0xd5, 0xe2, 0x58, 0x2a, 0xaa, 0x38, 0x6a, 0xaa, 0x5c,
-  0x2c, 0xaa, 0xd2, 0xd2, 0x31, 0xec, 0xdf, 0x78, 0x0f, 0x96, 0xff, 0x00,
-  0x10, 0x75, 0x6f, 0x83, 0x2d, 0x36, 0x8e, 0x21, 0x89, 0x6d, 0x97, 0x46,
-  0x36, 0xfe, 0x20, 0xb6, 0xb9, 0xa7, 0x79, 0x1b, 0xfe, 0xdd, 0x42, 0x29,
-  0x38, 0x0f, 0xe8, 0x47, 0x40, 0xde, 0x98, 0xeb, 0xa4, 0x9a, 0x01, 0x58,
-  0xb7, 0x4a, 0x67, 0xa2, 0x46, 0x6a, 0xd8, 0x65, 0x0f, 0x08, 0x41, 0x93,
-  0xcc, 0x3f, 0x6f, 0x5f, 0x6c, 0xe9, 0xab, 0xe9, 0x32, 0xb5, 0x68, 0xa5,
-  0xb7, 0xdc, 0x04, 0x22, 0x92, 0xeb, 0x34, 0x25, 0xaa, 0x1e, 0x12, 0x4a,
-  0x60, 0x0e, 0x80, 0xf7, 0x39, 0xdb, 0x3f, 0x2d, 0x45, 0xc0, 0x11, 0xd6,
-  0xc8, 0x86, 0x3e, 0x92, 0x6c, 0x77, 0x8a, 0x1a, 0x48, 0x69, 0x52, 0xd1,
-  0x53, 0x55, 0x4b, 0x18, 0xd9, 0xfc, 0x13, 0x2a, 0xaf, 0xfb, 0x5d, 0x77,
-  0x1a, 0xc8, 0xee, 0x4b, 0x23, 0x4a, 0x51, 0x29, 0x66, 0x8c, 0xe7, 0x74,
-  0xe5, 0x63, 0xfb, 0x67, 0x5a, 0x41, 0xba, 0x7d, 0x23, 0xd8, 0x61, 0x13,
-  0x51, 0x5c, 0x1e, 0x58, 0x0c, 0x42, 0x40, 0x56, 0x4d, 0xb9, 0x48, 0xce,
-  0xea, 0xd8, 0xc1, 0x03, 0xa8, 0xc6, 0xda, 0xb3, 0xc1, 0xfc, 0x45, 0xf4,
-  0xb1, 0xc6, 0x73, 0x34, 0x34, 0x37, 0x8b, 0x6d, 0x0c, 0x63, 0x3c, 0xd5,
-  0x13, 0x42, 0x81, 0xb0, 0x3a, 0xe0, 0x00, 0x49, 0x3a, 0x09, 0x60, 0x40,
-  0x62, 0x5f, 0xd1, 0xfd, 0x29, 0xb1, 0xf1, 0x4d, 0x0d, 0xf6, 0xfe, 0x1e,
-  0xdb, 0x43, 0x14, 0x72, 0xba, 0x19, 0xd0, 0x86, 0x9f, 0xca, 0x57, 0x08,
-  0xbd, 0x48, 0xf3, 0x75, 0xe9, 0xa2, 0x77, 0xdb, 0xdc, 0x97, 0x09, 0xea,
-  0xee, 0x47, 0xc4, 0x82, 0x96, 0x46, 0xff, 0x00, 0xa7, 0x89, 0xf6, 0x2a,
-  0x83, 0x65, 0x24, 0x7a, 0xe3, 0xb7, 0x6d, 0x5e, 0xe2, 0xcb, 0x35, 0x1d,
-  0x2d, 0xc8, 0x9a, 0xeb, 0xf5, 0x57, 0x10, 0x5d, 0x95, 0xb3, 0x57, 0x57,
-  0x3e, 0xd1, 0xc6, 0x07, 0x45, 0x51, 0xdb, 0xbf, 0xc3, 0xe3, 0xa5, 0x2b,
-  0x8c, 0x8d, 0x71, 0xa8, 0xf0, 0x53, 0x2b, 0x4f, 0x1f, 0xdb, 0x3e, 0xde,
-  0x9f, 0x3d, 0x2b, 0x1e, 0xa3, 0x2c, 0x8b, 0x42, 0x31, 0xd0, 0x51, 0x89,
-  0xaa, 0x0c, 0xae, 0x33, 0x8e, 0x99, 0xd7, 0xb7, 0x18, 0x44, 0x93, 0x08,
-  0x97, 0xa0, 0x3b, 0xea, 0xe9, 0x6f, 0xa9, 0xd3, 0x33, 0x11, 0xb9, 0x3b,
-  0x6a, 0x9a, 0xb8, 0x21, 0xa7, 0x3d, 0x08, 0xce, 0xfd, 0xbd, 0x74, 0xe2,
-  0x24, 0xa1, 0x5c, 0x15, 0x50, 0x53, 0x27, 0x56, 0x1a, 0x6d, 0xe1, 0x4a,
-  0x01, 0x25, 0xa1, 0xdc, 0x4a, 0xe5, 0xfc, 0x36, 0x8d, 0x97, 0x97, 0x63,
-  0xb6, 0x46, 0x94, 0xa9, 0xd4, 0xcd, 0x50, 0xd3, 0xb0, 0xe9, 0xd3, 0x4f,
-  0x1c, 0x01, 0x4b, 0x1c, 0xf1, 0xd6, 0x3b, 0xca, 0x7c, 0xa5, 0x54, 0xa8,
-  0x38, 0x23, 0xbe, 0x74, 0x60, 0x82, 0x56, 0x96, 0x7e, 0x64, 0x45, 0x8d,
-  0xcb, 0x49, 0xb2, 0x0e, 0x5f, 0xb5, 0x9f, 0x4d, 0x13, 0x7b, 0x45, 0x43,
-  0x51, 0x49, 0x14, 0x96, 0x39, 0xf9, 0xf9, 0x0e, 0x1c, 0x3f, 0x7e, 0xc7,
-  0x47, 0xe3, 0xb1, 0xdb, 0x95, 0x73, 0x23, 0x34, 0x8c, 0x33, 0xe6, 0x2e,
-  0x41, 0xeb, 0xed, 0xd3, 0x52, 0xbd, 0xba, 0xdf, 0x14, 0x60, 0xb4, 0xf5,
-  0x28, 0x39, 0xba, 0x89, 0xdb, 0x7f, 0x6f, 0x86, 0x81, 0x69, 0xd5, 0x16,
-  0xd2, 0x8a, 0x27, 0xa5, 0x59, 0xff, 0x00, 0x85, 0x57, 0xa2, 0xba, 0x06,
-  0xe7, 0x0d, 0xe5, 0xdf, 0xbe, 0x9a, 0x38, 0xa2, 0xc9, 0x4d, 0x79, 0xb5,
-  0x7d, 0x41, 0xf0, 0xa6, 0x05, 0x55, 0xa7, 0x93, 0x1b, 0xa3, 0x28, 0xc6,
-  0x7e, 0x07, 0x7c, 0xe9, 0x6a, 0xfc, 0xa9, 0x45, 0x61, 0x74, 0xa4, 0xa9,
-  0xaa, 0x69, 0x8c, 0xcd, 0x0a, 0x46, 0x65, 0x38, 0xe5, 0x07, 0x39, 0xc7,
-  0xc3, 0x4d, 0xb6, 0x9a, 0xb5, 0xa9, 0xa0, 0x86, 0x56, 0x70, 0x19, 0xd7,
-  0xa1, 0x38, 0x27, 0xd7, 0x6d, 0x64, 0xd5, 0x33, 0x6c, 0x57, 0xb4, 0xd1,
-  0xa7, 0x00, 0x92, 0x0c, 0xc3, 0x38, 0xb2, 0x09, 0xa2, 0xbb, 0xc9, 0x49,
-  0x3a, 0x94, 0x74, 0x20, 0x38, 0xf8, 0x6b, 0xb8, 0x24, 0x54, 0xa5, 0x60,
-  0x4f, 0x44, 0x27, 0xf1, 0x23, 0x5a, 0xa7, 0x17, 0xf0, 0xad, 0x05, 0xe6,
-  0xae, 0x29, 0xcc, 0x58, 0xaa, 0x7e, 0x58, 0xf9, 0xd0, 0xe0, 0x9f, 0x4f,
-  0xf8, 0x75, 0x9c, 0x5e, 0x6c, 0xc6, 0x38, 0x2a, 0x24, 0xb4, 0x57, 0x53,
-  0xdd, 0x61, 0x41, 0xcb, 0x27, 0x82, 0x08, 0x92, 0x13, 0xcd, 0x8f, 0x32,
-  0x1c, 0x1c, 0x67, 0xb8, 0xdb, 0x55, 0xc3, 0xa8, 0x57, 0xa0, 0x79, 0x81,
-  0xf4, 0xce, 0xb6, 0xc0, 0x58, 0x1f, 0x9b, 0xc5, 0x39, 0x4f, 0x3c, 0x8c,
-  0xf9, 0xea, 0x73, 0xae, 0x29, 0x73, 0xe0, 0x28, 0xf7, 0x3f, 0xae, 0xbb,
-  0x96, 0x39, 0x61, 0x6e, 0x49, 0x63, 0x78, 0xdc, 0x76, 0x65, 0x20, 0xeb,
-  0xca, 0x20, 0x59, 0x25, 0x50, 0x37, 0x59, 0x0f, 0xe0, 0x75, 0xaa, 0x64,
-  0x8d, 0x76, 0x8a, 0x66, 0xb7, 0x52, 0x5b, 0xeb, 0xa8, 0xed, 0x9f, 0x5f,
-  0xae, 0xab, 0x2d, 0xe0, 0x4d, 0x26, 0xf0, 0xc2, 0xc0, 0xe3, 0x1c, 0xbd,
-  0x0b, 0x01, 0xb9, 0xe6, 0xd8, 0x0d, 0xf0, 0x74, 0xd7, 0x6a, 0xe2, 0x8b,
-  0x95, 0x64, 0x72, 0x5b, 0xe8, 0xee, 0x34, 0xf3, 0x5e, 0x56, 0x30, 0xaf,
-  0x34, 0xb4, 0xd1, 0xb2, 0xdc, 0x4e, 0x49, 0x68, 0x9d, 0x88, 0xc9, 0xf4,
-  0x53, 0x91, 0xd3, 0xdc, 0x63, 0x35, 0x79, 0xea, 0xe2, 0xb6, 0x4f, 0x4f,
-  0x15, 0x44, 0xa9, 0x13, 0x79, 0x9a, 0x35, 0x72, 0x14, 0x91, 0xea, 0x34,
-  0xcf, 0xc3, 0x36, 0xe8, 0xe4, 0xa3, 0xa1, 0xac, 0x82, 0xda, 0x2e, 0x2f,
-  0x50, 0x19, 0xe4, 0x73, 0x59, 0xe0, 0xac, 0x18, 0x38, 0x03, 0x23, 0x27,
-  0x3b, 0x13, 0xb8, 0x3d, 0x46, 0x35, 0x93, 0x26, 0x3a, 0x2c, 0xce, 0x49,
-  0xbe, 0x2b, 0xb4, 0xf4, 0xf4, 0xf9, 0xcb, 0x04, 0xc7, 0x8d, 0x14, 0x11,
-  0xb9, 0x26, 0xb7, 0xf9, 0xdf, 0x6f, 0x4f, 0xac, 0x60, 0xa7, 0xe2, 0xcb,
-  0x6d, 0x6d, 0x6c, 0x70, 0xd2, 0xda, 0x9a, 0x0b, 0xb5, 0x5c, 0x62, 0x86,
-  0x64, 0xa9, 0x50, 0x61, 0x89, 0x41, 0x24, 0x96, 0x3f, 0x69, 0x82, 0xee,
-  0x40, 0x21, 0x48, 0xc0, 0xc9, 0xdb, 0x42, 0x2f, 0x31, 0x5d, 0xef, 0xb5,
-  0xbf, 0x5c, 0xa4, 0x8e, 0xae, 0xae, 0x28, 0x7f, 0x97, 0x4e, 0xf3, 0x49,
-  0xcc, 0xce, 0xa8, 0x30, 0x77, 0x27, 0xcc, 0x48, 0xdc, 0xe3, 0xd7, 0x4c,
-  0x89, 0x59, 0xcc, 0x2a, 0xae, 0x0f, 0x6a, 0xa0, 0xac, 0xa7, 0xa4, 0xa6,
-  0x06, 0xb5, 0x92, 0xb7, 0xc5, 0xaa, 0x71, 0x9c, 0x04, 0xe6, 0x58, 0xfa,
-  0x74, 0xc9, 0x60, 0x70, 0x33, 0xbe, 0xaa, 0x2d, 0xb3, 0xeb, 0xd7, 0x3b,
-  0x75, 0xfe, 0xaa, 0xe6, 0x91, 0x0a, 0x99, 0x11, 0xe8, 0x16, 0x8e, 0x22,
-  0xd1, 0xd2, 0x28, 0x24, 0x88, 0xc0, 0x6e, 0x50, 0x71, 0x8c, 0x1d, 0xb7,
-  0x39, 0xeb, 0x9d, 0x67, 0xc4, 0xec, 0x8c, 0x45, 0x75, 0x37, 0xf8, 0xda,
-  0x6d, 0xd4, 0x61, 0xc5, 0x95, 0x03, 0x5f, 0x42, 0x0f, 0x5e, 0xad, 0xfc,
-  0xb6, 0xec, 0x07, 0xe9, 0x14, 0xa6, 0x2c, 0xe5, 0x53, 0x94, 0xf3, 0x67,
-  0x1c, 0xbd, 0xcf, 0xb6, 0x98, 0x78, 0x6b, 0x81, 0x2e, 0x97, 0x06, 0x59,
-  0xaa, 0x5c, 0x51, 0x52, 0x1d, 0xf2, 0x77, 0x91, 0x87, 0xa0, 0x1d, 0xbe,
-  0x27, 0x4e, 0x54, 0xb6, 0x1a, 0x58, 0xaf, 0x05, 0xde, 0x9e, 0x24, 0x38,
-  0xe6, 0x67, 0x55, 0x00, 0xc9, 0xef, 0x81, 0xd3, 0x27, 0xa8, 0x1a, 0x6b,
-  0x84, 0x8e, 0x5c, 0x00, 0x00, 0x03, 0x00, 0x7a, 0x69, 0xf3, 0x6b, 0x18,
-  0x6c, 0xa2, 0xa7, 0x9b, 0x8f, 0x4a, 0x2a, 0xc9, 0xb8, 0x22, 0xd5, 0x60,
-  0xb6, 0x59, 0xe9, 0xca, 0x50, 0xd3, 0xaa, 0xb9, 0x1e, 0x69, 0x58, 0x65,
-  0xdb, 0xe2, 0x7f, 0x6d, 0x02, 0xe2, 0xbe, 0x1b, 0xa1, 0xbf, 0xd0, 0xfd,
-  0x52, 0xb2, 0x49, 0x21, 0x6a, 0x77, 0xe6, 0x8e, 0x48, 0xc8, 0xe6, 0xc1,
-  0x3b, 0x8d, 0xfa, 0x83, 0xfb, 0x69, 0xd9, 0x97, 0x23, 0xb6, 0x82, 0xdc,
-  0x44, 0x6b, 0x56, 0xb1, 0x86, 0x1c, 0xee, 0x84, 0x91, 0xe8, 0x07, 0xff,
-  0x00, 0x3a, 0x86, 0x9b, 0x21, 0x2f, 0xbf, 0x79, 0x5c, 0xaa, 0x3d, 0x9e,
-  0xdd, 0xa0, 0x0a, 0xda, 0x46, 0xa3, 0xe1, 0x1a, 0xc8, 0x9a, 0xae, 0x6a,
-  0x86, 0x8e, 0x98, 0x40, 0x65, 0x9b, 0x1c, 0xe4, 0x12, 0x32, 0x06, 0x3a,
-  0x0c, 0x1f, 0x89, 0xee, 0x74, 0x8b, 0x67, 0xb8, 0xd5, 0xdb, 0x69, 0x1e,
-  0x9e, 0x92, 0x43, 0x03, 0xa9, 0x70, 0xd3, 0x2b, 0x60, 0x04, 0x62, 0x7b,
-  0xfa, 0xe0, 0xf4, 0xd6, 0x81, 0x7e, 0xa7, 0x92, 0xa6, 0xcf, 0x5d, 0x46,
-  0xa4, 0x87, 0x95, 0x73, 0x1e, 0x1b, 0x97, 0x98, 0x8c, 0x1c, 0x67, 0xb7,
-  0x4d, 0x67, 0xb5, 0x76, 0x1b, 0xd0, 0xa6, 0x0d, 0x25, 0x21, 0xa5, 0x80,
-  0x1c, 0x0e, 0x62, 0x06, 0xfe, 0xc3, 0xa9, 0x3e, 0xe7, 0x5b, 0xa6, 0x55,
-  0xa8, 0x22, 0xba, 0xa5, 0xaa, 0x5f, 0xea, 0x94, 0xb9, 0x0a, 0x0f, 0x99,
-  0x8f, 0xea, 0x7f, 0xb6, 0x98, 0x78, 0x1e, 0xd1, 0x46, 0xd7, 0x6a, 0x5f,
-  0xe2, 0x28, 0x52, 0x88, 0x1e, 0x65, 0xe7, 0xd8, 0x4a, 0xdd, 0x89, 0xff,
-  0x00, 0x4e, 0x47, 0xcf, 0xe1, 0xa9, 0xec, 0xf6, 0x2a, 0x4a, 0x69, 0x42,
-  0x55, 0x95, 0x90, 0xa9, 0x1c, 0xd1, 0x03, 0xb6, 0x4f, 0xf5, 0x1e, 0xfa,
-  0x74, 0xb9, 0x5a, 0xbe, 0xbf, 0x6e, 0xa5, 0xa9, 0xa7, 0x0a, 0xb2, 0x29,
-  0xe4, 0x62, 0x3a, 0x72, 0x7f, 0x8d, 0x15, 0x10, 0x31, 0xed, 0x11, 0xee,
-  0x32, 0xac, 0x8f, 0xca, 0x3a, 0x0f, 0xd7, 0x54, 0xea, 0x23, 0x65, 0xa6,
-  0x31, 0x02, 0x43, 0x92, 0x32, 0x3f, 0xe7, 0xcb, 0x56, 0xa8, 0xe1, 0xe6,
-  0x93, 0x9e, 0x4c, 0xe1, 0x7f, 0x5d, 0x42, 0x87, 0xc7, 0xaf, 0x69, 0x06,
-  0x79, 0x57, 0xa7, 0xbe, 0x9e, 0x2c, 0xfb, 0x0b, 0x0c, 0x01, 0x4e, 0xdc,
-  0xa3, 0x27, 0x57, 0xb8, 0x22, 0xba, 0x68, 0xae, 0x6d, 0x12, 0x83, 0x89,
-  0x54, 0x89, 0x31, 0xd0, 0x0c, 0xe4, 0x1f, 0xc7, 0x23, 0xe7, 0xa1, 0x57,
-  0x69, 0x76, 0x58, 0x81, 0xdc, 0xee, 0xda, 0x61, 0xe1, 0x2a, 0x53, 0x4d,
-  0x40, 0x66, 0x23, 0x0f, 0x37, 0x98, 0xfc, 0x3b, 0x6b, 0x89, 0x80, 0x08,
-  0xda, 0x26, 0xc3, 0x00, 0xa1, 0x88, 0x27, 0x03, 0x7d, 0x75, 0x35, 0x58,
-  0x82, 0x03, 0x20, 0x01, 0xe4, 0xc8, 0x09, 0x91, 0x9d, 0xc9, 0xd0, 0x99,
-  0x2a, 0x3c, 0x35, 0xe7, 0x77, 0x00, 0x6a, 0xed, 0xba, 0x4a, 0x76, 0x8d,
-  0xaa, 0xea, 0x9c, 0x78, 0x08, 0x30, 0x39, 0x8e, 0x39, 0x89, 0xff, 0x00,
-  0x3a, 0x9b, 0x1a, 0x11, 0x80, 0xb3, 0x2f, 0xd7, 0x70, 0xed, 0x17, 0xf0,
-  0x2a, 0xb7, 0xaa, 0x9c, 0xd3, 0xd4, 0x55, 0xa1, 0x8d, 0x67, 0x08, 0x5d,
-  0xcc, 0xaf, 0xb2, 0x85, 0x51, 0xbb, 0x1c, 0xe3, 0x61, 0xac, 0xf6, 0xd5,
-  0xc3, 0xbc, 0x47, 0xc1, 0xb7, 0xb8, 0x64, 0xe2, 0x3b, 0x9c, 0x34, 0x94,
-  0x92, 0xbb, 0xc0, 0x5a, 0x6a, 0x83, 0x22, 0x4a, 0x79, 0x73, 0x94, 0x60,
-  0x0f, 0x2f, 0x63, 0xbe, 0x3d, 0xf5, 0xa9, 0xd1, 0x56, 0xd3, 0xbd, 0x54,
-  0x75, 0xf2, 0xb1, 0x9e, 0x5a, 0x78, 0xf9, 0x20, 0x62, 0x72, 0xb1, 0x67,
-  0xa9, 0x0b, 0xd9, 0x88, 0xdb, 0x9b, 0xd3, 0xd3, 0x7c, 0xa5, 0xfd, 0x25,
-  0xf1, 0x4d, 0xa6, 0x78, 0x4d, 0xae, 0xe0, 0x0c, 0xeb, 0x33, 0x82, 0xc1,
-  0x07, 0x9e, 0x1c, 0x67, 0x12, 0x29, 0xec, 0xc3, 0x3d, 0x3b, 0x8c, 0x8e,
-  0xfa, 0xce, 0x4b, 0x51, 0x0b, 0xcc, 0xb6, 0x20, 0x9d, 0x63, 0xda, 0xfc,
-  0x3d, 0xea, 0x03, 0xa7, 0xab, 0xbc, 0xb5, 0xea, 0x96, 0x3a, 0xa0, 0xe1,
-  0x5a, 0x64, 0x29, 0x24, 0x60, 0x95, 0xc7, 0x36, 0xcc, 0x08, 0xd9, 0x81,
-  0xf6, 0xd0, 0xfb, 0x31, 0x8d, 0x78, 0xf6, 0xf3, 0x4f, 0x4a, 0xa9, 0x4f,
-  0x13, 0xad, 0x64, 0x71, 0xa4, 0x92, 0x04, 0x55, 0xc1, 0x25, 0x41, 0x27,
-  0x61, 0xba, 0xe8, 0x4f, 0x8f, 0x7e, 0xb2, 0xd3, 0x86, 0xb7, 0x5d, 0x6a,
-  0xd6, 0x80, 0xb6, 0x63, 0x9e, 0x96, 0x66, 0x11, 0x31, 0xf5, 0xd8, 0xf9,
-  0x5b, 0xd8, 0xe0, 0xe8, 0x38, 0x49, 0xea, 0xa6, 0x62, 0x12, 0x59, 0xe5,
-  0x62, 0x59, 0xb0, 0xa5, 0xd9, 0x89, 0x3b, 0x93, 0xf3, 0xd6, 0x0c, 0xda,
-  0xa2, 0x59, 0x7d, 0xda, 0x2b, 0x3e, 0xb7, 0xc3, 0xfc, 0x29, 0x53, 0x1e,
-  0x4a, 0xc9, 0xd4, 0xae, 0x28, 0x18, 0xd6, 0x92, 0xdb, 0x68, 0xee, 0x10,
-  0x89, 0x8d, 0x3d, 0xea, 0xe1, 0x2c, 0xa8, 0xab, 0x12, 0x1e, 0x6a, 0x78,
-  0xb2, 0xc0, 0x1c, 0xb7, 0xdf, 0x6f, 0x40, 0x3c, 0xa3, 0xb9, 0x3d, 0x35,
-  0xdf, 0x19, 0xda, 0x2d, 0x70, 0xdd, 0xcd, 0x45, 0xbd, 0x1a, 0x15, 0xa9,
-  0xab, 0x96, 0x26, 0x45, 0x23, 0x94, 0x85, 0x60, 0x32, 0x07, 0x63, 0xbe,
-  0x3d, 0x35, 0x47, 0x86, 0x6c, 0xd3, 0x53, 0xdd, 0xe8, 0xaa, 0xee, 0x4c,
-  0x29, 0x11, 0x24, 0x59, 0x12, 0x26, 0x3f, 0xcd, 0x76, 0x5d, 0xc0, 0xe5,
-  0x1b, 0xa8, 0xc8, 0xea, 0x71, 0xb6, 0x89, 0x1a, 0x7a, 0xbb, 0x95, 0x35,
-  0xa7, 0xc2, 0x43, 0x24, 0xb2, 0x4d, 0x2c, 0x8d, 0x83, 0xd3, 0x2e, 0x49,
-  0x27, 0xd0, 0x0c, 0x75, 0x3d, 0x35, 0xe8, 0x69, 0x1f, 0x2b, 0x82, 0xf9,
-  0x36, 0x9f, 0x3f, 0xe2, 0xb8, 0x34, 0xd8, 0x0a, 0xe2, 0xc0, 0x6c, 0x8e,
-  0x4f, 0x3b, 0xc0, 0xb6, 0xcb, 0x34, 0xb7, 0x19, 0x24, 0x8e, 0x08, 0x66,
-  0x98, 0x29, 0xc1, 0xe5, 0x20, 0x75, 0x38, 0x1b, 0xfb, 0xe8, 0x8d, 0xf6,
-  0xdd, 0x55, 0xc3, 0x56, 0xaa, 0x7a, 0x5b, 0x75, 0x34, 0xf4, 0xb0, 0x4e,
-  0xca, 0x26, 0xad, 0x67, 0xc3, 0x49, 0x2e, 0x39, 0xbc, 0x25, 0x3d, 0x42,
-  0xa6, 0xd9, 0xf7, 0xeb, 0xd0, 0x6a, 0xad, 0xfe, 0xba, 0x92, 0x3a, 0x58,
-  0xac, 0x16, 0xe9, 0xe3, 0x78, 0x44, 0xc2, 0x5a, 0xaa, 0xbc, 0x9e, 0x59,
-  0x65, 0xe8, 0x39, 0x7b, 0xf2, 0x26, 0x4e, 0x0f, 0x73, 0x93, 0xe9, 0xa6,
-  0x4f, 0xa4, 0x97, 0xaf, 0xa4, 0x8a, 0xd1, 0x6d, 0xb9, 0x2d, 0x2a, 0x57,
-  0xfd, 0x4e, 0x73, 0x51, 0x34, 0x3c, 0xd3, 0x2c, 0x9c, 0xc4, 0x28, 0x90,
-  0x64, 0x64, 0x3b, 0x08, 0xf0, 0x7d, 0x32, 0x4e, 0xd9, 0xd6, 0x7d, 0x4e,
-  0xa8, 0x64, 0x46, 0x55, 0xe0, 0x56, 0xfe, 0x73, 0xd0, 0xf0, 0xdf, 0x0c,
-  0x6c, 0x19, 0x71, 0x64, 0xc8, 0x05, 0xb5, 0xec, 0x7b, 0x6d, 0xcf, 0xe7,
-  0x17, 0x0a, 0x71, 0x45, 0x0a, 0xd7, 0x5b, 0x79, 0xad, 0x52, 0x23, 0x9a,
-  0x8a, 0xe3, 0x2c, 0x53, 0x53, 0x38, 0x2a, 0xe0, 0x80, 0x0c, 0xa4, 0x86,
-  0x04, 0x85, 0xe5, 0x61, 0x8c, 0x1d, 0xdb, 0x7c, 0x63, 0x51, 0x56, 0x94,
-  0xa5, 0xe1, 0xeb, 0x7c, 0x51, 0xca, 0xa5, 0xa8, 0x22, 0xa7, 0x0c, 0xa3,
-  0xaa, 0xb6, 0x0f, 0x36, 0x7e, 0x67, 0x40, 0xe5, 0xe5, 0x1c, 0x2b, 0xc3,
-  0xe1, 0x7e, 0xc9, 0xa4, 0x76, 0x23, 0xfd, 0x46, 0x57, 0xce, 0xb9, 0xb6,
-  0x24, 0x95, 0x14, 0xf5, 0xf4, 0xb0, 0xa3, 0x3b, 0xbc, 0x21, 0x95, 0x54,
-  0x64, 0x92, 0x18, 0x74, 0x1f, 0x3d, 0x6c, 0xc3, 0x8c, 0x13, 0xed, 0x7b,
-  0x90, 0x27, 0x93, 0xab, 0xcc, 0x50, 0x1d, 0x28, 0xe1, 0x58, 0xfd, 0xcc,
-  0x71, 0xe3, 0xfa, 0x99, 0xa1, 0xb6, 0xdb, 0xee, 0x54, 0x93, 0x3c, 0x53,
-  0x44, 0xd9, 0x0c, 0xbe, 0x8c, 0x3b, 0xfb, 0x6d, 0xab, 0x5c, 0x31, 0xc5,
-  0xb4, 0xd5, 0x94, 0xb1, 0xfd, 0x78, 0x88, 0x27, 0xe5, 0xc9, 0x60, 0x0f,
-  0x21, 0xfe, 0xdf, 0x0d, 0x0e, 0xe2, 0x55, 0x73, 0xf4, 0x77, 0x03, 0xcc,
-  0xac, 0xb2, 0x9f, 0x0f, 0x20, 0x8e, 0x9c, 0xbb, 0x63, 0xf2, 0xd2, 0xb7,
-  0x0e, 0x11, 0xf5, 0x37, 0xc6, 0xe4, 0x39, 0x1a, 0x77, 0xc0, 0xb9, 0x06,
-  0xf3, 0x22, 0x65, 0x64, 0xe2, 0x6a, 0x82, 0xfd, 0x43, 0x23, 0x94, 0x8e,
-  0x55, 0xe9, 0xf6, 0xd8, 0xe0, 0x67, 0xf5, 0xd5, 0x4a, 0x78, 0x96, 0x7a,
-  0x2f, 0xe3, 0x15, 0x0c, 0x91, 0xb3, 0xaf, 0x27, 0x22, 0xc9, 0xcc, 0x39,
-  0xb3, 0x83, 0x83, 0xdc, 0x7a, 0x77, 0xd2, 0x95, 0x19, 0x54, 0x99, 0x59,
-  0x86, 0x54, 0x82, 0x1b, 0xe0, 0x74, 0xcb, 0xc3, 0x51, 0x49, 0x05, 0x92,
-  0x9a, 0xe5, 0x4a, 0x92, 0x55, 0xb4, 0x44, 0xc9, 0x53, 0x01, 0x50, 0xcc,
-  0xf1, 0x11, 0xbf, 0x87, 0xe8, 0xcb, 0xd4, 0x0f, 0xbd, 0x82, 0x3b, 0x8d,
-  0x4d, 0x70, 0xae, 0x1e, 0x21, 0x39, 0x0b, 0xf3, 0x3e, 0x6a, 0xc5, 0x53,
-  0xcc, 0x8c, 0x0a, 0x9d, 0xb2, 0x0e, 0xc7, 0x5e, 0xd4, 0x18, 0x2a, 0x29,
-  0xdc, 0xb7, 0x2b, 0x2f, 0xda, 0xdc, 0xed, 0x91, 0xd3, 0x3a, 0xf7, 0x88,
-  0xe8, 0x29, 0x5c, 0x25, 0x6d, 0xb5, 0xc6, 0x66, 0x51, 0x2a, 0x18, 0xb7,
-  0x49, 0x90, 0xee, 0x1b, 0x1d, 0x34, 0xbd, 0x3c, 0xac, 0x60, 0x92, 0x07,
-  0xd8, 0x67, 0x07, 0x7e, 0xbf, 0xe3, 0x4e, 0xad, 0x71, 0x6a, 0x07, 0x49,
-  0x18, 0x4e, 0xcc, 0xe7, 0x2c, 0xcc, 0x79, 0x8f, 0xbe, 0x75, 0xa1, 0xd8,
-  0xe4, 0x0f, 0x63, 0x8c, 0x1e, 0xe0, 0x8d, 0x67, 0x0c, 0x39, 0xa4, 0x62,
-  0x9b, 0xe9, 0xe7, 0x84, 0xaa, 0x12, 0xa2, 0xc2, 0x9c, 0xb8, 0x2f, 0x1b,
-  0x15, 0x71, 0xf9, 0x83, 0xaa, 0x5e, 0xd0, 0x18, 0x89, 0x59, 0x20, 0x11,
-  0x2c, 0x63, 0x62, 0xdd, 0x75, 0x00, 0x0b, 0x0b, 0x0e, 0x65, 0x2a, 0x08,
-  0xdc, 0x9e, 0x9a, 0xe6, 0x89, 0x9a, 0x67, 0x69, 0x1b, 0xcc, 0xa3, 0xf5,
-  0xed, 0xa9, 0x6e, 0x0c, 0x8b, 0x4c, 0x10, 0x8f, 0x33, 0xfe, 0x9a, 0xee,
-  0x20, 0x1b, 0xc1, 0xe8, 0x12, 0xb2, 0x78, 0xd1, 0xb6, 0x63, 0x2e, 0x0f,
-  0xba, 0xff, 0x00, 0xc1, 0xa6, 0xb5, 0xa9, 0x08, 0x02, 0xc6, 0xb8, 0x51,
-  0x80, 0x14, 0x7a, 0x68, 0x1d, 0xb2, 0x04, 0x8f, 0x9a, 0x4e, 0x4f, 0x37,
-  0x40, 0x73, 0x9d, 0xb4, 0x5e, 0xd0, 0xa6, 0x5b, 0x91, 0x91, 0x87, 0xf2,
-  0x69, 0xd7, 0x3f, 0xee, 0x73, 0xd3, 0xe4, 0x06, 0xff, 0x00, 0x86, 0x95,
-  0x9a, 0xa3, 0x05, 0x8c, 0x76, 0xeb, 0x51, 0xac, 0x92, 0x38, 0xe6, 0x6e,
-  0x55, 0x23, 0x9e, 0x5f, 0xf4, 0x20, 0xdc, 0xe7, 0xdf, 0x48, 0xbc, 0x65,
-  0x73, 0xfe, 0x2f, 0x71, 0x6a, 0x0b, 0x5a, 0x32, 0xd1, 0x99, 0x7c, 0xa8,
-  0xbd, 0xfd, 0x00, 0xfd, 0x75, 0xa4, 0x5b, 0xea, 0x24, 0x86, 0x9a, 0xa2,
-  0x27, 0x4e, 0x78, 0xaa, 0xa3, 0x29, 0x26, 0x0e, 0x1c, 0x02, 0x08, 0xf2,
-  0x9e, 0xdd, 0x74, 0x0d, 0x28, 0x6c, 0x9c, 0x35, 0x6e, 0x91, 0xed, 0xde,
-  0x24, 0xd7, 0x09, 0xb2, 0x04, 0xf3, 0x01, 0xcd, 0x0a, 0x9e, 0xb8, 0x1d,
-  0x01, 0xf7, 0xd6, 0x7b, 0x24, 0xc7, 0x02, 0xa2, 0xcd, 0x75, 0xc2, 0xbe,
-  0xcf, 0x60, 0x6a, 0x0b, 0x6c, 0x52, 0xc9, 0x3a, 0xe3, 0xc4, 0x94, 0x29,
-  0x6c, 0x31, 0x38, 0xc0, 0x1f, 0xa7, 0x6d, 0xb4, 0x87, 0x05, 0xb2, 0xf3,
-  0x70, 0xab, 0x65, 0x4a, 0x2a, 0xc9, 0xa6, 0x63, 0x96, 0x26, 0x33, 0x9f,
-  0x89, 0x27, 0xa7, 0xcf, 0x5a, 0x5c, 0x72, 0xd7, 0x5b, 0xa3, 0x86, 0xae,
-  0x8a, 0x11, 0x3c, 0xc1, 0x5f, 0xc5, 0x8d, 0xf7, 0x0c, 0xbd, 0x77, 0xcf,
-  0xa6, 0x34, 0x26, 0xa6, 0xa5, 0xeb, 0xe9, 0x9a, 0x49, 0x21, 0x92, 0x3a,
-  0x71, 0x94, 0x9c, 0xd4, 0x5d, 0xd8, 0x41, 0xcc, 0xc7, 0x98, 0x0c, 0x63,
-  0x63, 0x8f, 0xba, 0xbd, 0xbb, 0x6a, 0xa4, 0xb6, 0x31, 0x60, 0x7e, 0xb5,
-  0x1b, 0x16, 0x34, 0xca, 0xd4, 0xcc, 0x47, 0xc8, 0x5f, 0xef, 0x06, 0xd8,
-  0x42, 0xd8, 0x25, 0x9a, 0x38, 0xaa, 0x5e, 0xe5, 0x72, 0xa9, 0x89, 0xe0,
-  0xfa, 0xa5, 0x29, 0x2d, 0x08, 0xe6, 0x52, 0x3c, 0xec, 0x36, 0x7c, 0x67,
-  0xa2, 0xf7, 0xee, 0x35, 0x35, 0xad, 0x2f, 0x76, 0x0b, 0x4d, 0x5b, 0xc5,
-  0x05, 0x0d, 0x54, 0x12, 0x95, 0x35, 0x70, 0x89, 0x39, 0xe5, 0x88, 0x26,
-  0x70, 0x5b, 0x90, 0x82, 0xa3, 0x73, 0xd0, 0x91, 0xeb, 0x8d, 0xb5, 0x7a,
-  0xd9, 0x4e, 0x0d, 0x24, 0x34, 0xb4, 0xc9, 0x45, 0x05, 0x2d, 0x54, 0xec,
-  0xb3, 0xd4, 0x51, 0x4a, 0x5c, 0xb4, 0x68, 0xbc, 0xc5, 0x0b, 0x37, 0x9b,
-  0x38, 0xdf, 0x94, 0xe0, 0x74, 0xd5, 0x7e, 0x17, 0xe2, 0x2a, 0xa9, 0x78,
-  0x92, 0x10, 0x2e, 0x34, 0x76, 0x7b, 0x58, 0xc9, 0x31, 0xca, 0xa3, 0xc2,
-  0x48, 0xb1, 0xf6, 0x76, 0x19, 0x67, 0x23, 0x6c, 0xf5, 0x27, 0x58, 0x33,
-  0x7c, 0x4a, 0xce, 0xdb, 0x9e, 0x2b, 0x81, 0x3e, 0x87, 0x44, 0x2d, 0x1f,
-  0x16, 0x0c, 0x7e, 0xe0, 0xf8, 0xba, 0xae, 0xcf, 0xa5, 0x0e, 0x24, 0x56,
-  0x7b, 0xdd, 0x88, 0xdc, 0x92, 0xa2, 0xae, 0x8e, 0x7b, 0x73, 0x8e, 0x6e,
-  0x59, 0x20, 0x90, 0xcd, 0x18, 0x25, 0x48, 0xcb, 0x2b, 0x79, 0xbb, 0xf6,
-  0x27, 0xe1, 0xa3, 0xb5, 0x55, 0x3c, 0x3f, 0x27, 0x0d, 0xd0, 0x5b, 0x05,
-  0xfe, 0x94, 0xd2, 0x45, 0x19, 0x35, 0x4b, 0x1c, 0x86, 0x27, 0x95, 0x8b,
-  0x12, 0x43, 0x65, 0x4b, 0x91, 0xd3, 0x0a, 0x00, 0x1f, 0x1e, 0xd5, 0x92,
-  0x93, 0x85, 0x6e, 0x70, 0x57, 0x57, 0xa5, 0x13, 0xc9, 0xf5, 0x7e, 0x6f,
-  0xe6, 0x21, 0x34, 0xd1, 0x4c, 0xe7, 0x70, 0xa1, 0x72, 0x49, 0x20, 0x6e,
-  0x70, 0x17, 0xa8, 0xdb, 0x7d, 0x51, 0xac, 0x4a, 0x0b, 0x5b, 0x5b, 0xa5,
-  0xa2, 0xb4, 0x53, 0x89, 0xa7, 0x42, 0x65, 0x13, 0x31, 0x98, 0xc2, 0xea,
-  0xc4, 0x10, 0x39, 0x8f, 0x28, 0xec, 0x73, 0x83, 0xaa, 0x63, 0x1a, 0x8c,
-  0x8b, 0x44, 0x82, 0xbf, 0x5f, 0xf5, 0x33, 0xe7, 0x7d, 0x06, 0x1c, 0x9d,
-  0x4a, 0xac, 0x8e, 0x3b, 0x6d, 0xfb, 0xdd, 0x42, 0x91, 0xf0, 0xf5, 0x3c,
-  0xd6, 0xea, 0xc8, 0xad, 0x52, 0x4f, 0x4e, 0x6b, 0x23, 0x43, 0x14, 0x6b,
-  0x3f, 0x2c, 0x2f, 0xca, 0x41, 0xc3, 0x33, 0xa0, 0x7d, 0xf0, 0x48, 0xce,
-  0xdc, 0xd8, 0xed, 0xab, 0x1c, 0x4d, 0xc3, 0x35, 0xb7, 0x0b, 0xc4, 0x54,
-  0x36, 0x21, 0x49, 0x4b, 0x6f, 0xb6, 0x50, 0x8f, 0x0a, 0xaa, 0x49, 0xe4,
-  0x8c, 0x33, 0xb9, 0xe6, 0x70, 0xd2, 0x36, 0xcd, 0x23, 0x39, 0x61, 0x91,
-  0xe5, 0xc1, 0x1b, 0xe8, 0x3a, 0xde, 0x2e, 0x94, 0x9c, 0x2c, 0x97, 0x4a,
-  0x6a, 0x97, 0x15, 0x3f, 0xc4, 0xc8, 0xa8, 0x2c, 0x79, 0x84, 0xaa, 0xd1,
-  0x9e, 0x55, 0x7f, 0x55, 0xd9, 0xb6, 0xd5, 0xcb, 0x95, 0x1a, 0xd4, 0xf0,
-  0x9d, 0xd4, 0xc3, 0x1c, 0x82, 0x29, 0xa9, 0xe9, 0x6e, 0x61, 0x49, 0x2d,
-  0xe1, 0xaf, 0x37, 0x2b, 0xae, 0x7b, 0xe3, 0x9c, 0xe3, 0x3e, 0x9a, 0x4c,
-  0x98, 0x71, 0xfb, 0xca, 0x06, 0xe0, 0x5f, 0xce, 0x57, 0x4d, 0xab, 0xd4,
-  0x56, 0x3c, 0x85, 0xad, 0x58, 0xd6, 0xfb, 0x90, 0x78, 0xdf, 0x8b, 0xdb,
-  0xee, 0x65, 0x8a, 0x8b, 0x5c, 0xb5, 0xb2, 0x51, 0x58, 0xe8, 0xe3, 0xab,
-  0x86, 0xbe, 0xdf, 0x46, 0x91, 0x3d, 0x1d, 0x55, 0x23, 0x44, 0xc5, 0x87,
-  0xda, 0x20, 0x8c, 0xa9, 0x05, 0x89, 0xc1, 0xce, 0xfa, 0xa5, 0x55, 0x5f,
-  0x4f, 0x65, 0x9d, 0xac, 0xf4, 0x52, 0x4b, 0x35, 0x49, 0x56, 0xfe, 0x29,
-  0x55, 0x49, 0xbb, 0xa2, 0x0d, 0xda, 0x18, 0x9b, 0xa0, 0xe9, 0x86, 0x7e,
-  0xdd, 0xba, 0x1c, 0xb6, 0x5e, 0xe1, 0xaf, 0xa4, 0x92, 0xf6, 0xf6, 0xa9,
-  0x2e, 0x53, 0x56, 0x46, 0x4d, 0xbe, 0x8a, 0x98, 0x0f, 0x3a, 0x90, 0x88,
-  0x4c, 0x80, 0x73, 0x64, 0xf9, 0x1b, 0x6e, 0xf9, 0xec, 0x34, 0xab, 0xc1,
-  0x11, 0x51, 0xdc, 0x2d, 0x23, 0x86, 0xe0, 0xfe, 0x44, 0x93, 0x4b, 0xe3,
-  0xde, 0x64, 0x23, 0x96, 0xa2, 0x68, 0x95, 0xf0, 0x94, 0xd0, 0x8e, 0xa4,
-  0x0c, 0x73, 0x37, 0xc7, 0xa7, 0x97, 0x4d, 0x9b, 0x2b, 0xd0, 0xc4, 0xa7,
-  0x9f, 0xca, 0xfe, 0x62, 0xe9, 0x34, 0xf8, 0x99, 0x9f, 0x55, 0x90, 0x70,
-  0x78, 0xbb, 0xf5, 0x2d, 0xfc, 0x0f, 0x38, 0xd5, 0x60, 0x9e, 0xe1, 0xc4,
-  0xfc, 0x07, 0x5f, 0x25, 0xc2, 0x86, 0x96, 0x8a, 0x95, 0x9f, 0xc2, 0xb5,
-  0xc5, 0x04, 0x65, 0x02, 0xa2, 0xaf, 0x4f, 0xf5, 0x00, 0x42, 0x80, 0xc7,
-  0xa9, 0xe6, 0xd2, 0x67, 0x0b, 0x9f, 0xe6, 0x4f, 0x11, 0x38, 0x3b, 0x1c,
-  0x7e, 0xba, 0x7e, 0xe0, 0x3b, 0xa3, 0x56, 0xcb, 0x75, 0xa1, 0x9a, 0x35,
-  0x86, 0x3a, 0x49, 0x82, 0x45, 0x0a, 0x8c, 0x08, 0xe3, 0x03, 0x01, 0x40,
-  0xf4, 0x18, 0xd2, 0x25, 0x3c, 0x7f, 0x53, 0xe2, 0x9a, 0x8a, 0x7c, 0x79,
-  0x7c, 0x57, 0x41, 0x91, 0xee, 0x71, 0xad, 0xf8, 0x54, 0xa2, 0x85, 0x26,
-  0xe7, 0x85, 0xa9, 0xc8, 0xb9, 0x72, 0xb3, 0xa8, 0xa0, 0x7b, 0x43, 0x88,
-  0xbb, 0x15, 0xf5, 0x1a, 0x3d, 0xc2, 0x35, 0xcf, 0x44, 0xb1, 0x53, 0xf3,
-  0x95, 0xe4, 0x50, 0x01, 0xef, 0xb6, 0x81, 0x8d, 0x8e, 0xb8, 0xa8, 0x9e,
-  0x61, 0x03, 0x78, 0x1c, 0xc2, 0x58, 0xbf, 0x9b, 0x80, 0x32, 0x4a, 0xa9,
-  0xf3, 0x01, 0xf2, 0xdf, 0xe5, 0xa6, 0x75, 0xea, 0x12, 0x2a, 0x6b, 0x68,
-  0xe9, 0xc5, 0xb7, 0xca, 0x5a, 0x4a, 0x0a, 0x71, 0xf5, 0x43, 0xce, 0xce,
-  0x07, 0x8a, 0x30, 0x23, 0x4c, 0xf4, 0x2d, 0xdf, 0x04, 0xed, 0xed, 0x91,
-  0x9d, 0x23, 0xf1, 0x44, 0x82, 0x38, 0xbe, 0xb5, 0x10, 0x26, 0x27, 0xea,
-  0x31, 0xba, 0x11, 0xd4, 0x7c, 0xb7, 0xfc, 0x34, 0x4e, 0x5a, 0xf8, 0xab,
-  0xad, 0x4d, 0x04, 0xcd, 0x14, 0x81, 0xd0, 0xf2, 0x31, 0x3e, 0x57, 0x18,
-  0xdc, 0x1c, 0xfa, 0xe9, 0x3a, 0xb6, 0xea, 0x8f, 0x54, 0x68, 0x61, 0xcb,
-  0x2b, 0x80, 0xa7, 0xd0, 0x10, 0x70, 0x08, 0xf7, 0x1d, 0x0e, 0xb3, 0xae,
-  0xc6, 0x56, 0xb6, 0x91, 0xc7, 0x58, 0xbf, 0xcb, 0x68, 0xa4, 0x1e, 0x62,
-  0x39, 0x77, 0xd3, 0x6f, 0x08, 0xd4, 0x8a, 0x7a, 0xb9, 0x66, 0xc9, 0x8e,
-  0x95, 0x82, 0xa1, 0x04, 0x7d, 0xa6, 0x3d, 0x3f, 0x7d, 0x66, 0xa7, 0x9a,
-  0x0a, 0xe9, 0x68, 0x8e, 0x17, 0x95, 0xce, 0xc7, 0xb0, 0x23, 0xa6, 0x9f,
-  0x6e, 0xa9, 0x24, 0x36, 0xfb, 0x7a, 0xae, 0x44, 0x6d, 0x10, 0x72, 0x47,
-  0xde, 0x7c, 0x00, 0x4e, 0xb4, 0x58, 0xab, 0x93, 0xae, 0xd2, 0x95, 0x3c,
-  0x0b, 0x04, 0x7c, 0x83, 0xa6, 0x32, 0x75, 0x46, 0xaf, 0x15, 0x0a, 0x1d,
-  0x3a, 0xe7, 0x97, 0x1e, 0xdd, 0x8e, 0xaf, 0x57, 0x38, 0x8e, 0x9c, 0xef,
-  0xe6, 0x7d, 0x80, 0xd0, 0xe8, 0xd0, 0xfd, 0xac, 0x90, 0x7b, 0x69, 0x4e,
-  0xf1, 0x87, 0x12, 0xec, 0x24, 0x2c, 0x58, 0xc9, 0xc2, 0x8d, 0x19, 0xe1,
-  0x68, 0xbe, 0xb1, 0x53, 0xc8, 0x08, 0x29, 0x27, 0x2c, 0x83, 0xfd, 0xb8,
-  0xdf, 0x4b, 0x93, 0xbc, 0x82, 0x82, 0x67, 0x4f, 0xb6, 0xab, 0xbe, 0xfd,
-  0x32, 0x34, 0x3d, 0x2a, 0xdc, 0xdb, 0x51, 0xa2, 0x77, 0x86, 0xaa, 0x90,
-  0xe1, 0x64, 0x8d, 0xf0, 0xc5, 0x0f, 0xb7, 0x7c, 0x1c, 0x6d, 0xa9, 0xbc,
-  0xa2, 0x8b, 0x06, 0x6c, 0x75, 0x6f, 0x15, 0x2d, 0x33, 0x4a, 0xd8, 0xc0,
-  0x1a, 0xce, 0xae, 0x95, 0x93, 0x5d, 0x2f, 0xf0, 0xdb, 0xe9, 0xf2, 0xd1,
-  0x24, 0x82, 0x4a, 0x97, 0xec, 0x06, 0x72, 0x17, 0xe2, 0x7f, 0x4d, 0x01,
-  0xac, 0xe2, 0xcb, 0xe5, 0x55, 0x2a, 0x52, 0x35, 0x49, 0x79, 0x33, 0xca,
-  0xb9, 0x40, 0x49, 0x3f, 0x1e, 0xfa, 0x61, 0xb2, 0x41, 0x0d, 0x15, 0x27,
-  0x21, 0x98, 0x4b, 0x22, 0xaf, 0x89, 0x2c, 0xb9, 0xfb, 0x72, 0x1e, 0xfa,
-  0x18, 0xd3, 0x78, 0xac, 0x68, 0x42, 0xcd, 0x32, 0x47, 0x1d, 0x4c, 0xbb,
-  0x65, 0x13, 0x91, 0x7e, 0x27, 0x6d, 0x2c, 0x71, 0x5c, 0x1f, 0xc4, 0x38,
-  0x6e, 0x0b, 0x8c, 0x13, 0x0a, 0x78, 0xa8, 0x5f, 0xc0, 0x92, 0x9a, 0x5f,
-  0x27, 0x8b, 0x23, 0x12, 0x7c, 0x48, 0xff, 0x00, 0xa8, 0x91, 0x8e, 0x61,
-  0xd4, 0x05, 0x07, 0xa6, 0xba, 0xad, 0xac, 0x8e, 0xa8, 0x47, 0x49, 0x44,
-  0xcd, 0x35, 0x5c, 0xf2, 0x18, 0xc2, 0xa8, 0x39, 0x3d, 0x86, 0x85, 0xf1,
-  0x75, 0x64, 0x1c, 0x94, 0xb6, 0x7a, 0x7e, 0x49, 0x3e, 0xa0, 0x64, 0xf1,
-  0x67, 0x53, 0x91, 0x24, 0x8d, 0x8e, 0x60, 0x3d, 0x55, 0x79, 0x40, 0xcf,
-  0x7d, 0xfb, 0x63, 0x49, 0xe2, 0x0c, 0xab, 0x86, 0x8f, 0x27, 0x89, 0xe9,
-  0x78, 0x06, 0x3c, 0x8f, 0xac, 0x0c, 0x9c, 0x0e, 0x7e, 0x5f, 0xee, 0x5d,
-  0xe0, 0x83, 0x55, 0x4d, 0x47, 0x3b, 0xa2, 0x48, 0x8f, 0x2d, 0x5d, 0x38,
-  0xa6, 0xe6, 0x4d, 0x9d, 0xfc, 0xc0, 0xe3, 0x3b, 0x11, 0x83, 0xbf, 0xb1,
-  0xd5, 0x98, 0x6d, 0xf6, 0x3a, 0xeb, 0x85, 0xea, 0x5a, 0x7b, 0x71, 0xa7,
-  0x82, 0x92, 0x76, 0x69, 0xa7, 0x94, 0xbb, 0x53, 0x50, 0xc0, 0x18, 0x20,
-  0x6e, 0x45, 0xf3, 0x48, 0xcc, 0xf9, 0xc2, 0xe4, 0x00, 0x3d, 0x7b, 0x77,
-  0x66, 0x8e, 0xb2, 0xaf, 0x84, 0xad, 0xb2, 0xc3, 0x70, 0x07, 0xc0, 0xaa,
-  0x94, 0x73, 0xd5, 0xcb, 0xc9, 0x1d, 0x3b, 0x0e, 0x5e, 0x55, 0x56, 0x63,
-  0x8c, 0x11, 0x83, 0xb7, 0x72, 0x76, 0xd5, 0xbb, 0x85, 0xde, 0xcf, 0x64,
-  0xa0, 0xae, 0x96, 0x8a, 0x38, 0x6a, 0x6e, 0xd5, 0xa6, 0x31, 0x50, 0x21,
-  0x95, 0x5e, 0x88, 0x3a, 0xb9, 0x62, 0x79, 0x09, 0x25, 0xce, 0x49, 0xd8,
-  0x79, 0x41, 0xdf, 0x3d, 0xb5, 0x89, 0xd5, 0x46, 0x04, 0x24, 0x8d, 0xaf,
-  0xe7, 0xbc, 0xf5, 0xf1, 0xe5, 0xc8, 0xda, 0xec, 0xc1, 0x54, 0xd9, 0xa1,
-  0xb7, 0x1b, 0x79, 0xfd, 0x3f, 0x08, 0xe6, 0xbd, 0xf0, 0xd6, 0xd9, 0x38,
-  0x7e, 0x8e, 0xeb, 0x61, 0xe2, 0x09, 0x2b, 0xed, 0x06, 0x56, 0x80, 0xc2,
-  0xf0, 0xaa, 0x44, 0x1f, 0x04, 0x91, 0xe1, 0xf4, 0x00, 0x80, 0x72, 0x0f,
-  0x9b, 0xa6, 0xe7, 0x20, 0xea, 0x2e, 0x2c, 0x89, 0x62, 0xe2, 0x4a, 0x3a,
-  0x4a, 0x48, 0xbc, 0x28, 0xd5, 0x07, 0x2a, 0x8e, 0xdc, 0xca, 0xae, 0x47,
-  0xbe, 0xed, 0x8f, 0x96, 0x89, 0x59, 0xff, 0x00, 0x87, 0x57, 0x70, 0x8d,
-  0x04, 0x80, 0xd0, 0xa5, 0x3d, 0x14, 0xea, 0xd3, 0x5b, 0xe9, 0xa3, 0x90,
-  0x78, 0x95, 0x4c, 0x02, 0x89, 0x67, 0x67, 0x3b, 0xf9, 0x47, 0xd9, 0x5f,
-  0x2f, 0x51, 0xeb, 0xaa, 0x7c, 0x4f, 0x51, 0x22, 0xf1, 0x9a, 0xcc, 0x1b,
-  0x32, 0xa4, 0xae, 0xc1, 0xfd, 0x4e, 0x07, 0xf6, 0xd6, 0xcd, 0x1a, 0x91,
-  0x6d, 0xd8, 0xcf, 0x27, 0xc5, 0xf2, 0x21, 0x23, 0x1d, 0x7b, 0xc0, 0x9b,
-  0x35, 0x47, 0x9d, 0xae, 0xaa, 0xe4, 0x56, 0x5b, 0x55, 0x7a, 0x5b, 0x67,
-  0xa6, 0xad, 0xb4, 0xdc, 0x1a, 0x8a, 0xa8, 0x62, 0x4e, 0x58, 0x1b, 0x2a,
-  0x41, 0xca, 0xba, 0xed, 0xd4, 0x1f, 0xc7, 0x71, 0xa6, 0x1e, 0x1a, 0xb2,
-  0xdd, 0xe4, 0xb5, 0x56, 0xda, 0xee, 0xa8, 0xd5, 0xf6, 0x48, 0x6d, 0x95,
-  0x0b, 0x47, 0x28, 0x63, 0x10, 0x86, 0x53, 0x92, 0x9c, 0xe8, 0x70, 0x59,
-  0x8b, 0x1e, 0x55, 0xce, 0x42, 0x93, 0xb6, 0x97, 0xe9, 0x2e, 0x51, 0x4f,
-  0x17, 0x8b, 0x53, 0x6f, 0x8f, 0xc4, 0x62, 0x73, 0x2c, 0x15, 0x13, 0x43,
-  0x26, 0x7d, 0x72, 0x1f, 0xaf, 0xc4, 0x6b, 0xa7, 0x36, 0x97, 0x2d, 0x2d,
-  0x5a, 0xdd, 0xee, 0x4c, 0x71, 0x88, 0xab, 0x6b, 0xcb, 0x46, 0x3e, 0x3c,
-  0xb8, 0x2d, 0xf3, 0xd3, 0x66, 0xc2, 0xd9, 0x0d, 0xf4, 0xef, 0xf3, 0xfb,
-  0xed, 0x13, 0x49, 0xaa, 0xc7, 0x85, 0x0a, 0xfb, 0x43, 0x5c, 0xd7, 0x4e,
-  0xf7, 0xe6, 0x0f, 0x56, 0xc6, 0x37, 0x50, 0x56, 0xf8, 0x36, 0xb9, 0x6a,
-  0x2f, 0x17, 0x7a, 0x7f, 0x16, 0x0a, 0x85, 0x96, 0xf5, 0x3d, 0x35, 0x57,
-  0x9a, 0x07, 0x93, 0xc9, 0x1a, 0xc4, 0xf1, 0x67, 0x24, 0x2c, 0x6b, 0xf6,
-  0x73, 0xbe, 0x73, 0xdf, 0x59, 0x9d, 0xae, 0x2a, 0x3b, 0xaf, 0x10, 0xce,
-  0xd7, 0x0b, 0xcb, 0x51, 0x46, 0x22, 0x79, 0x62, 0xa9, 0x8a, 0x9d, 0xa5,
-  0x6e, 0x65, 0x03, 0x93, 0xca, 0x80, 0x1e, 0x9d, 0x4e, 0xc4, 0x60, 0x93,
-  0xbe, 0x98, 0xff, 0x00, 0x89, 0x72, 0xad, 0x47, 0x81, 0x6c, 0xb6, 0x40,
-  0x2a, 0x11, 0x12, 0x45, 0x8e, 0x94, 0x05, 0x2a, 0x87, 0x2a, 0x39, 0x7e,
-  0xce, 0xc7, 0xbe, 0x33, 0xab, 0xd7, 0x0a, 0xf8, 0x29, 0xa1, 0xb8, 0x57,
-  0x5b, 0x59, 0x29, 0xaa, 0xee, 0x22, 0x10, 0xff, 0x00, 0x57, 0x51, 0x1f,
-  0x86, 0xaa, 0x80, 0x30, 0x01, 0x71, 0x80, 0x5b, 0x24, 0x81, 0xed, 0xa8,
-  0x64, 0xd2, 0x3b, 0x15, 0x04, 0x8d, 0xa6, 0xbd, 0x37, 0x8a, 0xe1, 0xc3,
-  0xed, 0x59, 0x41, 0xb3, 0xf2, 0x1e, 0x5b, 0x0e, 0x7d, 0x7e, 0x80, 0x4e,
-  0xf8, 0x6e, 0xa3, 0x8c, 0x29, 0xdd, 0x1e, 0x9e, 0x92, 0xcb, 0x79, 0x6a,
-  0xb8, 0x82, 0xc7, 0x2c, 0xb2, 0x78, 0x73, 0x4b, 0x18, 0x3b, 0x3b, 0x12,
-  0x51, 0x88, 0xf7, 0x61, 0x9c, 0x6a, 0x4b, 0xfd, 0x11, 0x17, 0x03, 0x5b,
-  0x5c, 0x28, 0xe8, 0xae, 0x0e, 0xe2, 0x49, 0x29, 0xe1, 0xaa, 0xf1, 0x93,
-  0x7f, 0x43, 0x80, 0x47, 0xc3, 0x27, 0xe3, 0xa1, 0xf6, 0xaa, 0x9a, 0xc8,
-  0x78, 0xa6, 0xdd, 0x55, 0x25, 0x4c, 0xd5, 0x22, 0x48, 0x50, 0x92, 0xe7,
-  0x3c, 0xa0, 0xf9, 0x4e, 0x3d, 0x81, 0xc6, 0x98, 0xf8, 0x86, 0xd6, 0x93,
-  0x5c, 0x61, 0x65, 0x19, 0x52, 0x0b, 0x48, 0xc7, 0xab, 0xb6, 0x7f, 0x4d,
-  0x6b, 0xc5, 0x88, 0xe3, 0xff, 0x00, 0x91, 0x33, 0xca, 0xd4, 0xea, 0xd7,
-  0x39, 0x35, 0x8c, 0x0f, 0x97, 0x3f, 0x7a, 0xfd, 0x20, 0x79, 0xab, 0xa9,
-  0xa1, 0x94, 0x2c, 0xad, 0x24, 0x6a, 0xdf, 0x66, 0x46, 0x8c, 0x84, 0x6f,
-  0x83, 0x74, 0xd4, 0xe8, 0x18, 0x4b, 0x0c, 0xb0, 0xb2, 0xe5, 0x49, 0x39,
-  0x3d, 0xc7, 0xa7, 0xc3, 0x56, 0xaa, 0xe8, 0x6b, 0xa2, 0xe6, 0x9a, 0x9a,
-  0xad, 0x1e, 0x3d, 0x95, 0xe9, 0x6a, 0x30, 0x63, 0x61, 0x8f, 0xbb, 0xe8,
-  0x75, 0x50, 0x0a, 0x6a, 0x75, 0x46, 0x83, 0xf9, 0x68, 0xd9, 0x26, 0x1e,
-  0xbe, 0x19, 0xee, 0x01, 0xf4, 0xd5, 0xc3, 0x5c, 0xc7, 0x53, 0xd8, 0x6c,
-  0x35, 0x55, 0x15, 0x52, 0x43, 0x40, 0xa1, 0x25, 0xc7, 0x88, 0x29, 0xdd,
-  0x82, 0x92, 0x71, 0x9f, 0x29, 0xe9, 0xd0, 0xe4, 0x67, 0xf1, 0xd0, 0x2a,
-  0xbb, 0x95, 0xb3, 0xc7, 0x79, 0x2a, 0xed, 0x05, 0xae, 0x90, 0xb9, 0x50,
-  0x70, 0x50, 0x17, 0x1b, 0x1e, 0x75, 0x1b, 0x12, 0x3d, 0xba, 0xf7, 0xd3,
-  0x35, 0x2d, 0xca, 0x58, 0x2e, 0x34, 0x75, 0xb1, 0x43, 0x83, 0x09, 0x51,
-  0x27, 0x7e, 0x64, 0xdc, 0x11, 0xb7, 0xb1, 0xfc, 0xb4, 0x33, 0x8e, 0x6c,
-  0x7f, 0xf9, 0xf4, 0xb7, 0x28, 0x99, 0xbe, 0xa5, 0x70, 0x70, 0x49, 0x46,
-  0xd9, 0x25, 0xc7, 0x42, 0x01, 0xdc, 0x1c, 0x64, 0x7c, 0xf5, 0x17, 0x50,
-  0x38, 0x95, 0x43, 0x7b, 0x19, 0x9c, 0x5e, 0xeb, 0x25, 0xfe, 0x22, 0xd5,
-  0x2e, 0x11, 0xa4, 0x90, 0xf3, 0x31, 0xf5, 0x39, 0xd6, 0xb7, 0x6f, 0x8e,
-  0x2b, 0xa7, 0x06, 0xd2, 0xbc, 0x99, 0x91, 0xd6, 0x01, 0x22, 0x85, 0xd8,
-  0xf4, 0xe9, 0xa4, 0x6a, 0xde, 0x19, 0x89, 0x21, 0x2a, 0xa5, 0x79, 0x8e,
-  0xea, 0x54, 0x12, 0x33, 0xf3, 0xdf, 0x4f, 0x7c, 0x00, 0xc5, 0xf8, 0x42,
-  0x95, 0x58, 0xa8, 0x9e, 0x99, 0x5a, 0x22, 0x83, 0xb0, 0x56, 0x23, 0x7f,
-  0x8e, 0x8a, 0x9d, 0xa7, 0x38, 0xa3, 0x71, 0x4e, 0xa9, 0x96, 0x56, 0x62,
-  0xa3, 0x3c, 0x87, 0x03, 0x27, 0xa8, 0xd7, 0x0a, 0xa7, 0x2c, 0x06, 0xe4,
-  0x10, 0x75, 0xe1, 0x55, 0xe8, 0xe4, 0x82, 0x30, 0xc0, 0x6b, 0xba, 0x64,
-  0x92, 0x49, 0xf9, 0x42, 0xb9, 0x2e, 0xdb, 0x81, 0xd0, 0x01, 0xdc, 0xfa,
-  0x63, 0x5d, 0x3a, 0x55, 0xb8, 0x2b, 0x8a, 0x6d, 0xc3, 0x34, 0x62, 0x45,
-  0x32, 0x11, 0xf7, 0x53, 0x3d, 0x71, 0xa0, 0x57, 0xa0, 0x62, 0x0b, 0x1c,
-  0x78, 0x28, 0xe3, 0x9b, 0x98, 0x77, 0x00, 0xed, 0xf2, 0xd1, 0x5b, 0x9d,
-  0x79, 0xa3, 0xbc, 0xe6, 0x9b, 0x32, 0xc2, 0x14, 0x47, 0x3a, 0x83, 0xf6,
-  0x8e, 0xfd, 0x33, 0xdc, 0x0d, 0x08, 0xb9, 0xcd, 0x1d, 0x45, 0x4f, 0xf2,
-  0x62, 0x9b, 0x0c, 0xd8, 0x55, 0x97, 0xa0, 0xcf, 0x60, 0x3f, 0x6d, 0x27,
-  0x26, 0x38, 0xa0, 0x21, 0x2e, 0x1a, 0xa4, 0x8a, 0x92, 0x21, 0x5f, 0x56,
-  0x79, 0x65, 0x93, 0x0b, 0x02, 0x91, 0xd8, 0xf7, 0xff, 0x00, 0x9d, 0xb5,
-  0x1d, 0xd2, 0xeb, 0x54, 0x22, 0x99, 0x10, 0x78, 0x6a, 0xcc, 0x4e, 0x73,
-  0x92, 0x71, 0xb0, 0xd5, 0x46, 0xa8, 0xe5, 0x9e, 0x48, 0x1a, 0x47, 0x94,
-  0xa9, 0xf0, 0xc3, 0x1e, 0xde, 0xbc, 0xa3, 0x52, 0xc3, 0x1a, 0xcb, 0xfc,
-  0xb9, 0xb2, 0x4c, 0x4b, 0x8c, 0x77, 0xc6, 0xb4, 0x28, 0x99, 0xd8, 0x93,
-  0x3d, 0xe1, 0xab, 0x82, 0x5b, 0xe7, 0x92, 0x49, 0x61, 0x96, 0x5f, 0x16,
-  0x26, 0x8c, 0x78, 0x52, 0x72, 0x3a, 0xf3, 0x6c, 0x48, 0x6c, 0x6c, 0x7f,
-  0xce, 0x9c, 0x6d, 0xd6, 0x9b, 0x5d, 0x0c, 0x71, 0xcd, 0x07, 0x09, 0x4d,
-  0x70, 0xab, 0x70, 0x3c, 0x28, 0xe6, 0x2f, 0x25, 0x3c, 0x64, 0xf4, 0x32,
-  0x48, 0x79, 0x57, 0x03, 0x6c, 0x80, 0x08, 0xed, 0x9d, 0x29, 0x50, 0xd0,
-  0x73, 0x55, 0x80, 0xe1, 0x8f, 0x2b, 0x64, 0x65, 0x86, 0x31, 0xdb, 0x3e,
-  0xba, 0x6e, 0x35, 0x74, 0x54, 0x14, 0x74, 0x2f, 0x77, 0x82, 0xa8, 0xd2,
-  0x56, 0x21, 0xc5, 0x5c, 0x0e, 0x5b, 0xc1, 0x99, 0x49, 0x1c, 0xa5, 0x33,
-  0x86, 0x1c, 0xbc, 0xa7, 0xd7, 0x07, 0xbe, 0xa1, 0xaa, 0x4c, 0x64, 0x75,
-  0x36, 0xde, 0xb5, 0x37, 0x78, 0x6e, 0x5c, 0xea, 0xc7, 0x1e, 0x2b, 0x37,
-  0xbd, 0x5d, 0x5f, 0xf8, 0xe7, 0xe5, 0x2f, 0x53, 0xc3, 0x6a, 0xb2, 0xf0,
-  0xfd, 0x1d, 0x1d, 0x53, 0x55, 0xdc, 0xe9, 0xea, 0x9a, 0x53, 0x50, 0x29,
-  0xe8, 0xbc, 0x58, 0xde, 0x42, 0x46, 0x57, 0x1b, 0x72, 0xf4, 0x1c, 0xa4,
-  0x1c, 0xed, 0x9d, 0xb4, 0x0a, 0xed, 0xc2, 0x54, 0xf7, 0x19, 0x05, 0x65,
-  0x86, 0x82, 0xa6, 0xc7, 0x6f, 0x8e, 0x30, 0x25, 0x9e, 0xf7, 0x52, 0xb0,
-  0xa3, 0xc8, 0x4e, 0x14, 0x20, 0x39, 0x61, 0x93, 0xb6, 0xf9, 0x1e, 0xe3,
-  0x4c, 0x36, 0xca, 0x6a, 0xc7, 0xa6, 0xf1, 0x78, 0x7a, 0xe9, 0xf5, 0xea,
-  0x77, 0x60, 0x0f, 0xd5, 0x64, 0x21, 0x81, 0x3d, 0x03, 0x27, 0x55, 0x3f,
-  0x11, 0xa5, 0xff, 0x00, 0xa4, 0x0a, 0xe9, 0x1a, 0xda, 0x2d, 0xd4, 0x6f,
-  0x55, 0x57, 0x1c, 0x13, 0x73, 0x5c, 0x6b, 0x14, 0x16, 0x85, 0xa5, 0xe8,
-  0x91, 0x87, 0xe8, 0x79, 0x7c, 0xde, 0xc4, 0xf4, 0xe9, 0xac, 0x5a, 0xac,
-  0x78, 0xd7, 0x1d, 0xdd, 0x8e, 0xdf, 0xfb, 0x3d, 0x8f, 0x0c, 0xd4, 0x6a,
-  0x1f, 0x50, 0x50, 0x02, 0x18, 0x9f, 0x78, 0x92, 0x6b, 0xfe, 0xbb, 0x0b,
-  0xec, 0x20, 0xb8, 0x2a, 0x6f, 0xfc, 0x17, 0x55, 0x3d, 0xba, 0xe3, 0x6c,
-  0x41, 0x14, 0xec, 0xaf, 0x2d, 0x3d, 0x54, 0x7c, 0xd1, 0xca, 0x57, 0x3c,
-  0xae, 0xae, 0x3d, 0x89, 0xc1, 0x53, 0xb8, 0x3a, 0x39, 0x4b, 0x5d, 0x5d,
-  0x7c, 0xa9, 0x5a, 0xd9, 0x38, 0x0c, 0xcc, 0x4e, 0x79, 0x65, 0x82, 0x69,
-  0x61, 0x53, 0xef, 0x97, 0xca, 0xe9, 0xa6, 0xc4, 0xb7, 0x2b, 0x67, 0x05,
-  0x59, 0x9a, 0xed, 0x74, 0xa4, 0xa4, 0xa6, 0x08, 0x24, 0xf1, 0x66, 0x99,
-  0x59, 0x7c, 0x13, 0x93, 0x18, 0x5f, 0x52, 0x01, 0xc6, 0x14, 0x1c, 0x74,
-  0xed, 0xa0, 0xf7, 0x7a, 0xeb, 0x5d, 0xee, 0xa2, 0xb6, 0xe1, 0x4b, 0x73,
-  0xad, 0xaa, 0x5a, 0x72, 0x13, 0xc4, 0x93, 0x28, 0x8c, 0xcc, 0x18, 0x85,
-  0x45, 0x3b, 0x9d, 0x86, 0xe4, 0xe3, 0x47, 0x0e, 0x22, 0x94, 0x06, 0x42,
-  0x2f, 0xb4, 0x5d, 0x66, 0xa9, 0x72, 0x97, 0x63, 0x80, 0x31, 0x1b, 0x16,
-  0xde, 0x8f, 0x6f, 0xcd, 0xe0, 0xcb, 0x8d, 0xbe, 0x9e, 0x92, 0x9e, 0x0f,
-  0x06, 0x36, 0x81, 0xd8, 0x65, 0xe0, 0x35, 0x0b, 0x31, 0x8f, 0xe2, 0xca,
-  0x00, 0xf9, 0x6a, 0x94, 0x51, 0x87, 0x95, 0x10, 0x9c, 0x06, 0x60, 0x09,
-  0xd4, 0x96, 0x63, 0x88, 0xa9, 0xdb, 0x98, 0x29, 0x04, 0x1e, 0x63, 0xd0,
-  0x6f, 0xa2, 0x12, 0x54, 0x15, 0xab, 0x59, 0x52, 0xaa, 0x27, 0x38, 0x08,
-  0xcd, 0xe1, 0x90, 0x00, 0xce, 0xfb, 0x6b, 0x63, 0xe6, 0x6c, 0x6c, 0x14,
-  0x0b, 0xdb, 0xf3, 0x81, 0x3c, 0x24, 0xc4, 0xb9, 0x01, 0x6b, 0xad, 0xff,
-  0x00, 0x39, 0x32, 0xad, 0x55, 0x22, 0xc3, 0x55, 0x34, 0x01, 0xb9, 0x84,
-  0x6e, 0x57, 0x3e, 0xbb, 0xea, 0xab, 0xc2, 0x32, 0x46, 0x47, 0x5d, 0x19,
-  0xb9, 0x33, 0x47, 0x57, 0x24, 0x86, 0xba, 0x18, 0x25, 0x52, 0x42, 0xa9,
-  0x4c, 0xb0, 0x18, 0xdb, 0x27, 0xf2, 0xd4, 0x3e, 0x3b, 0xcb, 0x21, 0xc5,
-  0x7c, 0x2e, 0x48, 0x00, 0x96, 0x88, 0x01, 0x80, 0x72, 0x3e, 0x7f, 0xf0,
-  0xea, 0x1f, 0xd6, 0xbf, 0xf6, 0xfd, 0xff, 0x00, 0x89, 0x6f, 0xe8, 0xd7,
-  0xfb, 0xbe, 0xdf, 0xcc, 0xe0, 0x23, 0x45, 0xfc, 0x2a, 0x75, 0x6c, 0x14,
-  0x0d, 0x1b, 0x1f, 0x50, 0x1b, 0x38, 0xd3, 0x6f, 0x14, 0xcd, 0x51, 0x4f,
-  0x43, 0x47, 0x55, 0x4c, 0xaa, 0x72, 0xf8, 0x6e, 0x6e, 0x84, 0x11, 0xfe,
-  0x34, 0xb0, 0xa9, 0xcd, 0x6a, 0x4c, 0x1c, 0x98, 0xaa, 0x36, 0xf8, 0x11,
-  0xfe, 0x34, 0xe7, 0x58, 0x61, 0xa8, 0xe1, 0xf8, 0xd1, 0xd0, 0x49, 0x98,
-  0xd5, 0xf0, 0x7d, 0xba, 0xeb, 0x61, 0x98, 0xc0, 0xa3, 0x17, 0xa3, 0xbc,
-  0x9a, 0xba, 0x56, 0x8e, 0x38, 0x8a, 0x34, 0xbe, 0x42, 0x4e, 0xfc, 0xa3,
-  0xb9, 0xfc, 0x35, 0x5a, 0x3a, 0x3e, 0x7f, 0x12, 0x56, 0x2c, 0x14, 0x00,
-  0xb1, 0x29, 0xec, 0xa0, 0x6d, 0xfd, 0xf5, 0x72, 0x8a, 0x1a, 0x56, 0x9a,
-  0x48, 0xe0, 0x4e, 0x55, 0x18, 0x2c, 0x3d, 0x7d, 0xb5, 0x75, 0x90, 0x0d,
-  0x15, 0xda, 0x71, 0x90, 0x9a, 0x58, 0x56, 0xd2, 0x8d, 0xbf, 0x3a, 0xcb,
-  0xca, 0xe4, 0x1d, 0xc8, 0xc6, 0xdf, 0xbe, 0xa5, 0x2d, 0x1c, 0xb6, 0xf9,
-  0xed, 0x8d, 0x1a, 0xcb, 0x1b, 0xb7, 0x32, 0xb3, 0xb1, 0x52, 0x8d, 0x8e,
-  0x6d, 0xbd, 0xb2, 0x33, 0xaf, 0x53, 0x0a, 0xdc, 0xae, 0x0b, 0x42, 0xec,
-  0x03, 0xae, 0x71, 0xb7, 0xa8, 0x3d, 0x8e, 0xa4, 0x9e, 0x99, 0x09, 0x71,
-  0x0c, 0xa5, 0x8c, 0x79, 0xdd, 0x77, 0x0f, 0xbe, 0xdf, 0x0d, 0x06, 0x17,
-  0x0a, 0xc1, 0xb0, 0xc2, 0x93, 0xd2, 0xab, 0x10, 0x09, 0xc6, 0xa9, 0x51,
-  0x4e, 0x6d, 0x77, 0x55, 0xe5, 0x88, 0x3c, 0x55, 0x32, 0x80, 0x7c, 0xdc,
-  0xbc, 0xad, 0xeb, 0xf3, 0x1f, 0xf3, 0x7d, 0x19, 0x34, 0x35, 0x4b, 0xcb,
-  0xf5, 0x35, 0xce, 0x4e, 0x5d, 0x5c, 0x74, 0xc8, 0xf5, 0x1e, 0xfa, 0xad,
-  0xfc, 0x26, 0xa5, 0x2b, 0xe3, 0xaa, 0xab, 0xe4, 0xe7, 0x82, 0x41, 0x24,
-  0x30, 0x67, 0x94, 0x31, 0xce, 0x01, 0x62, 0x7e, 0x3d, 0x06, 0xa6, 0x01,
-  0x06, 0x53, 0xa8, 0x11, 0xbc, 0x45, 0xe7, 0x90, 0xab, 0xf2, 0x92, 0x5a,
-  0x4e, 0x9e, 0xc3, 0x3d, 0x75, 0x24, 0xf7, 0x4a, 0x88, 0x69, 0xe4, 0x82,
-  0x27, 0x58, 0x98, 0x9c, 0xec, 0xbb, 0x91, 0xeb, 0x9d, 0x31, 0x70, 0xd7,
-  0x08, 0x5e, 0xaf, 0xf1, 0xc9, 0x53, 0x6d, 0xa3, 0x59, 0xa1, 0x89, 0xbc,
-  0x37, 0x26, 0x55, 0x5d, 0xfa, 0xe3, 0x73, 0x9d, 0x78, 0xdf, 0x46, 0x7c,
-  0x57, 0x51, 0x71, 0x92, 0x38, 0xa8, 0x69, 0x8b, 0x8f, 0x33, 0xa8, 0xac,
-  0x8c, 0x90, 0x33, 0xe9, 0x9e, 0x9a, 0x62, 0x22, 0xdc, 0x46, 0x77, 0x65,
-  0x46, 0x2c, 0x79, 0x9a, 0x43, 0x92, 0x4e, 0xf9, 0xf8, 0xea, 0xbd, 0x1c,
-  0x6f, 0x2d, 0xd4, 0x14, 0x03, 0x96, 0x11, 0xcc, 0x76, 0xe9, 0xdc, 0xe8,
-  0xe5, 0x75, 0x8e, 0xbe, 0x0b, 0x85, 0x55, 0x1d, 0x54, 0x62, 0x19, 0x69,
-  0xa4, 0x31, 0xca, 0x33, 0x90, 0xa5, 0x7a, 0x8c, 0x8d, 0x8e, 0x86, 0x58,
-  0x41, 0x65, 0xaa, 0x95, 0x50, 0x96, 0x90, 0x88, 0xd4, 0xfb, 0x37, 0x5f,
-  0xc8, 0x7e, 0x7a, 0x08, 0x37, 0x9c, 0xe7, 0x69, 0xef, 0x22, 0x24, 0x70,
-  0x31, 0xc7, 0x33, 0x48, 0xd2, 0x31, 0x1f, 0x6b, 0x1d, 0x3f, 0x5d, 0x5a,
-  0xb5, 0xc5, 0xcf, 0x0c, 0x85, 0x9c, 0xf9, 0x8f, 0x4c, 0x6a, 0xa5, 0x58,
-  0x26, 0x49, 0x59, 0x08, 0x2a, 0x8e, 0xb0, 0xa7, 0xc0, 0x75, 0x3a, 0x25,
-  0x44, 0x11, 0x40, 0x8d, 0x4e, 0xe4, 0x60, 0x6d, 0xd7, 0x1d, 0x75, 0x50,
-  0x24, 0x79, 0x30, 0x85, 0x96, 0x9e, 0x39, 0xee, 0x4b, 0x0c, 0x8c, 0x42,
-  0x3b, 0x85, 0xcf, 0x40, 0x36, 0xf5, 0xec, 0x3d, 0xf4, 0xc9, 0xe2, 0x56,
-  0x0b, 0x64, 0xd6, 0x5a, 0x9f, 0xa3, 0xaa, 0xba, 0x8a, 0x39, 0xf1, 0x96,
-  0x15, 0xe3, 0x0a, 0xc3, 0xa3, 0xab, 0x85, 0xc2, 0xe3, 0xae, 0x7d, 0x34,
-  0x0e, 0xd1, 0x48, 0x6a, 0x2b, 0x61, 0x81, 0x19, 0x94, 0xbb, 0x63, 0x23,
-  0xae, 0x7d, 0xbd, 0xf5, 0x2c, 0xdc, 0x77, 0x25, 0xbc, 0xb5, 0x35, 0x17,
-  0x0d, 0xe3, 0x19, 0x50, 0xd5, 0xec, 0xe5, 0xcb, 0x0e, 0xe5, 0x06, 0x07,
-  0xcb, 0x7d, 0x65, 0xd5, 0xba, 0xa8, 0x01, 0x9a, 0xbe, 0x9c, 0xfe, 0x93,
-  0xd5, 0xf0, 0xbc, 0x19, 0x32, 0x31, 0x38, 0xd0, 0x31, 0x1d, 0xc9, 0x22,
-  0xbf, 0xc1, 0x10, 0xe5, 0x05, 0xa2, 0xd7, 0x62, 0xb2, 0xfd, 0x56, 0x7a,
-  0x28, 0x44, 0xf5, 0x20, 0xac, 0xd5, 0x14, 0xd3, 0xb1, 0xa8, 0x58, 0xdc,
-  0x67, 0x97, 0xc6, 0xc0, 0x1d, 0x3b, 0x2a, 0xe3, 0x07, 0x7c, 0xe7, 0x55,
-  0x2b, 0xf8, 0x1a, 0x3a, 0xae, 0x1f, 0x71, 0x6d, 0xbd, 0x5d, 0x15, 0x55,
-  0x43, 0x53, 0x51, 0x55, 0xca, 0xa6, 0x39, 0x1b, 0x98, 0x00, 0xa0, 0x02,
-  0x37, 0xdf, 0x63, 0x8d, 0x57, 0xb6, 0x55, 0x5c, 0xea, 0xb8, 0x7c, 0x4b,
-  0x79, 0x66, 0x6a, 0x9a, 0xaa, 0xb7, 0xa9, 0x4e, 0x74, 0xe5, 0x72, 0x85,
-  0x55, 0x79, 0x88, 0xec, 0x3c, 0xb8, 0x51, 0xe8, 0x36, 0xd4, 0xd7, 0xda,
-  0x08, 0xea, 0x2d, 0x93, 0x5c, 0xe3, 0x82, 0xeb, 0x70, 0x32, 0xc2, 0x23,
-  0x96, 0x86, 0x8e, 0x53, 0x1a, 0xc7, 0x32, 0xa8, 0x51, 0x3b, 0x91, 0x92,
-  0xcb, 0xca, 0x30, 0x54, 0x2f, 0x5e, 0xe3, 0x59, 0xdf, 0x1a, 0x1c, 0x01,
-  0xba, 0x26, 0xec, 0x5a, 0x8c, 0xeb, 0xad, 0x6c, 0x67, 0x2f, 0x7f, 0x98,
-  0x27, 0xcb, 0x7e, 0x27, 0xd4, 0x9f, 0x47, 0x96, 0x3b, 0x7d, 0xc9, 0x60,
-  0xbc, 0xf1, 0x4d, 0x05, 0xc6, 0xa5, 0x4f, 0x2c, 0x56, 0xfa, 0x69, 0xb9,
-  0x1d, 0xc8, 0xea, 0x09, 0x24, 0x90, 0x3d, 0x86, 0x09, 0xd5, 0x3e, 0x2c,
-  0xa8, 0x22, 0xf6, 0x96, 0xea, 0x78, 0x22, 0xa5, 0xa2, 0xa7, 0x88, 0x98,
-  0x60, 0x89, 0x39, 0x55, 0x72, 0x0e, 0x76, 0xee, 0x7d, 0xce, 0xfa, 0xeb,
-  0x83, 0x78, 0x6e, 0xd3, 0x43, 0x15, 0x2d, 0xe6, 0x79, 0x2b, 0x24, 0xac,
-  0x4f, 0xff, 0x00, 0x0a, 0xa2, 0x94, 0xc3, 0xe0, 0xcb, 0xbf, 0x2b, 0xee,
-  0x7c, 0xeb, 0xb6, 0x41, 0x18, 0xdc, 0x6f, 0xd3, 0x1a, 0xa5, 0x7c, 0x95,
-  0xa5, 0xe2, 0x9a, 0x8e, 0x7d, 0xf9, 0x50, 0x8f, 0xff, 0x00, 0xd6, 0xad,
-  0xa2, 0x4e, 0x95, 0xbe, 0x90, 0x26, 0x6f, 0x18, 0xcc, 0xcf, 0x93, 0xa0,
-  0xe4, 0x2d, 0x5e, 0x94, 0x2f, 0xd0, 0x7e, 0xf3, 0x9b, 0x72, 0x1f, 0xa9,
-  0x45, 0xfe, 0xdd, 0x5a, 0x11, 0x75, 0xd7, 0xb6, 0xf8, 0xb1, 0x4b, 0x1e,
-  0x07, 0xdd, 0xd5, 0x90, 0xbb, 0xf4, 0xd6, 0xeb, 0x9e, 0x35, 0x48, 0x6e,
-  0x9c, 0xb5, 0x35, 0x6f, 0x32, 0x29, 0x01, 0x80, 0xeb, 0xf0, 0xd4, 0x11,
-  0x42, 0x57, 0x39, 0xf5, 0xd5, 0xc7, 0xc6, 0x71, 0xcb, 0xae, 0x42, 0x1c,
-  0xec, 0xba, 0x10, 0x81, 0x2f, 0xdb, 0x22, 0x57, 0xa1, 0x9d, 0x0f, 0xaa,
-  0xb7, 0xea, 0x3f, 0x7d, 0x31, 0xd2, 0x28, 0x6b, 0x4c, 0x78, 0x1b, 0xf2,
-  0x3a, 0x1f, 0xc3, 0x41, 0x2c, 0x6b, 0x83, 0x2a, 0xb0, 0xfb, 0x51, 0x9f,
-  0xcb, 0x7d, 0x30, 0xda, 0x31, 0x25, 0x2b, 0x2f, 0xf4, 0xb6, 0x7f, 0x1d,
-  0x21, 0x86, 0x06, 0xb6, 0x46, 0x12, 0x42, 0x0f, 0x56, 0x1a, 0xb5, 0x28,
-  0x3c, 0xa7, 0x97, 0xae, 0xaa, 0x73, 0x18, 0xaa, 0xd4, 0x63, 0x38, 0x7c,
-  0x7e, 0xda, 0xb8, 0x7a, 0xeb, 0xa7, 0x48, 0xa1, 0x65, 0x69, 0x51, 0xd9,
-  0x79, 0xd0, 0x11, 0xb7, 0x63, 0xa9, 0xad, 0x32, 0x4c, 0x6e, 0x51, 0xa2,
-  0x32, 0x24, 0x7e, 0x20, 0x07, 0x6f, 0x2b, 0x0d, 0xff, 0x00, 0x6d, 0x43,
-  0x34, 0x9c, 0x83, 0x90, 0x00, 0x09, 0xfb, 0x3d, 0xb3, 0xed, 0xf1, 0xd5,
-  0xd9, 0x25, 0x84, 0xc9, 0x47, 0x57, 0x0e, 0xc1, 0x90, 0x64, 0x81, 0xd0,
-  0xae, 0xd8, 0x3a, 0x33, 0xa1, 0xf9, 0x29, 0x69, 0xe8, 0xda, 0x19, 0x66,
-  0x91, 0xc0, 0x79, 0x3c, 0x91, 0x85, 0xdd, 0x9b, 0xd8, 0x7f, 0x7d, 0x43,
-  0x71, 0xa3, 0x59, 0x58, 0xbf, 0xd5, 0x24, 0x32, 0xa9, 0xe6, 0x40, 0xca,
-  0x49, 0x6c, 0x75, 0x3e, 0x87, 0x6f, 0x4d, 0x1b, 0xa7, 0x45, 0xaa, 0x8a,
-  0x07, 0x6e, 0x8d, 0x1b, 0x30, 0x6f, 0x43, 0x91, 0x9d, 0x78, 0x68, 0xe3,
-  0x8a, 0x4f, 0x2f, 0x33, 0x12, 0xc4, 0x96, 0x66, 0x3c, 0xc3, 0xe0, 0x75,
-  0xd5, 0x12, 0xe0, 0x4f, 0xa1, 0x18, 0xdf, 0xff, 0x00, 0x09, 0x5e, 0x56,
-  0x20, 0xcc, 0xc6, 0xa8, 0x72, 0xe0, 0xee, 0x7c, 0x83, 0x61, 0xef, 0x8d,
-  0x31, 0x70, 0x75, 0x2d, 0x4c, 0x57, 0x59, 0x5d, 0xa0, 0x93, 0xc1, 0x0a,
-  0xde, 0x77, 0x0e, 0x02, 0xe7, 0x18, 0x03, 0x9b, 0x1d, 0x7d, 0x31, 0xb7,
-  0xeb, 0x8c, 0xf0, 0xd7, 0x18, 0xdd, 0x6c, 0x54, 0xc6, 0x1b, 0x6a, 0xd2,
-  0xb2, 0xb4, 0xc6, 0x52, 0x66, 0x8f, 0x98, 0x83, 0xcb, 0xca, 0x48, 0xc1,
-  0x1b, 0x63, 0x4d, 0xd6, 0x7e, 0x26, 0xbf, 0x54, 0xd1, 0x88, 0xe7, 0xa2,
-  0xa4, 0xf0, 0x04, 0x6a, 0x88, 0x3c, 0x32, 0xa3, 0x0a, 0x79, 0x86, 0xe5,
-  0xb3, 0xb1, 0xd4, 0xc8, 0xb6, 0x0d, 0xe5, 0x28, 0x1d, 0x95, 0x59, 0x40,
-  0xe6, 0x2c, 0xf1, 0xb3, 0xc5, 0x57, 0xc5, 0xbc, 0x41, 0x4a, 0xc8, 0xea,
-  0x56, 0xb2, 0x55, 0x38, 0x38, 0x24, 0x73, 0x63, 0x20, 0xf4, 0xd2, 0x7c,
-  0xd1, 0x4b, 0x42, 0xce, 0xa9, 0x0d, 0x3a, 0x7d, 0x5c, 0x17, 0x6e, 0x66,
-  0x39, 0x52, 0x70, 0x06, 0x71, 0xd7, 0x03, 0x1f, 0xf3, 0xa6, 0x83, 0x78,
-  0x5a, 0xd7, 0xbc, 0xd4, 0xdd, 0x2a, 0x5e, 0x29, 0x04, 0x85, 0xa6, 0x98,
-  0x21, 0x21, 0x63, 0x27, 0x7c, 0x8c, 0xfc, 0x35, 0x9e, 0x5c, 0x9b, 0xc5,
-  0x80, 0xe5, 0xbc, 0xd5, 0x73, 0xef, 0xbf, 0xdd, 0x1b, 0x9f, 0xd7, 0xf2,
-  0xd3, 0x28, 0xa8, 0xa6, 0xe5, 0x5a, 0x5a, 0x7f, 0x16, 0x78, 0xe9, 0x98,
-  0x44, 0x14, 0xa9, 0x90, 0xf9, 0xce, 0x03, 0x1d, 0xc6, 0xfd, 0xc7, 0xed,
-  0xa3, 0x91, 0x53, 0xac, 0x8e, 0x1c, 0xc5, 0x1a, 0x94, 0x56, 0xe5, 0x2a,
-  0xe7, 0x39, 0xc8, 0xc0, 0xfc, 0x39, 0xbf, 0x01, 0xa1, 0x76, 0xac, 0x49,
-  0x53, 0x34, 0xfb, 0x63, 0x3c, 0xab, 0xf0, 0xd1, 0xba, 0x62, 0x00, 0xea,
-  0x35, 0x4a, 0x88, 0x04, 0x9a, 0xdc, 0x6a, 0x21, 0x9a, 0x19, 0x0c, 0x71,
-  0x29, 0x00, 0xf3, 0x10, 0xf9, 0x20, 0xe4, 0xe3, 0xe5, 0x8c, 0x69, 0x96,
-  0xae, 0xf7, 0x79, 0xa7, 0x48, 0x42, 0xc8, 0x41, 0x68, 0xa3, 0x70, 0x1e,
-  0x4c, 0x91, 0x9e, 0x6e, 0x61, 0xd4, 0xe3, 0xee, 0xf4, 0xf7, 0xd2, 0xfc,
-  0x67, 0x99, 0xc2, 0x82, 0x32, 0x70, 0x3a, 0xe8, 0x9f, 0x10, 0x48, 0xbf,
-  0xc4, 0x9a, 0x35, 0x23, 0x11, 0xa2, 0xa0, 0xdf, 0xd0, 0x68, 0x43, 0x29,
-  0x09, 0xea, 0xea, 0xbf, 0x9f, 0x5f, 0x8f, 0xac, 0xb7, 0xfd, 0xc2, 0x1b,
-  0x23, 0xe4, 0x75, 0x3d, 0x25, 0x4c, 0xd4, 0xb2, 0x78, 0x90, 0xc8, 0x55,
-  0xbd, 0x41, 0xd5, 0x60, 0xc3, 0xd4, 0x7e, 0x3a, 0xf7, 0x98, 0x6f, 0xb8,
-  0xfc, 0x75, 0xd0, 0x88, 0x5a, 0xb6, 0xaa, 0x7a, 0x99, 0x28, 0xc4, 0xd2,
-  0x33, 0x11, 0x18, 0x3b, 0x92, 0x7a, 0x93, 0xa5, 0x02, 0xaf, 0x35, 0xe2,
-  0x79, 0x5b, 0xa9, 0x5f, 0xd8, 0xe9, 0xa3, 0x20, 0xd6, 0xd3, 0xaf, 0x32,
-  0xf9, 0x63, 0x41, 0xd7, 0xdb, 0xfc, 0xe9, 0x75, 0x4e, 0x2e, 0x13, 0x1c,
-  0x8e, 0x87, 0xbf, 0xb6, 0x87, 0x78, 0x47, 0x10, 0xa5, 0x3a, 0x72, 0x53,
-  0x46, 0x07, 0xf4, 0xea, 0x45, 0x4e, 0xfa, 0xf6, 0x98, 0xa9, 0x81, 0x0f,
-  0x32, 0xfd, 0x9f, 0x5d, 0x4e, 0x39, 0x15, 0x7e, 0xd2, 0xef, 0xef, 0xae,
-  0x9c, 0x27, 0x93, 0x53, 0x2a, 0xf8, 0x45, 0x49, 0x3c, 0xc8, 0x18, 0x83,
-  0xeb, 0xae, 0xbc, 0x06, 0x55, 0x05, 0x02, 0x31, 0xe7, 0x50, 0x43, 0x1c,
-  0x0e, 0x5e, 0x61, 0xcc, 0x7e, 0x3c, 0xb9, 0xd4, 0x93, 0xc8, 0xab, 0x14,
-  0x24, 0xba, 0xe4, 0xa6, 0x3a, 0xfb, 0xea, 0x06, 0xa8, 0x1b, 0xf9, 0xd4,
-  0x7c, 0xf5, 0xd3, 0xa7, 0x54, 0x72, 0xd6, 0x45, 0x3a, 0x0f, 0xaa, 0xc2,
-  0xee, 0xc3, 0x18, 0x13, 0x72, 0x80, 0x48, 0x39, 0xce, 0x73, 0xdf, 0x1a,
-  0x29, 0x66, 0xab, 0xad, 0x46, 0x95, 0x60, 0xa3, 0x49, 0xc1, 0x60, 0x39,
-  0x7c, 0x60, 0xad, 0xcb, 0xce, 0x46, 0x7d, 0x36, 0x5d, 0xcf, 0xc7, 0x03,
-  0x41, 0xa3, 0xaa, 0x55, 0xa8, 0x46, 0x2e, 0xbb, 0x30, 0xfb, 0xde, 0xfa,
-  0x25, 0x60, 0xaa, 0x48, 0xf8, 0x80, 0xc2, 0x5d, 0x7c, 0xc5, 0x97, 0xed,
-  0x0d, 0x0a, 0x82, 0xa5, 0x6b, 0x84, 0xd5, 0x49, 0x52, 0xab, 0x51, 0x4f,
-  0x14, 0x4f, 0x90, 0xd3, 0x62, 0x4c, 0xf2, 0x92, 0xa0, 0x9e, 0x51, 0xfe,
-  0xec, 0x8e, 0xa7, 0xa7, 0xbe, 0xac, 0x53, 0xcf, 0x54, 0xf1, 0xb1, 0x9a,
-  0x04, 0x56, 0x0a, 0x4a, 0x94, 0x93, 0x21, 0xb7, 0xd8, 0x74, 0xdb, 0x6e,
-  0xfa, 0xaf, 0xc6, 0xcc, 0x90, 0xdc, 0x83, 0x09, 0x13, 0xce, 0x9e, 0xbe,
-  0x9a, 0xea, 0xdf, 0x51, 0x1c, 0x94, 0x51, 0x3f, 0x8a, 0x9f, 0x67, 0x07,
-  0xcd, 0xa3, 0x5b, 0x43, 0x3e, 0x5a, 0xab, 0x8b, 0x73, 0x83, 0x6c, 0x55,
-  0x20, 0x9e, 0x52, 0xd5, 0x0a, 0x54, 0x8c, 0x6c, 0x7d, 0x77, 0xe9, 0x8d,
-  0x10, 0x79, 0xea, 0x9e, 0xd5, 0xc9, 0x15, 0x10, 0x63, 0x15, 0x49, 0x3c,
-  0xa6, 0x65, 0x04, 0x47, 0x86, 0xc3, 0x83, 0xd3, 0xed, 0x72, 0xed, 0xe8,
-  0x4e, 0xab, 0x89, 0x63, 0x1f, 0xfa, 0x89, 0xff, 0x00, 0xb8, 0x6a, 0xc5,
-  0x04, 0xd1, 0x7d, 0x63, 0xc3, 0x32, 0xc7, 0x89, 0x54, 0xa7, 0xda, 0x1d,
-  0xc6, 0xdf, 0x9e, 0x34, 0x2a, 0x08, 0x76, 0xc7, 0x76, 0xbf, 0xd4, 0xdb,
-  0xc5, 0x35, 0x3d, 0x95, 0x04, 0x91, 0xbb, 0x95, 0x26, 0x55, 0x75, 0x23,
-  0x94, 0xe3, 0x27, 0x6e, 0x5c, 0x9c, 0x0c, 0x7b, 0x9f, 0x4d, 0x37, 0x55,
-  0x46, 0xa5, 0xc6, 0x07, 0x31, 0x0d, 0x9c, 0xe7, 0x00, 0x0f, 0x53, 0xa4,
-  0xfe, 0x11, 0xaf, 0x8e, 0x0a, 0xc1, 0x1b, 0x4d, 0x18, 0x0e, 0x39, 0x77,
-  0x71, 0xd7, 0xfe, 0x7e, 0xba, 0x73, 0x8e, 0x5a, 0x6e, 0x63, 0xfc, 0xe8,
-  0x70, 0xdb, 0x9f, 0x38, 0xef, 0xa6, 0x03, 0x68, 0xa7, 0x63, 0x3f, 0xff,
-  0xd9
-};
\ No newline at end of file
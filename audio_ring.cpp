@@ -0,0 +1,30 @@
+#include "audio_ring.h"
+
+#include <algorithm>
+#include <cstring>
+
+size_t AudioRing::Write(const int16_t *in, size_t n) {
+  size_t write = write_.load(std::memory_order_relaxed);
+  size_t read = read_.load(std::memory_order_acquire);
+  n = std::min(n, kFrames - (write - read));
+
+  size_t pos = write % kFrames;
+  size_t first = std::min(n, kFrames - pos);
+  std::memcpy(&data_[pos * 2], in, first * 2 * sizeof(int16_t));
+  std::memcpy(&data_[0], in + first * 2, (n - first) * 2 * sizeof(int16_t));
+  write_.store(write + n, std::memory_order_release);
+  return n;
+}
+
+size_t AudioRing::Read(int16_t *out, size_t n) {
+  size_t read = read_.load(std::memory_order_relaxed);
+  size_t write = write_.load(std::memory_order_acquire);
+  n = std::min(n, write - read);
+
+  size_t pos = read % kFrames;
+  size_t first = std::min(n, kFrames - pos);
+  std::memcpy(out, &data_[pos * 2], first * 2 * sizeof(int16_t));
+  std::memcpy(out + first * 2, &data_[0], (n - first) * 2 * sizeof(int16_t));
+  read_.store(read + n, std::memory_order_release);
+  return n;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Interleaved stereo frames passed from the emulation thread to the audio
+// device callback. One producer and one consumer, neither side locks or
+// waits, a full ring drops what doesn't fit and an empty one reads short.
+class AudioRing {
+ public:
+  static constexpr size_t kFrames = 4096;
+
+  // Producer side, returns the frames written.
+  size_t Write(const int16_t *in, size_t n);
+  // Consumer side, returns the frames read.
+  size_t Read(int16_t *out, size_t n);
+  // Frames buffered, exact on the consumer side and an upper bound on the
+  // producer side.
+  size_t GetFill() const {
+    return write_.load(std::memory_order_acquire) -
+           read_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  // Positions count frames and only grow, the slot is position % kFrames.
+  alignas(64) std::atomic<size_t> read_ = 0;
+  alignas(64) std::atomic<size_t> write_ = 0;
+  alignas(64) std::array<int16_t, kFrames * 2> data_;
+};
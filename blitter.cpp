@@ -1,13 +1,67 @@
 #include "blitter.h"
 
-#include <emmintrin.h>
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
 
 #include "sh3.h"
 
+Blitter::Isa Blitter::DetectIsa() {
+#if defined(_MSC_VER) && !defined(__clang__)
+  int info[4];
+  __cpuid(info, 1);
+  if (!(info[2] & (1 << 27))) return kSse2;  // OSXSAVE
+  uint64_t xcr0 = _xgetbv(0);
+  __cpuidex(info, 7, 0);
+  bool avx2 = (info[1] & (1 << 5)) && (xcr0 & 0x06) == 0x06;
+  bool avx512 = (info[1] & (1 << 16)) && (info[1] & (1 << 30)) &&
+                (xcr0 & 0xe6) == 0xe6;
+  return avx512 ? kAvx512 : avx2 ? kAvx2 : kSse2;
+#else
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512bw")) return kAvx512;
+  if (__builtin_cpu_supports("avx2")) return kAvx2;
+  return kSse2;
+#endif
+}
+
+const char *Blitter::GetIsaName(Isa isa) {
+  static const char *const kNames[kIsaCount] = {"SSE2", "AVX2", "AVX-512BW"};
+  return kNames[isa];
+}
+
+bool Blitter::SetIsa(Isa isa) {
+  if (isa < kSse2 || isa > DetectIsa()) return false;
+  draw_table_ = &kDrawTables[isa];
+  return true;
+}
+
 Blitter::Blitter(std::span<uint8_t> ram, counters::Counters &c)
-    : ram_(ram), blitting_(false), counters(c) {
+    : blitting_(false),
+      counters(c),
+      ram_(ram),
+      back_(2),
+      last_(1),
+      ready_(1),
+      front_(0),
+      batch_pixels_(0),
+      band_height_(0),
+      workers_running_(false),
+      work_id_(0),
+      work_left_(0),
+      stats_(nullptr),
+      capture_frames_(0),
+      busy_ns_(0) {
+  draw_table_ = &kDrawTables[DetectIsa()];
   gpu_.fill(0xff);
+  vram_dirty_.fill(0);
   gpu_regs_.fill(0);
+  for (auto &screen : screen_) screen.fill(0);
 
   v_sync_ =
       new counters::Counter(counters::Counter::kEnable,
@@ -25,16 +79,32 @@ Blitter::~Blitter() {
   running_ = false;
   blit_cv_.notify_one();
   blit_thread_->join();
+  StopWorkers();
   delete v_sync_;
   delete blit_irq_;
 }
 
+// Flags the pages of the rows a rectangle covers, a row past the right
+// edge runs on into the next one as the writes do.
+void Blitter::MarkDirty(int32_t x, int32_t y, int32_t w, int32_t h) {
+  constexpr int64_t kRow = kSizeX * 2;
+  for (int64_t row = y * kRow; h > 0; h--, row += kRow) {
+    int64_t begin = std::max<int64_t>(row + x * 2, 0);
+    int64_t end = std::min<int64_t>(row + (x + w) * 2, kVramSize);
+    if (begin < end) {
+      std::memset(&vram_dirty_[begin >> kDirtyShift], 1,
+                  ((end - 1) >> kDirtyShift) - (begin >> kDirtyShift) + 1);
+    }
+  }
+}
+
 void Blitter::Upload(uint32_t &addr) {
   addr += 6;
   uint32_t x_start = Next16(addr) & 0x1fff;
   uint32_t y_start = Next16(addr) & 0x0fff;
   uint32_t dimx = (Next16(addr) & 0x1fff) + 1;
   uint32_t dimy = (Next16(addr) & 0x0fff) + 1;
+  MarkDirty(x_start, y_start, dimx, dimy);
 
   for (uint32_t y = 0; y < dimy; y++) {
     uint16_t *dst = (uint16_t *)&gpu_[(y_start + y) * kSizeX * 2];
@@ -185,6 +255,388 @@ void Blitter::Block16(uint16_t **d_mem, uint16_t **s_mem, int blocks16,
   }
 }
 
+template <int simple, int blend, int flip_x, int tined, int transparent,
+          int s_mode, int d_mode>
+BLITTER_TARGET("avx512f,avx512bw")
+void Blitter::Block512(uint16_t **d_mem, uint16_t **s_mem, int pixels,
+                       uint8_t src_alpha, uint8_t dst_alpha, uint32_t tine) {
+  if (pixels <= 0) return;
+
+  __m512i mask_ff;
+  __m512i source_alpha;
+  __m512i dest_alpha;
+  __m512i tine_red;
+  __m512i tine_green;
+  __m512i tine_blue;
+  __m512i reverse;
+
+  mask_ff = _mm512_set1_epi16(0xff);
+
+  if constexpr (blend) {
+    if constexpr (s_mode == 0) {
+      source_alpha = _mm512_set1_epi16(src_alpha);
+    } else if constexpr (s_mode == 4) {
+      source_alpha = _mm512_xor_si512(_mm512_set1_epi16(src_alpha), mask_ff);
+    }
+
+    if constexpr (d_mode == 0) {
+      dest_alpha = _mm512_set1_epi16(dst_alpha);
+    } else if constexpr (d_mode == 4) {
+      dest_alpha = _mm512_xor_si512(_mm512_set1_epi16(dst_alpha), mask_ff);
+    }
+  }
+
+  if constexpr (flip_x) {
+    reverse = _mm512_set_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+                               14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+                               26, 27, 28, 29, 30, 31);
+  }
+
+  if constexpr (tined) {
+    tine_red = _mm512_set1_epi16((tine >> 16) & 0xff);
+    tine_green = _mm512_set1_epi16((tine >> 8) & 0xff);
+    tine_blue = _mm512_set1_epi16((tine >> 0) & 0xff);
+  }
+
+  // The row tail is handled by masking the last block, so there is no
+  // scalar loop as in Block16.
+  while (pixels > 0) {
+    int n = pixels < 32 ? pixels : 32;
+    __mmask32 mask = n < 32 ? (1u << n) - 1 : 0xffffffffu;
+    __m512i source;
+    __m512i dest;
+    if constexpr (flip_x) {
+      (*s_mem) -= n;
+      source = _mm512_maskz_loadu_epi16(mask, *s_mem);
+      source = _mm512_permutexvar_epi16(
+          _mm512_add_epi16(reverse, _mm512_set1_epi16(n - 32)), source);
+    } else {
+      source = _mm512_maskz_loadu_epi16(mask, *s_mem);
+      (*s_mem) += n;
+    }
+
+    if constexpr (blend) {
+      dest = _mm512_maskz_loadu_epi16(mask, *d_mem);
+    }
+
+    if constexpr (!simple) {
+      __m512i s_red = _mm512_and_si512(
+          _mm512_slli_epi16(_mm512_srli_epi16(source, 10), 3), mask_ff);
+      __m512i s_green = _mm512_and_si512(
+          _mm512_slli_epi16(_mm512_srli_epi16(source, 5), 3), mask_ff);
+      __m512i s_blue = _mm512_and_si512(_mm512_slli_epi16(source, 3), mask_ff);
+      __m512i s_alpha = _mm512_slli_epi16(_mm512_srli_epi16(source, 15), 15);
+
+      if constexpr (tined) {
+        s_red = _mm512_srli_epi16(_mm512_mullo_epi16(s_red, tine_red), 7);
+        s_green = _mm512_srli_epi16(_mm512_mullo_epi16(s_green, tine_green), 7);
+        s_blue = _mm512_srli_epi16(_mm512_mullo_epi16(s_blue, tine_blue), 7);
+      }
+
+      if constexpr (blend) {
+        if constexpr (tined) {
+          s_red = _mm512_min_epi16(s_red, mask_ff);
+          s_green = _mm512_min_epi16(s_green, mask_ff);
+          s_blue = _mm512_min_epi16(s_blue, mask_ff);
+        }
+
+        __m512i d_red = _mm512_and_si512(
+            _mm512_slli_epi16(_mm512_srli_epi16(dest, 10), 3), mask_ff);
+        __m512i d_green = _mm512_and_si512(
+            _mm512_slli_epi16(_mm512_srli_epi16(dest, 5), 3), mask_ff);
+        __m512i d_blue = _mm512_and_si512(_mm512_slli_epi16(dest, 3), mask_ff);
+
+        __m512i pm_s_red;
+        __m512i pm_s_green;
+        __m512i pm_s_blue;
+        __m512i pm_d_red;
+        __m512i pm_d_green;
+        __m512i pm_d_blue;
+
+        if constexpr (d_mode == 0 || d_mode == 4) {
+          pm_d_red = _mm512_mullo_epi16(d_red, dest_alpha);
+          pm_d_green = _mm512_mullo_epi16(d_green, dest_alpha);
+          pm_d_blue = _mm512_mullo_epi16(d_blue, dest_alpha);
+        } else if constexpr (d_mode == 1) {
+          pm_d_red = _mm512_mullo_epi16(d_red, s_red);
+          pm_d_green = _mm512_mullo_epi16(d_green, s_green);
+          pm_d_blue = _mm512_mullo_epi16(d_blue, s_blue);
+        } else if constexpr (d_mode == 2) {
+          pm_d_red = _mm512_mullo_epi16(d_red, d_red);
+          pm_d_green = _mm512_mullo_epi16(d_green, d_green);
+          pm_d_blue = _mm512_mullo_epi16(d_blue, d_blue);
+        } else if constexpr (d_mode == 3 || d_mode == 7) {
+          pm_d_red = _mm512_mullo_epi16(d_red, mask_ff);
+          pm_d_green = _mm512_mullo_epi16(d_green, mask_ff);
+          pm_d_blue = _mm512_mullo_epi16(d_blue, mask_ff);
+        } else if constexpr (d_mode == 5) {
+          pm_d_red =
+              _mm512_mullo_epi16(d_red, _mm512_xor_si512(s_red, mask_ff));
+          pm_d_green =
+              _mm512_mullo_epi16(d_green, _mm512_xor_si512(s_green, mask_ff));
+          pm_d_blue =
+              _mm512_mullo_epi16(d_blue, _mm512_xor_si512(s_blue, mask_ff));
+        } else if constexpr (d_mode == 6) {
+          pm_d_red =
+              _mm512_mullo_epi16(d_red, _mm512_xor_si512(d_red, mask_ff));
+          pm_d_green =
+              _mm512_mullo_epi16(d_green, _mm512_xor_si512(d_green, mask_ff));
+          pm_d_blue =
+              _mm512_mullo_epi16(d_blue, _mm512_xor_si512(d_blue, mask_ff));
+        }
+
+        if constexpr (s_mode == 0 || s_mode == 4) {
+          pm_s_red = _mm512_mullo_epi16(s_red, source_alpha);
+          pm_s_green = _mm512_mullo_epi16(s_green, source_alpha);
+          pm_s_blue = _mm512_mullo_epi16(s_blue, source_alpha);
+        } else if constexpr (s_mode == 1) {
+          pm_s_red = _mm512_mullo_epi16(s_red, s_red);
+          pm_s_green = _mm512_mullo_epi16(s_green, s_green);
+          pm_s_blue = _mm512_mullo_epi16(s_blue, s_blue);
+        } else if constexpr (s_mode == 2) {
+          pm_s_red = _mm512_mullo_epi16(s_red, d_red);
+          pm_s_green = _mm512_mullo_epi16(s_green, d_green);
+          pm_s_blue = _mm512_mullo_epi16(s_blue, d_blue);
+        } else if constexpr (s_mode == 3 || s_mode == 7) {
+          pm_s_red = _mm512_mullo_epi16(s_red, mask_ff);
+          pm_s_green = _mm512_mullo_epi16(s_green, mask_ff);
+          pm_s_blue = _mm512_mullo_epi16(s_blue, mask_ff);
+        } else if constexpr (s_mode == 5) {
+          pm_s_red =
+              _mm512_mullo_epi16(s_red, _mm512_xor_si512(s_red, mask_ff));
+          pm_s_green =
+              _mm512_mullo_epi16(s_green, _mm512_xor_si512(s_green, mask_ff));
+          pm_s_blue =
+              _mm512_mullo_epi16(s_blue, _mm512_xor_si512(s_blue, mask_ff));
+        } else if constexpr (s_mode == 6) {
+          pm_s_red =
+              _mm512_mullo_epi16(s_red, _mm512_xor_si512(d_red, mask_ff));
+          pm_s_green =
+              _mm512_mullo_epi16(s_green, _mm512_xor_si512(d_green, mask_ff));
+          pm_s_blue =
+              _mm512_mullo_epi16(s_blue, _mm512_xor_si512(d_blue, mask_ff));
+        }
+
+        s_red = _mm512_srli_epi16(_mm512_adds_epu16(pm_s_red, pm_d_red), 11);
+        s_green =
+            _mm512_srli_epi16(_mm512_adds_epu16(pm_s_green, pm_d_green), 11);
+        s_blue = _mm512_srli_epi16(_mm512_adds_epu16(pm_s_blue, pm_d_blue), 11);
+      } else {
+        s_red = _mm512_srli_epi16(s_red, 3);
+        s_green = _mm512_srli_epi16(s_green, 3);
+        s_blue = _mm512_srli_epi16(s_blue, 3);
+      }
+      __m512i mask_1f = _mm512_srli_epi16(mask_ff, 3);
+      s_red = _mm512_min_epi16(s_red, mask_1f);
+      s_green = _mm512_min_epi16(s_green, mask_1f);
+      s_blue = _mm512_min_epi16(s_blue, mask_1f);
+
+      s_red = _mm512_slli_epi16(s_red, 10);
+      s_green = _mm512_slli_epi16(s_green, 5);
+      source = _mm512_or_si512(
+          s_alpha, _mm512_or_si512(s_blue, _mm512_or_si512(s_red, s_green)));
+    }
+
+    if constexpr (transparent) {
+      mask &= _mm512_movepi16_mask(source);
+    }
+    _mm512_mask_storeu_epi16(*d_mem, mask, source);
+    (*d_mem) += n;
+    pixels -= n;
+  }
+}
+
+template <int simple, int blend, int flip_x, int tined, int transparent,
+          int s_mode, int d_mode>
+BLITTER_TARGET("avx2")
+void Blitter::Block256(uint16_t **d_mem, uint16_t **s_mem, int blocks256,
+                       uint8_t src_alpha, uint8_t dst_alpha, uint32_t tine) {
+  if (blocks256 <= 0) return;
+
+  __m256i mask_ff;
+  __m256i source_alpha;
+  __m256i dest_alpha;
+  __m256i tine_red;
+  __m256i tine_green;
+  __m256i tine_blue;
+  __m256i reverse;
+
+  mask_ff = _mm256_set1_epi16(0xff);
+
+  if constexpr (blend) {
+    if constexpr (s_mode == 0) {
+      source_alpha = _mm256_set1_epi16(src_alpha);
+    } else if constexpr (s_mode == 4) {
+      source_alpha = _mm256_xor_si256(_mm256_set1_epi16(src_alpha), mask_ff);
+    }
+
+    if constexpr (d_mode == 0) {
+      dest_alpha = _mm256_set1_epi16(dst_alpha);
+    } else if constexpr (d_mode == 4) {
+      dest_alpha = _mm256_xor_si256(_mm256_set1_epi16(dst_alpha), mask_ff);
+    }
+  }
+
+  if constexpr (flip_x) {
+    reverse = _mm256_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3,
+                               0, 1, 14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5,
+                               2, 3, 0, 1);
+  }
+
+  if constexpr (tined) {
+    tine_red = _mm256_set1_epi16((tine >> 16) & 0xff);
+    tine_green = _mm256_set1_epi16((tine >> 8) & 0xff);
+    tine_blue = _mm256_set1_epi16((tine >> 0) & 0xff);
+  }
+
+  while (blocks256--) {
+    __m256i source;
+    __m256i dest;
+    if constexpr (flip_x) {
+      (*s_mem) -= 16;
+      source = _mm256_loadu_si256(reinterpret_cast<__m256i *>(*s_mem));
+      source = _mm256_shuffle_epi8(source, reverse);
+      source = _mm256_permute2x128_si256(source, source, 0x01);
+    } else {
+      source = _mm256_loadu_si256(reinterpret_cast<__m256i *>(*s_mem));
+      (*s_mem) += 16;
+    }
+
+    if constexpr (transparent) {
+      dest = _mm256_loadu_si256(reinterpret_cast<__m256i *>(*d_mem));
+    }
+
+    if constexpr (!simple) {
+      __m256i s_red = _mm256_and_si256(
+          _mm256_slli_epi16(_mm256_srli_epi16(source, 10), 3), mask_ff);
+      __m256i s_green = _mm256_and_si256(
+          _mm256_slli_epi16(_mm256_srli_epi16(source, 5), 3), mask_ff);
+      __m256i s_blue = _mm256_and_si256(_mm256_slli_epi16(source, 3), mask_ff);
+      __m256i s_alpha = _mm256_slli_epi16(_mm256_srli_epi16(source, 15), 15);
+
+      if constexpr (tined) {
+        s_red = _mm256_srli_epi16(_mm256_mullo_epi16(s_red, tine_red), 7);
+        s_green = _mm256_srli_epi16(_mm256_mullo_epi16(s_green, tine_green), 7);
+        s_blue = _mm256_srli_epi16(_mm256_mullo_epi16(s_blue, tine_blue), 7);
+      }
+
+      if constexpr (blend) {
+        if constexpr (!transparent) {
+          dest = _mm256_loadu_si256(reinterpret_cast<__m256i *>(*d_mem));
+        }
+
+        if constexpr (tined) {
+          s_red = _mm256_min_epi16(s_red, mask_ff);
+          s_green = _mm256_min_epi16(s_green, mask_ff);
+          s_blue = _mm256_min_epi16(s_blue, mask_ff);
+        }
+
+        __m256i d_red = _mm256_and_si256(
+            _mm256_slli_epi16(_mm256_srli_epi16(dest, 10), 3), mask_ff);
+        __m256i d_green = _mm256_and_si256(
+            _mm256_slli_epi16(_mm256_srli_epi16(dest, 5), 3), mask_ff);
+        __m256i d_blue = _mm256_and_si256(_mm256_slli_epi16(dest, 3), mask_ff);
+
+        __m256i pm_s_red;
+        __m256i pm_s_green;
+        __m256i pm_s_blue;
+        __m256i pm_d_red;
+        __m256i pm_d_green;
+        __m256i pm_d_blue;
+
+        if constexpr (d_mode == 0 || d_mode == 4) {
+          pm_d_red = _mm256_mullo_epi16(d_red, dest_alpha);
+          pm_d_green = _mm256_mullo_epi16(d_green, dest_alpha);
+          pm_d_blue = _mm256_mullo_epi16(d_blue, dest_alpha);
+        } else if constexpr (d_mode == 1) {
+          pm_d_red = _mm256_mullo_epi16(d_red, s_red);
+          pm_d_green = _mm256_mullo_epi16(d_green, s_green);
+          pm_d_blue = _mm256_mullo_epi16(d_blue, s_blue);
+        } else if constexpr (d_mode == 2) {
+          pm_d_red = _mm256_mullo_epi16(d_red, d_red);
+          pm_d_green = _mm256_mullo_epi16(d_green, d_green);
+          pm_d_blue = _mm256_mullo_epi16(d_blue, d_blue);
+        } else if constexpr (d_mode == 3 || d_mode == 7) {
+          pm_d_red = _mm256_mullo_epi16(d_red, mask_ff);
+          pm_d_green = _mm256_mullo_epi16(d_green, mask_ff);
+          pm_d_blue = _mm256_mullo_epi16(d_blue, mask_ff);
+        } else if constexpr (d_mode == 5) {
+          pm_d_red =
+              _mm256_mullo_epi16(d_red, _mm256_xor_si256(s_red, mask_ff));
+          pm_d_green =
+              _mm256_mullo_epi16(d_green, _mm256_xor_si256(s_green, mask_ff));
+          pm_d_blue =
+              _mm256_mullo_epi16(d_blue, _mm256_xor_si256(s_blue, mask_ff));
+        } else if constexpr (d_mode == 6) {
+          pm_d_red =
+              _mm256_mullo_epi16(d_red, _mm256_xor_si256(d_red, mask_ff));
+          pm_d_green =
+              _mm256_mullo_epi16(d_green, _mm256_xor_si256(d_green, mask_ff));
+          pm_d_blue =
+              _mm256_mullo_epi16(d_blue, _mm256_xor_si256(d_blue, mask_ff));
+        }
+
+        if constexpr (s_mode == 0 || s_mode == 4) {
+          pm_s_red = _mm256_mullo_epi16(s_red, source_alpha);
+          pm_s_green = _mm256_mullo_epi16(s_green, source_alpha);
+          pm_s_blue = _mm256_mullo_epi16(s_blue, source_alpha);
+        } else if constexpr (s_mode == 1) {
+          pm_s_red = _mm256_mullo_epi16(s_red, s_red);
+          pm_s_green = _mm256_mullo_epi16(s_green, s_green);
+          pm_s_blue = _mm256_mullo_epi16(s_blue, s_blue);
+        } else if constexpr (s_mode == 2) {
+          pm_s_red = _mm256_mullo_epi16(s_red, d_red);
+          pm_s_green = _mm256_mullo_epi16(s_green, d_green);
+          pm_s_blue = _mm256_mullo_epi16(s_blue, d_blue);
+        } else if constexpr (s_mode == 3 || s_mode == 7) {
+          pm_s_red = _mm256_mullo_epi16(s_red, mask_ff);
+          pm_s_green = _mm256_mullo_epi16(s_green, mask_ff);
+          pm_s_blue = _mm256_mullo_epi16(s_blue, mask_ff);
+        } else if constexpr (s_mode == 5) {
+          pm_s_red =
+              _mm256_mullo_epi16(s_red, _mm256_xor_si256(s_red, mask_ff));
+          pm_s_green =
+              _mm256_mullo_epi16(s_green, _mm256_xor_si256(s_green, mask_ff));
+          pm_s_blue =
+              _mm256_mullo_epi16(s_blue, _mm256_xor_si256(s_blue, mask_ff));
+        } else if constexpr (s_mode == 6) {
+          pm_s_red =
+              _mm256_mullo_epi16(s_red, _mm256_xor_si256(d_red, mask_ff));
+          pm_s_green =
+              _mm256_mullo_epi16(s_green, _mm256_xor_si256(d_green, mask_ff));
+          pm_s_blue =
+              _mm256_mullo_epi16(s_blue, _mm256_xor_si256(d_blue, mask_ff));
+        }
+
+        s_red = _mm256_srli_epi16(_mm256_adds_epu16(pm_s_red, pm_d_red), 11);
+        s_green =
+            _mm256_srli_epi16(_mm256_adds_epu16(pm_s_green, pm_d_green), 11);
+        s_blue = _mm256_srli_epi16(_mm256_adds_epu16(pm_s_blue, pm_d_blue), 11);
+      } else {
+        s_red = _mm256_srli_epi16(s_red, 3);
+        s_green = _mm256_srli_epi16(s_green, 3);
+        s_blue = _mm256_srli_epi16(s_blue, 3);
+      }
+      __m256i mask_1f = _mm256_srli_epi16(mask_ff, 3);
+      s_red = _mm256_min_epi16(s_red, mask_1f);
+      s_green = _mm256_min_epi16(s_green, mask_1f);
+      s_blue = _mm256_min_epi16(s_blue, mask_1f);
+
+      s_red = _mm256_slli_epi16(s_red, 10);
+      s_green = _mm256_slli_epi16(s_green, 5);
+      source = _mm256_or_si256(
+          s_alpha, _mm256_or_si256(s_blue, _mm256_or_si256(s_red, s_green)));
+    }
+
+    if constexpr (transparent) {
+      __m256i tr_mask = _mm256_cmpgt_epi16(_mm256_setzero_si256(), source);
+      source = _mm256_blendv_epi8(dest, source, tr_mask);
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(*d_mem), source);
+    (*d_mem) += 16;
+  }
+}
+
 template <int simple, int blend, int flip_x, int tined, int transparent,
           int s_mode, int d_mode>
 void Blitter::Block128(uint16_t **d_mem, uint16_t **s_mem, int blocks128,
@@ -362,11 +814,12 @@ void Blitter::Block128(uint16_t **d_mem, uint16_t **s_mem, int blocks128,
   }
 }
 
-template <int simple, int blend, int flip_x, int tined, int transparent,
-          int s_mode, int d_mode>
+template <int isa, int simple, int blend, int flip_x, int tined,
+          int transparent, int s_mode, int d_mode>
 void Blitter::Draw(int32_t src_x, int32_t src_y, int32_t x_start,
                    int32_t y_start, int32_t dimx, int32_t dimy, uint32_t flip_y,
-                   uint8_t src_alpha, uint8_t dst_alpha, uint32_t tine) {
+                   uint8_t src_alpha, uint8_t dst_alpha, uint32_t tine,
+                   const Clip &clip) {
   int y, yf;
 
   if constexpr (flip_x) {
@@ -383,9 +836,9 @@ void Blitter::Draw(int32_t src_x, int32_t src_y, int32_t x_start,
   int starty = 0;
   const int y_end = y_start + dimy;
 
-  if (y_start < clip_.min_y) starty = clip_.min_y - y_start;
+  if (y_start < clip.min_y) starty = clip.min_y - y_start;
 
-  if (y_end > clip_.max_y) dimy -= (y_end - 1) - clip_.max_y;
+  if (y_end > clip.max_y) dimy -= (y_end - 1) - clip.max_y;
 
   if constexpr (flip_x) {
     if ((src_x & 0x1fff) < ((src_x - (dimx - 1)) & 0x1fff)) {
@@ -400,9 +853,9 @@ void Blitter::Draw(int32_t src_x, int32_t src_y, int32_t x_start,
   int startx = 0;
   const int x_end = x_start + dimx;
 
-  if (x_start < clip_.min_x) startx = clip_.min_x - x_start;
+  if (x_start < clip.min_x) startx = clip.min_x - x_start;
 
-  if (x_end > clip_.max_x) dimx -= (x_end - 1) - clip_.max_x;
+  if (x_end > clip.max_x) dimx -= (x_end - 1) - clip.max_x;
 
   for (y = starty; y < dimy; y++) {
     uint16_t *d_mem =
@@ -420,6 +873,18 @@ void Blitter::Draw(int32_t src_x, int32_t src_y, int32_t x_start,
 
     if (width <= 0) return;
 
+    if constexpr (isa == kAvx512) {
+      Block512<simple, blend, flip_x, tined, transparent, s_mode, d_mode>(
+          &d_mem, &s_mem, width, src_alpha, dst_alpha, tine);
+      continue;
+    }
+
+    if constexpr (isa == kAvx2) {
+      Block256<simple, blend, flip_x, tined, transparent, s_mode, d_mode>(
+          &d_mem, &s_mem, width >> 4, src_alpha, dst_alpha, tine);
+      width &= 15;
+    }
+
     Block128<simple, blend, flip_x, tined, transparent, s_mode, d_mode>(
         &d_mem, &s_mem, width >> 3, src_alpha, dst_alpha, tine);
 
@@ -428,6 +893,42 @@ void Blitter::Draw(int32_t src_x, int32_t src_y, int32_t x_start,
   }
 }
 
+template <int isa, int flip_x, int tined, int transparent, size_t... mode>
+constexpr std::array<Blitter::DrawMode, 64> Blitter::MakeBlendModes(
+    std::index_sequence<mode...>) {
+  return {&Blitter::Draw<isa, 0, 1, flip_x, tined, transparent, (mode & 7),
+                         (mode >> 3)>...};
+}
+
+template <int isa>
+constexpr Blitter::DrawTable Blitter::MakeDrawTable() {
+  constexpr auto modes = std::make_index_sequence<64>();
+  return {
+      {{{MakeBlendModes<isa, 0, 0, 0>(modes),
+         MakeBlendModes<isa, 0, 0, 1>(modes)},
+        {MakeBlendModes<isa, 0, 1, 0>(modes),
+         MakeBlendModes<isa, 0, 1, 1>(modes)}},
+       {{MakeBlendModes<isa, 1, 0, 0>(modes),
+         MakeBlendModes<isa, 1, 0, 1>(modes)},
+        {MakeBlendModes<isa, 1, 1, 0>(modes),
+         MakeBlendModes<isa, 1, 1, 1>(modes)}}},
+      {{{&Blitter::Draw<isa, 1, 0, 0, 0, 0, 0, 0>,
+         &Blitter::Draw<isa, 1, 0, 0, 0, 1, 0, 0>},
+        {&Blitter::Draw<isa, 0, 0, 0, 1, 0, 0, 0>,
+         &Blitter::Draw<isa, 0, 0, 0, 1, 1, 0, 0>}},
+       {{&Blitter::Draw<isa, 1, 0, 1, 0, 0, 0, 0>,
+         &Blitter::Draw<isa, 1, 0, 1, 0, 1, 0, 0>},
+        {&Blitter::Draw<isa, 0, 0, 1, 1, 0, 0, 0>,
+         &Blitter::Draw<isa, 0, 0, 1, 1, 1, 0, 0>}}},
+  };
+}
+
+const Blitter::DrawTable Blitter::kDrawTables[kIsaCount] = {
+    MakeDrawTable<kSse2>(),
+    MakeDrawTable<kAvx2>(),
+    MakeDrawTable<kAvx512>(),
+};
+
 void Blitter::Draw(uint32_t &addr) {
   int32_t attribute = Next16(addr);
   int32_t alpha = Next16(addr);
@@ -467,112 +968,53 @@ void Blitter::Draw(uint32_t &addr) {
     blend = 0;
   }
 
-  if (tinted) {
-    if (!flip_x) {
-      if (transparent) {
-        if (!blend) {
-          Draw<0, 0, 0, 1, 1, 0, 0>(src_x, src_y, x, y, dimx, dimy, flip_y,
-                                    s_alpha, d_alpha, tine);
-        } else {
-          (this->*DrawNonFlipTinedTransparentBlend[s_mode | (d_mode << 3)])(
-              src_x, src_y, x, y, dimx, dimy, flip_y, s_alpha, d_alpha, tine);
-        }
-      } else {
-        if (!blend) {
-          Draw<0, 0, 0, 1, 0, 0, 0>(src_x, src_y, x, y, dimx, dimy, flip_y,
-                                    s_alpha, d_alpha, tine);
-        } else {
-          (this->*DrawNonFlipTinedNonTransparentBlend[s_mode | (d_mode << 3)])(
-              src_x, src_y, x, y, dimx, dimy, flip_y, s_alpha, d_alpha, tine);
-        }
-      }
-    } else {
-      if (transparent) {
-        if (!blend) {
-          Draw<0, 0, 1, 1, 1, 0, 0>(src_x, src_y, x, y, dimx, dimy, flip_y,
-                                    s_alpha, d_alpha, tine);
-        } else {
-          (this->*DrawFlipTinedTransparentBlend[s_mode | (d_mode << 3)])(
-              src_x, src_y, x, y, dimx, dimy, flip_y, s_alpha, d_alpha, tine);
-        }
-      } else {
-        if (!blend) {
-          Draw<0, 0, 1, 1, 0, 0, 0>(src_x, src_y, x, y, dimx, dimy, flip_y,
-                                    s_alpha, d_alpha, tine);
-        } else {
-          (this->*DrawFlipTinedNonTransparentBlend[s_mode | (d_mode << 3)])(
-              src_x, src_y, x, y, dimx, dimy, flip_y, s_alpha, d_alpha, tine);
-        }
-      }
-    }
+  DrawMode draw;
+  DrawMode overlap;
+
+  if (blend) {
+    int32_t mode = s_mode | (d_mode << 3);
+    draw = draw_table_->blend[flip_x != 0][tinted][transparent != 0][mode];
+    overlap = kDrawTables[kSse2].blend[flip_x != 0][tinted][transparent != 0]
+                                      [mode];
   } else {
-    if (!blend && !tinted) {
-      if (!flip_x) {
-        if (transparent) {
-          Draw<1, 0, 0, 0, 1, 0, 0>(src_x, src_y, x, y, dimx, dimy, flip_y,
-                                    s_alpha, d_alpha, tine);
-        } else {
-          Draw<1, 0, 0, 0, 0, 0, 0>(src_x, src_y, x, y, dimx, dimy, flip_y,
-                                    s_alpha, d_alpha, tine);
-        }
-      } else {
-        if (transparent) {
-          Draw<1, 0, 1, 0, 1, 0, 0>(src_x, src_y, x, y, dimx, dimy, flip_y,
-                                    s_alpha, d_alpha, tine);
-        } else {
-          Draw<1, 0, 1, 0, 0, 0, 0>(src_x, src_y, x, y, dimx, dimy, flip_y,
-                                    s_alpha, d_alpha, tine);
-        }
-      }
-      return;
-    }
+    draw = draw_table_->copy[flip_x != 0][tinted][transparent != 0];
+    overlap = kDrawTables[kSse2].copy[flip_x != 0][tinted][transparent != 0];
+  }
 
-    if (!flip_x) {
-      if (transparent) {
-        if (!blend) {
-          Draw<0, 0, 0, 0, 1, 0, 0>(src_x, src_y, x, y, dimx, dimy, flip_y,
-                                    s_alpha, d_alpha, tine);
-        } else {
-          (this->*DrawNonFlipNonTinedTransparentBlend[s_mode | (d_mode << 3)])(
-              src_x, src_y, x, y, dimx, dimy, flip_y, s_alpha, d_alpha, tine);
-        }
-      } else {
-        if (!blend) {
-          Draw<0, 0, 0, 0, 0, 0, 0>(src_x, src_y, x, y, dimx, dimy, flip_y,
-                                    s_alpha, d_alpha, tine);
-        } else {
-          (this->*DrawNonFlipNonTinedNonTransparentBlend[s_mode |
-                                                         (d_mode << 3)])(
-              src_x, src_y, x, y, dimx, dimy, flip_y, s_alpha, d_alpha, tine);
-        }
-      }
-    } else {
-      if (transparent) {
-        if (!blend) {
-          Draw<0, 0, 1, 0, 1, 0, 0>(src_x, src_y, x, y, dimx, dimy, flip_y,
-                                    s_alpha, d_alpha, tine);
-        } else {
-          (this->*DrawFlipNonTinedTransparentBlend[s_mode | (d_mode << 3)])(
-              src_x, src_y, x, y, dimx, dimy, flip_y, s_alpha, d_alpha, tine);
-        }
-      } else {
-        if (!blend) {
-          Draw<0, 0, 1, 0, 0, 0, 0>(src_x, src_y, x, y, dimx, dimy, flip_y,
-                                    s_alpha, d_alpha, tine);
-        } else {
-          (this->*DrawFlipNonTinedNonTransparentBlend[s_mode | (d_mode << 3)])(
-              src_x, src_y, x, y, dimx, dimy, flip_y, s_alpha, d_alpha, tine);
-        }
-      }
-    }
+  uint16_t mode = s_mode | (d_mode << 3) | ((transparent != 0) << 6) |
+                 (tinted << 7) | ((flip_x != 0) << 8) | ((blend != 0) << 9);
+
+  int32_t min_x = std::max(x, clip_.min_x);
+  int32_t min_y = std::max(y, clip_.min_y);
+  int32_t max_x = std::min(x + dimx - 1, clip_.max_x);
+  int32_t max_y = std::min(y + dimy - 1, clip_.max_y);
+  if (min_x <= max_x && min_y <= max_y) {
+    MarkDirty(min_x, min_y, max_x - min_x + 1, max_y - min_y + 1);
   }
+
+  Queue({draw, overlap, src_x, src_y, x, y, dimx, dimy,
+         static_cast<uint32_t>(flip_y), s_alpha, d_alpha,
+         static_cast<uint32_t>(tine), clip_, mode});
 }
 
 void Blitter::Run() {
   bool clip_type = true;
+  bool drawn = false;
 
   uint32_t addr = Read<uint32_t>(0x0008);
 
+  capture::Frame frame;
+  if (capture_frames_) {
+    if (!capture_.IsOpen() &&
+        !capture_.Open(capture_path_, gpu_.data(), gpu_.size())) {
+      std::cout << "blitter: can't write capture " << capture_path_
+                << std::endl;
+      capture_frames_ = 0;
+    }
+    frame.regs = gpu_regs_;
+    frame.list_addr = addr;
+  }
+
   clip_.min_x = Read<uint32_t>(0x0040);
   clip_.min_y = Read<uint32_t>(0x0044);
   clip_.max_x = clip_.min_x + 320 - 1;
@@ -603,26 +1045,261 @@ void Blitter::Run() {
     }
 
     else if (value == 0x2000) {
+      Flush();
       Upload(addr);
     } else if (value == 0x1000) {
       addr -= 2;
       Draw(addr);
-      uint32_t offsetx = Read<uint32_t>(0x0014);
-      uint32_t offsety = Read<uint32_t>(0x0018);
-      uint32_t offx = offsetx + (offsety * kSizeX);
-
-      uint16_t *d = reinterpret_cast<uint16_t *>(screen_.data());
-      for (uint32_t y = 0; y < kHeight; y++, offx += kSizeX) {
-        uint16_t *s = reinterpret_cast<uint16_t *>(gpu_.data()) + offx;
-        for (uint32_t x = 0; x < kWidth; x += 8, d += 8) {
-          __m128i value = _mm_loadu_si128(reinterpret_cast<__m128i *>(&s[x]));
-          __m128i rgb = _mm_slli_epi16(value, 1);
-          __m128i alpha = _mm_srli_epi16(value, 15);
-          _mm_storeu_si128(reinterpret_cast<__m128i *>(d),
-                           _mm_or_si128(rgb, alpha));
-        }
-      }
+      drawn = true;
+    }
+  }
+
+  Flush();
+
+  // The screen is converted once per display list rather than per draw.
+  if (drawn) UpdateScreen();
+
+  if (capture_frames_) {
+    for (uint32_t list = frame.list_addr; list != addr;) {
+      frame.list.push_back(Next16(list));
+    }
+    frame.screen_hash =
+        capture::Hash(screen_[last_].data(), sizeof(screen_[last_]));
+    capture_.Write(frame);
+    if (--capture_frames_ == 0) capture_.Close();
+  }
+}
+
+void Blitter::StartCapture(const std::string &path, uint32_t frames) {
+  capture_path_ = path;
+  capture_frames_ = frames;
+}
+
+void Blitter::LoadVram(const std::vector<uint8_t> &vram) {
+  std::memcpy(gpu_.data(), vram.data(), std::min(vram.size(), gpu_.size()));
+}
+
+void Blitter::Sync() {
+  std::unique_lock lock(blit_mutex_);
+  blit_cv_.wait(lock, [this] { return !blitting_; });
+}
+
+void Blitter::SaveState(state::Writer &writer) {
+  Sync();
+  writer.Begin(state::Tag("GPU "), 1);
+  writer.Put(gpu_regs_);
+  writer.Put(clip_);
+  writer.Put(screen_[last_]);
+  counters.SaveCounter(writer, v_sync_);
+  counters.SaveCounter(writer, blit_irq_);
+}
+
+void Blitter::LoadState(state::Reader &reader) {
+  Sync();
+  reader.Get(gpu_regs_);
+  reader.Get(clip_);
+  reader.Get(screen_[back_]);
+  PresentScreen();
+  counters.LoadCounter(reader, v_sync_);
+  counters.LoadCounter(reader, blit_irq_);
+}
+
+void Blitter::Replay(const capture::Frame &frame) {
+  gpu_regs_ = frame.regs;
+
+  uint32_t addr = frame.list_addr;
+  for (uint16_t value : frame.list) {
+    addr &= ram_.size() - 1;
+    *(uint16_t *)&ram_[ram_.size() - addr - 2] = value;
+    addr += 2;
+  }
+
+  Run();
+}
+
+void Blitter::UpdateScreen() {
+  uint32_t offsetx = Read<uint32_t>(0x0014);
+  uint32_t offsety = Read<uint32_t>(0x0018);
+  uint32_t offx = offsetx + (offsety * kSizeX);
+
+  uint16_t *d = screen_[back_].data();
+  for (uint32_t y = 0; y < kHeight; y++, offx += kSizeX) {
+    uint16_t *s = reinterpret_cast<uint16_t *>(gpu_.data()) + offx;
+    for (uint32_t x = 0; x < kWidth; x += 8, d += 8) {
+      __m128i value = _mm_loadu_si128(reinterpret_cast<__m128i *>(&s[x]));
+      __m128i rgb = _mm_slli_epi16(value, 1);
+      __m128i alpha = _mm_srli_epi16(value, 15);
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(d),
+                       _mm_or_si128(rgb, alpha));
+    }
+  }
+
+  PresentScreen();
+}
+
+void Blitter::PresentScreen() {
+  last_ = back_;
+  back_ = ready_.exchange(back_ | kFresh, std::memory_order_acq_rel) & ~kFresh;
+}
+
+static bool Overlap(const Clip &a, const Clip &b) {
+  return a.min_x <= b.max_x && b.min_x <= a.max_x && a.min_y <= b.max_y &&
+         b.min_y <= a.max_y;
+}
+
+static void Merge(Clip &a, const Clip &b) {
+  a.min_x = std::min(a.min_x, b.min_x);
+  a.min_y = std::min(a.min_y, b.min_y);
+  a.max_x = std::max(a.max_x, b.max_x);
+  a.max_y = std::max(a.max_y, b.max_y);
+}
+
+void Blitter::Queue(const Command &cmd) {
+  Clip dst;
+  dst.min_x = std::max(cmd.x, cmd.clip.min_x);
+  dst.min_y = std::max(cmd.y, cmd.clip.min_y);
+  dst.max_x = std::min(cmd.x + cmd.dimx - 1, cmd.clip.max_x);
+  dst.max_y = std::min(cmd.y + cmd.dimy - 1, cmd.clip.max_y);
+
+  if (dst.min_x > dst.max_x || dst.min_y > dst.max_y) return;
+
+  // Source rows wrap at 4096, treat a wrapping source as the full height.
+  Clip src;
+  src.min_x = cmd.src_x;
+  src.max_x = cmd.src_x + cmd.dimx - 1;
+  src.min_y = cmd.src_y & 0x0fff;
+  src.max_y = src.min_y + cmd.dimy - 1;
+  if (src.max_y >= static_cast<int32_t>(kSizeY)) {
+    src.min_y = 0;
+    src.max_y = kSizeY - 1;
+  }
+
+  // A draw reading its own destination depends on rows of other bands, and
+  // on the kernel width, so it runs alone with the SSE2 kernels.
+  bool self = Overlap(src, dst);
+
+  if (!batch_.empty() && (self || Overlap(src, batch_dst_) ||
+                          Overlap(dst, batch_src_))) {
+    Flush();
+  }
+
+  if (batch_.empty()) {
+    batch_dst_ = dst;
+    batch_src_ = src;
+  } else {
+    Merge(batch_dst_, dst);
+    Merge(batch_src_, src);
+  }
+  batch_.push_back(cmd);
+  int64_t pixels = static_cast<int64_t>(dst.max_x - dst.min_x + 1) *
+                   (dst.max_y - dst.min_y + 1);
+  batch_pixels_ += pixels;
+
+  if (stats_) {
+    stats_->modes[cmd.mode].count++;
+    stats_->modes[cmd.mode].pixels += pixels;
+  }
+
+  if (self) {
+    batch_.back().draw = cmd.overlap;
+    Flush();
+  }
+}
+
+void Blitter::Flush() {
+  if (batch_.empty()) return;
+
+  int32_t bands = static_cast<int32_t>(workers_.size()) + 1;
+  if (batch_.size() == 1 || batch_pixels_ < kMinParallelPixels || stats_) {
+    bands = 1;
+  }
+
+  int32_t height = batch_dst_.max_y - batch_dst_.min_y + 1;
+  band_height_ = (height + bands - 1) / bands;
+
+  if (bands == 1) {
+    RenderBand(0);
+  } else {
+    {
+      std::lock_guard lock(work_mutex_);
+      work_left_ = workers_.size();
+      work_id_++;
+    }
+    work_cv_.notify_all();
+    RenderBand(0);
+    std::unique_lock lock(work_mutex_);
+    done_cv_.wait(lock, [this] { return work_left_ == 0; });
+  }
+
+  batch_.clear();
+  batch_pixels_ = 0;
+}
+
+void Blitter::RenderBand(int32_t band) {
+  int32_t min_y = batch_dst_.min_y + band * band_height_;
+  int32_t max_y = std::min(min_y + band_height_ - 1, batch_dst_.max_y);
+
+  for (const Command &cmd : batch_) {
+    Clip clip = cmd.clip;
+    clip.min_y = std::max(clip.min_y, min_y);
+    clip.max_y = std::min(clip.max_y, max_y);
+    if (clip.min_y > clip.max_y) continue;
+
+    if (stats_) {
+      auto start = std::chrono::steady_clock::now();
+      (this->*cmd.draw)(cmd.src_x, cmd.src_y, cmd.x, cmd.y, cmd.dimx, cmd.dimy,
+                        cmd.flip_y, cmd.s_alpha, cmd.d_alpha, cmd.tine, clip);
+      uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - start)
+                        .count();
+      stats_->modes[cmd.mode].ns += ns;
+      stats_->modes[cmd.mode].max_ns =
+          std::max(stats_->modes[cmd.mode].max_ns, ns);
+      continue;
     }
+
+    (this->*cmd.draw)(cmd.src_x, cmd.src_y, cmd.x, cmd.y, cmd.dimx, cmd.dimy,
+                      cmd.flip_y, cmd.s_alpha, cmd.d_alpha, cmd.tine, clip);
+  }
+}
+
+void Blitter::Worker(int32_t band, uint32_t work_id) {
+  while (true) {
+    std::unique_lock lock(work_mutex_);
+    work_cv_.wait(lock,
+                  [&] { return work_id_ != work_id || !workers_running_; });
+    if (!workers_running_) {
+      break;
+    }
+    work_id = work_id_;
+    lock.unlock();
+    RenderBand(band);
+    lock.lock();
+    if (--work_left_ == 0) done_cv_.notify_one();
+  }
+}
+
+void Blitter::StopWorkers() {
+  {
+    std::lock_guard lock(work_mutex_);
+    workers_running_ = false;
+  }
+  work_cv_.notify_all();
+  for (auto &worker : workers_) worker.join();
+  workers_.clear();
+}
+
+void Blitter::SetThreads(int32_t threads) {
+  StopWorkers();
+
+  if (threads <= 0) {
+    threads = static_cast<int32_t>(std::thread::hardware_concurrency());
+  }
+  threads = std::clamp(threads, 1, static_cast<int32_t>(kMaxBands));
+
+  workers_running_ = true;
+  for (int32_t band = 1; band < threads; band++) {
+    workers_.emplace_back(&Blitter::Worker, this, band, work_id_);
   }
 }
 
@@ -633,7 +1310,12 @@ void Blitter::Blit() {
     if (!running_) {
       break;
     }
+    auto start = std::chrono::steady_clock::now();
     Run();
+    busy_ns_.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now() - start)
+                           .count(),
+                       std::memory_order_relaxed);
     blitting_ = false;
     lock.unlock();
     blit_cv_.notify_one();
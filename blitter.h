@@ -1,14 +1,40 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <condition_variable>
 #include <cstdint>
 #include <cstring>
 #include <functional>
+#include <mutex>
 #include <span>
+#include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
+#include "blitter_capture.h"
 #include "counters.h"
+#include "save_state.h"
+
+#if defined(__GNUC__)
+#define BLITTER_TARGET(isa) __attribute__((target(isa)))
+#else
+#define BLITTER_TARGET(isa)
+#endif
+
+// Per draw mode counters, filled in while stats are enabled. Modes are keyed
+// by the attribute bits that select a DrawMode: s_mode | d_mode << 3 |
+// transparent << 6 | tined << 7 | flip_x << 8 | blend << 9.
+struct DrawStats {
+  struct Mode {
+    uint64_t count;
+    uint64_t pixels;
+    uint64_t ns;
+    uint64_t max_ns;
+  };
+  std::array<Mode, 0x400> modes{};
+};
 
 struct Clip {
   int32_t min_x;
@@ -23,7 +49,49 @@ class Blitter {
   ~Blitter();
 
   void Init(std::function<void(int32_t)> irq_callbak);
-  uint16_t *GetBlitterData() { return screen_.data(); }
+  // Number of threads rendering a display list, 0 picks one per core.
+  void SetThreads(int32_t threads);
+
+  // Instruction sets the draw kernels are built for, picked by CPUID.
+  enum Isa : int32_t { kSse2 = 0, kAvx2, kAvx512, kIsaCount };
+
+  static Isa DetectIsa();
+  static const char *GetIsaName(Isa isa);
+  // Draws with the kernels of isa from now on, false if the host lacks it.
+  bool SetIsa(Isa isa);
+  // Latest completed frame, for a single consumer thread. The buffer stays
+  // untouched by the blit thread until the next call.
+  uint16_t *GetBlitterData() {
+    if (ready_.load(std::memory_order_relaxed) & kFresh) {
+      front_ = ready_.exchange(front_, std::memory_order_acq_rel) & ~kFresh;
+    }
+    return screen_[front_].data();
+  }
+
+  // Records the next frames display lists to path, see blitter_capture.h.
+  void StartCapture(const std::string &path, uint32_t frames);
+
+  // Headless replay for blitter_bench, runs a captured list on the calling
+  // thread. Stats force single band rendering so draws can be timed.
+  void LoadVram(const std::vector<uint8_t> &vram);
+  void Replay(const capture::Frame &frame);
+  void SetStats(DrawStats *stats) { stats_ = stats; }
+
+  // Waits for a running display list, VRAM may be touched until the CPU
+  // starts another.
+  void Sync();
+  // Sync() first, a state always holds finished draws. VRAM is not
+  // included.
+  void SaveState(state::Writer &writer);
+  void LoadState(state::Reader &reader);
+  std::span<uint8_t> GetVram() { return gpu_; }
+  // One byte per 4 KiB page of VRAM, set when a display list writes it.
+  std::span<uint8_t> GetVramDirty() { return vram_dirty_; }
+
+  // Wall time the blit thread spent running display lists.
+  uint64_t GetBusyNs() const {
+    return busy_ns_.load(std::memory_order_relaxed);
+  }
 
   uint8_t Read8(uint32_t addr);
   uint32_t Read32(uint32_t addr);
@@ -38,7 +106,8 @@ class Blitter {
     kSizeY = kBlockSize * 16,
     kVramSize = kSizeX * kSizeY * 2,
     kWidth = 320,
-    kHeight = 240
+    kHeight = 240,
+    kDirtyShift = 12
   };
 
   bool running_;
@@ -51,14 +120,25 @@ class Blitter {
   void Run();
   void Upload(uint32_t &addr);
   void Draw(uint32_t &addr);
+  void MarkDirty(int32_t x, int32_t y, int32_t w, int32_t h);
 
   counters::Counters &counters;
 
   std::span<uint8_t> ram_;
   std::array<uint8_t, kVramSize> gpu_;
+  std::array<uint8_t, (kVramSize >> kDirtyShift)> vram_dirty_;
   std::array<uint8_t, 0x00000100> gpu_regs_;
   std::function<void(int32_t)> irq_;
-  std::array<uint16_t, kWidth * kHeight> screen_;
+  // Triple buffered: the blit thread writes back_, then swaps it with ready_
+  // and flags it fresh; the consumer swaps front_ for a fresh ready_. Each
+  // side only writes the buffer it owns.
+  enum : uint32_t { kFresh = 4 };
+  std::array<uint16_t, kWidth * kHeight> screen_[3];
+  uint32_t back_;
+  // Last buffer the blit thread completed.
+  uint32_t last_;
+  std::atomic<uint32_t> ready_;
+  uint32_t front_;
 
   template <typename T>
   T Read(uint32_t addr) {
@@ -94,6 +174,18 @@ class Blitter {
   counters::Counter *v_sync_;
   counters::Counter *blit_irq_;
 
+  template <int simple, int blend, int flip_x, int tined, int transparent,
+            int s_mode, int d_mode>
+  BLITTER_TARGET("avx512f,avx512bw")
+  void Block512(uint16_t **d_mem, uint16_t **s_mem, int pixels,
+                uint8_t src_alpha, uint8_t dst_alpha, uint32_t tine);
+
+  template <int simple, int blend, int flip_x, int tined, int transparent,
+            int s_mode, int d_mode>
+  BLITTER_TARGET("avx2")
+  void Block256(uint16_t **d_mem, uint16_t **s_mem, int blocks256,
+                uint8_t src_alpha, uint8_t dst_alpha, uint32_t tine);
+
   template <int simple, int blend, int flip_x, int tined, int transparent,
             int s_mode, int d_mode>
   void Block128(uint16_t **d_mem, uint16_t **s_mem, int blocks128,
@@ -104,293 +196,87 @@ class Blitter {
   void Block16(uint16_t **d_mem, uint16_t **s_mem, int blocks16,
                uint8_t src_alpha, uint8_t dst_alpha, uint32_t tine);
 
-  template <int simple, int blend, int flip_x, int tined, int transparent,
-            int s_mode, int d_mode>
+  template <int isa, int simple, int blend, int flip_x, int tined,
+            int transparent, int s_mode, int d_mode>
   void Draw(int32_t src_x, int32_t src_y, int32_t x_start, int32_t y_start,
             int32_t dimx, int32_t dimy, uint32_t flip_y, uint8_t s_alpha,
-            uint8_t d_alpha, uint32_t tine);
+            uint8_t d_alpha, uint32_t tine, const Clip &clip);
 
   typedef void (Blitter::*DrawMode)(int32_t src_x, int32_t src_y,
                                     int32_t x_start, int32_t y_start,
                                     int32_t dimx, int32_t dimy, uint32_t flip_y,
                                     uint8_t s_alpha, uint8_t d_alpha,
-                                    uint32_t tine);
-
-  static constexpr DrawMode DrawNonFlipTinedTransparentBlend[64] = {
-      &Blitter::Draw<0, 1, 0, 1, 1, 0, 0>, &Blitter::Draw<0, 1, 0, 1, 1, 1, 0>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 2, 0>, &Blitter::Draw<0, 1, 0, 1, 1, 3, 0>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 4, 0>, &Blitter::Draw<0, 1, 0, 1, 1, 5, 0>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 6, 0>, &Blitter::Draw<0, 1, 0, 1, 1, 7, 0>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 0, 1>, &Blitter::Draw<0, 1, 0, 1, 1, 1, 1>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 2, 1>, &Blitter::Draw<0, 1, 0, 1, 1, 3, 1>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 4, 1>, &Blitter::Draw<0, 1, 0, 1, 1, 5, 1>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 6, 1>, &Blitter::Draw<0, 1, 0, 1, 1, 7, 1>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 0, 2>, &Blitter::Draw<0, 1, 0, 1, 1, 1, 2>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 2, 2>, &Blitter::Draw<0, 1, 0, 1, 1, 3, 2>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 4, 2>, &Blitter::Draw<0, 1, 0, 1, 1, 5, 2>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 6, 2>, &Blitter::Draw<0, 1, 0, 1, 1, 7, 2>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 0, 3>, &Blitter::Draw<0, 1, 0, 1, 1, 1, 3>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 2, 3>, &Blitter::Draw<0, 1, 0, 1, 1, 3, 3>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 4, 3>, &Blitter::Draw<0, 1, 0, 1, 1, 5, 3>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 6, 3>, &Blitter::Draw<0, 1, 0, 1, 1, 7, 3>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 0, 4>, &Blitter::Draw<0, 1, 0, 1, 1, 1, 4>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 2, 4>, &Blitter::Draw<0, 1, 0, 1, 1, 3, 4>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 4, 4>, &Blitter::Draw<0, 1, 0, 1, 1, 5, 4>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 6, 4>, &Blitter::Draw<0, 1, 0, 1, 1, 7, 4>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 0, 5>, &Blitter::Draw<0, 1, 0, 1, 1, 1, 5>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 2, 5>, &Blitter::Draw<0, 1, 0, 1, 1, 3, 5>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 4, 5>, &Blitter::Draw<0, 1, 0, 1, 1, 5, 5>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 6, 5>, &Blitter::Draw<0, 1, 0, 1, 1, 7, 5>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 0, 6>, &Blitter::Draw<0, 1, 0, 1, 1, 1, 6>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 2, 6>, &Blitter::Draw<0, 1, 0, 1, 1, 3, 6>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 4, 6>, &Blitter::Draw<0, 1, 0, 1, 1, 5, 6>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 6, 6>, &Blitter::Draw<0, 1, 0, 1, 1, 7, 6>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 0, 7>, &Blitter::Draw<0, 1, 0, 1, 1, 1, 7>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 2, 7>, &Blitter::Draw<0, 1, 0, 1, 1, 3, 7>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 4, 7>, &Blitter::Draw<0, 1, 0, 1, 1, 5, 7>,
-      &Blitter::Draw<0, 1, 0, 1, 1, 6, 7>, &Blitter::Draw<0, 1, 0, 1, 1, 7, 7>,
-  };
+                                    uint32_t tine, const Clip &clip);
 
-  static constexpr DrawMode DrawNonFlipTinedNonTransparentBlend[64] = {
-      &Blitter::Draw<0, 1, 0, 1, 0, 0, 0>, &Blitter::Draw<0, 1, 0, 1, 0, 1, 0>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 2, 0>, &Blitter::Draw<0, 1, 0, 1, 0, 3, 0>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 4, 0>, &Blitter::Draw<0, 1, 0, 1, 0, 5, 0>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 6, 0>, &Blitter::Draw<0, 1, 0, 1, 0, 7, 0>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 0, 1>, &Blitter::Draw<0, 1, 0, 1, 0, 1, 1>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 2, 1>, &Blitter::Draw<0, 1, 0, 1, 0, 3, 1>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 4, 1>, &Blitter::Draw<0, 1, 0, 1, 0, 5, 1>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 6, 1>, &Blitter::Draw<0, 1, 0, 1, 0, 7, 1>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 0, 2>, &Blitter::Draw<0, 1, 0, 1, 0, 1, 2>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 2, 2>, &Blitter::Draw<0, 1, 0, 1, 0, 3, 2>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 4, 2>, &Blitter::Draw<0, 1, 0, 1, 0, 5, 2>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 6, 2>, &Blitter::Draw<0, 1, 0, 1, 0, 7, 2>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 0, 3>, &Blitter::Draw<0, 1, 0, 1, 0, 1, 3>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 2, 3>, &Blitter::Draw<0, 1, 0, 1, 0, 3, 3>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 4, 3>, &Blitter::Draw<0, 1, 0, 1, 0, 5, 3>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 6, 3>, &Blitter::Draw<0, 1, 0, 1, 0, 7, 3>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 0, 4>, &Blitter::Draw<0, 1, 0, 1, 0, 1, 4>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 2, 4>, &Blitter::Draw<0, 1, 0, 1, 0, 3, 4>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 4, 4>, &Blitter::Draw<0, 1, 0, 1, 0, 5, 4>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 6, 4>, &Blitter::Draw<0, 1, 0, 1, 0, 7, 4>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 0, 5>, &Blitter::Draw<0, 1, 0, 1, 0, 1, 5>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 2, 5>, &Blitter::Draw<0, 1, 0, 1, 0, 3, 5>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 4, 5>, &Blitter::Draw<0, 1, 0, 1, 0, 5, 5>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 6, 5>, &Blitter::Draw<0, 1, 0, 1, 0, 7, 5>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 0, 6>, &Blitter::Draw<0, 1, 0, 1, 0, 1, 6>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 2, 6>, &Blitter::Draw<0, 1, 0, 1, 0, 3, 6>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 4, 6>, &Blitter::Draw<0, 1, 0, 1, 0, 5, 6>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 6, 6>, &Blitter::Draw<0, 1, 0, 1, 0, 7, 6>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 0, 7>, &Blitter::Draw<0, 1, 0, 1, 0, 1, 7>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 2, 7>, &Blitter::Draw<0, 1, 0, 1, 0, 3, 7>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 4, 7>, &Blitter::Draw<0, 1, 0, 1, 0, 5, 7>,
-      &Blitter::Draw<0, 1, 0, 1, 0, 6, 7>, &Blitter::Draw<0, 1, 0, 1, 0, 7, 7>,
+  struct DrawTable {
+    // [flip_x][tined][transparent][s_mode | (d_mode << 3)]
+    std::array<DrawMode, 64> blend[2][2][2];
+    // [flip_x][tined][transparent]
+    DrawMode copy[2][2][2];
   };
 
-  static constexpr DrawMode DrawFlipTinedTransparentBlend[64] = {
-      &Blitter::Draw<0, 1, 1, 1, 1, 0, 0>, &Blitter::Draw<0, 1, 1, 1, 1, 1, 0>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 2, 0>, &Blitter::Draw<0, 1, 1, 1, 1, 3, 0>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 4, 0>, &Blitter::Draw<0, 1, 1, 1, 1, 5, 0>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 6, 0>, &Blitter::Draw<0, 1, 1, 1, 1, 7, 0>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 0, 1>, &Blitter::Draw<0, 1, 1, 1, 1, 1, 1>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 2, 1>, &Blitter::Draw<0, 1, 1, 1, 1, 3, 1>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 4, 1>, &Blitter::Draw<0, 1, 1, 1, 1, 5, 1>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 6, 1>, &Blitter::Draw<0, 1, 1, 1, 1, 7, 1>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 0, 2>, &Blitter::Draw<0, 1, 1, 1, 1, 1, 2>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 2, 2>, &Blitter::Draw<0, 1, 1, 1, 1, 3, 2>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 4, 2>, &Blitter::Draw<0, 1, 1, 1, 1, 5, 2>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 6, 2>, &Blitter::Draw<0, 1, 1, 1, 1, 7, 2>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 0, 3>, &Blitter::Draw<0, 1, 1, 1, 1, 1, 3>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 2, 3>, &Blitter::Draw<0, 1, 1, 1, 1, 3, 3>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 4, 3>, &Blitter::Draw<0, 1, 1, 1, 1, 5, 3>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 6, 3>, &Blitter::Draw<0, 1, 1, 1, 1, 7, 3>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 0, 4>, &Blitter::Draw<0, 1, 1, 1, 1, 1, 4>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 2, 4>, &Blitter::Draw<0, 1, 1, 1, 1, 3, 4>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 4, 4>, &Blitter::Draw<0, 1, 1, 1, 1, 5, 4>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 6, 4>, &Blitter::Draw<0, 1, 1, 1, 1, 7, 4>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 0, 5>, &Blitter::Draw<0, 1, 1, 1, 1, 1, 5>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 2, 5>, &Blitter::Draw<0, 1, 1, 1, 1, 3, 5>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 4, 5>, &Blitter::Draw<0, 1, 1, 1, 1, 5, 5>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 6, 5>, &Blitter::Draw<0, 1, 1, 1, 1, 7, 5>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 0, 6>, &Blitter::Draw<0, 1, 1, 1, 1, 1, 6>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 2, 6>, &Blitter::Draw<0, 1, 1, 1, 1, 3, 6>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 4, 6>, &Blitter::Draw<0, 1, 1, 1, 1, 5, 6>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 6, 6>, &Blitter::Draw<0, 1, 1, 1, 1, 7, 6>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 0, 7>, &Blitter::Draw<0, 1, 1, 1, 1, 1, 7>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 2, 7>, &Blitter::Draw<0, 1, 1, 1, 1, 3, 7>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 4, 7>, &Blitter::Draw<0, 1, 1, 1, 1, 5, 7>,
-      &Blitter::Draw<0, 1, 1, 1, 1, 6, 7>, &Blitter::Draw<0, 1, 1, 1, 1, 7, 7>,
-  };
+  template <int isa, int flip_x, int tined, int transparent, size_t... mode>
+  static constexpr std::array<DrawMode, 64> MakeBlendModes(
+      std::index_sequence<mode...>);
+  template <int isa>
+  static constexpr DrawTable MakeDrawTable();
 
-  static constexpr DrawMode DrawFlipTinedNonTransparentBlend[64] = {
-      &Blitter::Draw<0, 1, 1, 1, 0, 0, 0>, &Blitter::Draw<0, 1, 1, 1, 0, 1, 0>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 2, 0>, &Blitter::Draw<0, 1, 1, 1, 0, 3, 0>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 4, 0>, &Blitter::Draw<0, 1, 1, 1, 0, 5, 0>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 6, 0>, &Blitter::Draw<0, 1, 1, 1, 0, 7, 0>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 0, 1>, &Blitter::Draw<0, 1, 1, 1, 0, 1, 1>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 2, 1>, &Blitter::Draw<0, 1, 1, 1, 0, 3, 1>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 4, 1>, &Blitter::Draw<0, 1, 1, 1, 0, 5, 1>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 6, 1>, &Blitter::Draw<0, 1, 1, 1, 0, 7, 1>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 0, 2>, &Blitter::Draw<0, 1, 1, 1, 0, 1, 2>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 2, 2>, &Blitter::Draw<0, 1, 1, 1, 0, 3, 2>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 4, 2>, &Blitter::Draw<0, 1, 1, 1, 0, 5, 2>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 6, 2>, &Blitter::Draw<0, 1, 1, 1, 0, 7, 2>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 0, 3>, &Blitter::Draw<0, 1, 1, 1, 0, 1, 3>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 2, 3>, &Blitter::Draw<0, 1, 1, 1, 0, 3, 3>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 4, 3>, &Blitter::Draw<0, 1, 1, 1, 0, 5, 3>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 6, 3>, &Blitter::Draw<0, 1, 1, 1, 0, 7, 3>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 0, 4>, &Blitter::Draw<0, 1, 1, 1, 0, 1, 4>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 2, 4>, &Blitter::Draw<0, 1, 1, 1, 0, 3, 4>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 4, 4>, &Blitter::Draw<0, 1, 1, 1, 0, 5, 4>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 6, 4>, &Blitter::Draw<0, 1, 1, 1, 0, 7, 4>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 0, 5>, &Blitter::Draw<0, 1, 1, 1, 0, 1, 5>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 2, 5>, &Blitter::Draw<0, 1, 1, 1, 0, 3, 5>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 4, 5>, &Blitter::Draw<0, 1, 1, 1, 0, 5, 5>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 6, 5>, &Blitter::Draw<0, 1, 1, 1, 0, 7, 5>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 0, 6>, &Blitter::Draw<0, 1, 1, 1, 0, 1, 6>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 2, 6>, &Blitter::Draw<0, 1, 1, 1, 0, 3, 6>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 4, 6>, &Blitter::Draw<0, 1, 1, 1, 0, 5, 6>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 6, 6>, &Blitter::Draw<0, 1, 1, 1, 0, 7, 6>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 0, 7>, &Blitter::Draw<0, 1, 1, 1, 0, 1, 7>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 2, 7>, &Blitter::Draw<0, 1, 1, 1, 0, 3, 7>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 4, 7>, &Blitter::Draw<0, 1, 1, 1, 0, 5, 7>,
-      &Blitter::Draw<0, 1, 1, 1, 0, 6, 7>, &Blitter::Draw<0, 1, 1, 1, 0, 7, 7>,
-  };
+  static const DrawTable kDrawTables[kIsaCount];
+  const DrawTable *draw_table_;
 
-  static constexpr DrawMode DrawNonFlipNonTinedTransparentBlend[64] = {
-      &Blitter::Draw<0, 1, 0, 0, 1, 0, 0>, &Blitter::Draw<0, 1, 0, 0, 1, 1, 0>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 2, 0>, &Blitter::Draw<0, 1, 0, 0, 1, 3, 0>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 4, 0>, &Blitter::Draw<0, 1, 0, 0, 1, 5, 0>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 6, 0>, &Blitter::Draw<0, 1, 0, 0, 1, 7, 0>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 0, 1>, &Blitter::Draw<0, 1, 0, 0, 1, 1, 1>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 2, 1>, &Blitter::Draw<0, 1, 0, 0, 1, 3, 1>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 4, 1>, &Blitter::Draw<0, 1, 0, 0, 1, 5, 1>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 6, 1>, &Blitter::Draw<0, 1, 0, 0, 1, 7, 1>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 0, 2>, &Blitter::Draw<0, 1, 0, 0, 1, 1, 2>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 2, 2>, &Blitter::Draw<0, 1, 0, 0, 1, 3, 2>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 4, 2>, &Blitter::Draw<0, 1, 0, 0, 1, 5, 2>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 6, 2>, &Blitter::Draw<0, 1, 0, 0, 1, 7, 2>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 0, 3>, &Blitter::Draw<0, 1, 0, 0, 1, 1, 3>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 2, 3>, &Blitter::Draw<0, 1, 0, 0, 1, 3, 3>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 4, 3>, &Blitter::Draw<0, 1, 0, 0, 1, 5, 3>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 6, 3>, &Blitter::Draw<0, 1, 0, 0, 1, 7, 3>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 0, 4>, &Blitter::Draw<0, 1, 0, 0, 1, 1, 4>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 2, 4>, &Blitter::Draw<0, 1, 0, 0, 1, 3, 4>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 4, 4>, &Blitter::Draw<0, 1, 0, 0, 1, 5, 4>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 6, 4>, &Blitter::Draw<0, 1, 0, 0, 1, 7, 4>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 0, 5>, &Blitter::Draw<0, 1, 0, 0, 1, 1, 5>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 2, 5>, &Blitter::Draw<0, 1, 0, 0, 1, 3, 5>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 4, 5>, &Blitter::Draw<0, 1, 0, 0, 1, 5, 5>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 6, 5>, &Blitter::Draw<0, 1, 0, 0, 1, 7, 5>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 0, 6>, &Blitter::Draw<0, 1, 0, 0, 1, 1, 6>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 2, 6>, &Blitter::Draw<0, 1, 0, 0, 1, 3, 6>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 4, 6>, &Blitter::Draw<0, 1, 0, 0, 1, 5, 6>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 6, 6>, &Blitter::Draw<0, 1, 0, 0, 1, 7, 6>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 0, 7>, &Blitter::Draw<0, 1, 0, 0, 1, 1, 7>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 2, 7>, &Blitter::Draw<0, 1, 0, 0, 1, 3, 7>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 4, 7>, &Blitter::Draw<0, 1, 0, 0, 1, 5, 7>,
-      &Blitter::Draw<0, 1, 0, 0, 1, 6, 7>, &Blitter::Draw<0, 1, 0, 0, 1, 7, 7>,
+  // A decoded draw command, clip is the clip rect active when it was parsed.
+  struct Command {
+    DrawMode draw;
+    // SSE2 variant, used when the draw reads its own destination, where the
+    // result depends on how many pixels a kernel loads before it stores.
+    DrawMode overlap;
+    int32_t src_x;
+    int32_t src_y;
+    int32_t x;
+    int32_t y;
+    int32_t dimx;
+    int32_t dimy;
+    uint32_t flip_y;
+    uint8_t s_alpha;
+    uint8_t d_alpha;
+    uint32_t tine;
+    Clip clip;
+    uint16_t mode;
   };
 
-  static constexpr DrawMode DrawNonFlipNonTinedNonTransparentBlend[64] = {
-      &Blitter::Draw<0, 1, 0, 0, 0, 4, 0>, &Blitter::Draw<0, 1, 0, 0, 0, 5, 0>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 6, 0>, &Blitter::Draw<0, 1, 0, 0, 0, 7, 0>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 0, 1>, &Blitter::Draw<0, 1, 0, 0, 0, 1, 1>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 2, 1>, &Blitter::Draw<0, 1, 0, 0, 0, 3, 1>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 4, 1>, &Blitter::Draw<0, 1, 0, 0, 0, 5, 1>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 6, 1>, &Blitter::Draw<0, 1, 0, 0, 0, 7, 1>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 0, 2>, &Blitter::Draw<0, 1, 0, 0, 0, 1, 2>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 2, 2>, &Blitter::Draw<0, 1, 0, 0, 0, 3, 2>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 4, 2>, &Blitter::Draw<0, 1, 0, 0, 0, 5, 2>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 6, 2>, &Blitter::Draw<0, 1, 0, 0, 0, 7, 2>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 0, 3>, &Blitter::Draw<0, 1, 0, 0, 0, 1, 3>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 2, 3>, &Blitter::Draw<0, 1, 0, 0, 0, 3, 3>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 4, 3>, &Blitter::Draw<0, 1, 0, 0, 0, 5, 3>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 6, 3>, &Blitter::Draw<0, 1, 0, 0, 0, 7, 3>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 0, 4>, &Blitter::Draw<0, 1, 0, 0, 0, 1, 4>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 2, 4>, &Blitter::Draw<0, 1, 0, 0, 0, 3, 4>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 4, 4>, &Blitter::Draw<0, 1, 0, 0, 0, 5, 4>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 6, 4>, &Blitter::Draw<0, 1, 0, 0, 0, 7, 4>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 0, 5>, &Blitter::Draw<0, 1, 0, 0, 0, 1, 5>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 2, 5>, &Blitter::Draw<0, 1, 0, 0, 0, 3, 5>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 4, 5>, &Blitter::Draw<0, 1, 0, 0, 0, 5, 5>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 6, 5>, &Blitter::Draw<0, 1, 0, 0, 0, 7, 5>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 0, 6>, &Blitter::Draw<0, 1, 0, 0, 0, 1, 6>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 2, 6>, &Blitter::Draw<0, 1, 0, 0, 0, 3, 6>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 4, 6>, &Blitter::Draw<0, 1, 0, 0, 0, 5, 6>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 6, 6>, &Blitter::Draw<0, 1, 0, 0, 0, 7, 6>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 0, 7>, &Blitter::Draw<0, 1, 0, 0, 0, 1, 7>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 2, 7>, &Blitter::Draw<0, 1, 0, 0, 0, 3, 7>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 4, 7>, &Blitter::Draw<0, 1, 0, 0, 0, 5, 7>,
-      &Blitter::Draw<0, 1, 0, 0, 0, 6, 7>, &Blitter::Draw<0, 1, 0, 0, 0, 7, 7>,
-  };
+  // Draws are batched until one of them reads pixels an earlier one writes
+  // (or writes pixels an earlier one reads). A batch is then rendered as
+  // horizontal bands of the destination, one band per thread; every band
+  // replays the whole batch in order, so overlapping draws keep their order.
+  enum : int32_t { kMaxBands = 8, kMinParallelPixels = 0x4000 };
 
-  static constexpr DrawMode DrawFlipNonTinedTransparentBlend[64] = {
-      &Blitter::Draw<0, 1, 1, 0, 1, 0, 0>, &Blitter::Draw<0, 1, 1, 0, 1, 1, 0>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 2, 0>, &Blitter::Draw<0, 1, 1, 0, 1, 3, 0>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 4, 0>, &Blitter::Draw<0, 1, 1, 0, 1, 5, 0>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 6, 0>, &Blitter::Draw<0, 1, 1, 0, 1, 7, 0>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 0, 1>, &Blitter::Draw<0, 1, 1, 0, 1, 1, 1>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 2, 1>, &Blitter::Draw<0, 1, 1, 0, 1, 3, 1>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 4, 1>, &Blitter::Draw<0, 1, 1, 0, 1, 5, 1>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 6, 1>, &Blitter::Draw<0, 1, 1, 0, 1, 7, 1>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 0, 2>, &Blitter::Draw<0, 1, 1, 0, 1, 1, 2>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 2, 2>, &Blitter::Draw<0, 1, 1, 0, 1, 3, 2>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 4, 2>, &Blitter::Draw<0, 1, 1, 0, 1, 5, 2>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 6, 2>, &Blitter::Draw<0, 1, 1, 0, 1, 7, 2>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 0, 3>, &Blitter::Draw<0, 1, 1, 0, 1, 1, 3>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 2, 3>, &Blitter::Draw<0, 1, 1, 0, 1, 3, 3>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 4, 3>, &Blitter::Draw<0, 1, 1, 0, 1, 5, 3>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 6, 3>, &Blitter::Draw<0, 1, 1, 0, 1, 7, 3>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 0, 4>, &Blitter::Draw<0, 1, 1, 0, 1, 1, 4>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 2, 4>, &Blitter::Draw<0, 1, 1, 0, 1, 3, 4>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 4, 4>, &Blitter::Draw<0, 1, 1, 0, 1, 5, 4>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 6, 4>, &Blitter::Draw<0, 1, 1, 0, 1, 7, 4>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 0, 5>, &Blitter::Draw<0, 1, 1, 0, 1, 1, 5>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 2, 5>, &Blitter::Draw<0, 1, 1, 0, 1, 3, 5>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 4, 5>, &Blitter::Draw<0, 1, 1, 0, 1, 5, 5>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 6, 5>, &Blitter::Draw<0, 1, 1, 0, 1, 7, 5>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 0, 6>, &Blitter::Draw<0, 1, 1, 0, 1, 1, 6>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 2, 6>, &Blitter::Draw<0, 1, 1, 0, 1, 3, 6>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 4, 6>, &Blitter::Draw<0, 1, 1, 0, 1, 5, 6>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 6, 6>, &Blitter::Draw<0, 1, 1, 0, 1, 7, 6>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 0, 7>, &Blitter::Draw<0, 1, 1, 0, 1, 1, 7>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 2, 7>, &Blitter::Draw<0, 1, 1, 0, 1, 3, 7>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 4, 7>, &Blitter::Draw<0, 1, 1, 0, 1, 5, 7>,
-      &Blitter::Draw<0, 1, 1, 0, 1, 6, 7>, &Blitter::Draw<0, 1, 1, 0, 1, 7, 7>,
-  };
+  std::vector<Command> batch_;
+  Clip batch_dst_;
+  Clip batch_src_;
+  int64_t batch_pixels_;
+  int32_t band_height_;
 
-  static constexpr DrawMode DrawFlipNonTinedNonTransparentBlend[64] = {
-      &Blitter::Draw<0, 1, 1, 0, 0, 0, 0>, &Blitter::Draw<0, 1, 1, 0, 0, 1, 0>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 2, 0>, &Blitter::Draw<0, 1, 1, 0, 0, 3, 0>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 4, 0>, &Blitter::Draw<0, 1, 1, 0, 0, 5, 0>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 6, 0>, &Blitter::Draw<0, 1, 1, 0, 0, 7, 0>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 0, 1>, &Blitter::Draw<0, 1, 1, 0, 0, 1, 1>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 2, 1>, &Blitter::Draw<0, 1, 1, 0, 0, 3, 1>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 4, 1>, &Blitter::Draw<0, 1, 1, 0, 0, 5, 1>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 6, 1>, &Blitter::Draw<0, 1, 1, 0, 0, 7, 1>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 0, 2>, &Blitter::Draw<0, 1, 1, 0, 0, 1, 2>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 2, 2>, &Blitter::Draw<0, 1, 1, 0, 0, 3, 2>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 4, 2>, &Blitter::Draw<0, 1, 1, 0, 0, 5, 2>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 6, 2>, &Blitter::Draw<0, 1, 1, 0, 0, 7, 2>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 0, 3>, &Blitter::Draw<0, 1, 1, 0, 0, 1, 3>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 2, 3>, &Blitter::Draw<0, 1, 1, 0, 0, 3, 3>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 4, 3>, &Blitter::Draw<0, 1, 1, 0, 0, 5, 3>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 6, 3>, &Blitter::Draw<0, 1, 1, 0, 0, 7, 3>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 0, 4>, &Blitter::Draw<0, 1, 1, 0, 0, 1, 4>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 2, 4>, &Blitter::Draw<0, 1, 1, 0, 0, 3, 4>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 4, 4>, &Blitter::Draw<0, 1, 1, 0, 0, 5, 4>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 6, 4>, &Blitter::Draw<0, 1, 1, 0, 0, 7, 4>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 0, 5>, &Blitter::Draw<0, 1, 1, 0, 0, 1, 5>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 2, 5>, &Blitter::Draw<0, 1, 1, 0, 0, 3, 5>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 4, 5>, &Blitter::Draw<0, 1, 1, 0, 0, 5, 5>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 6, 5>, &Blitter::Draw<0, 1, 1, 0, 0, 7, 5>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 0, 6>, &Blitter::Draw<0, 1, 1, 0, 0, 1, 6>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 2, 6>, &Blitter::Draw<0, 1, 1, 0, 0, 3, 6>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 4, 6>, &Blitter::Draw<0, 1, 1, 0, 0, 5, 6>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 6, 6>, &Blitter::Draw<0, 1, 1, 0, 0, 7, 6>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 0, 7>, &Blitter::Draw<0, 1, 1, 0, 0, 1, 7>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 2, 7>, &Blitter::Draw<0, 1, 1, 0, 0, 3, 7>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 4, 7>, &Blitter::Draw<0, 1, 1, 0, 0, 5, 7>,
-      &Blitter::Draw<0, 1, 1, 0, 0, 6, 7>, &Blitter::Draw<0, 1, 1, 0, 0, 7, 7>,
-  };
+  std::vector<std::thread> workers_;
+  std::mutex work_mutex_;
+  std::condition_variable work_cv_;
+  std::condition_variable done_cv_;
+  bool workers_running_;
+  uint32_t work_id_;
+  size_t work_left_;
+
+  void Queue(const Command &cmd);
+  void Flush();
+  void RenderBand(int32_t band);
+  void Worker(int32_t band, uint32_t work_id);
+  void StopWorkers();
+  void UpdateScreen();
+  // Hands the finished back buffer to the consumer.
+  void PresentScreen();
+
+  DrawStats *stats_;
+  capture::Writer capture_;
+  std::string capture_path_;
+  uint32_t capture_frames_;
+
+  std::atomic<uint64_t> busy_ns_;
 };
@@ -0,0 +1,218 @@
+// Replays a display list capture through the blitter with no CPU core, see
+// Blitter::StartCapture. Reports frame times, draw times per DrawMode and
+// frames whose screen hash differs from the one recorded. --compare-isa
+// instead runs the capture through the kernels of every instruction set the
+// host has and compares each with SSE2.
+//
+//   blitter_bench <capture> [--threads n] [--repeat n] [--profile]
+//                 [--compare-isa]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "blitter.h"
+#include "blitter_capture.h"
+#include "counters.h"
+
+static void PrintModes(const DrawStats &stats) {
+  struct Row {
+    uint32_t mode;
+    DrawStats::Mode stats;
+  };
+
+  std::vector<Row> rows;
+  uint64_t count = 0;
+  uint64_t ns = 0;
+  for (uint32_t mode = 0; mode < stats.modes.size(); mode++) {
+    if (!stats.modes[mode].count) continue;
+    rows.push_back({mode, stats.modes[mode]});
+    count += stats.modes[mode].count;
+    ns += stats.modes[mode].ns;
+  }
+  std::sort(rows.begin(), rows.end(),
+            [](const Row &a, const Row &b) { return a.stats.ns > b.stats.ns; });
+
+  std::cout << "draws: " << count << ", avg "
+            << (count ? ns / count : 0) << " ns per draw\n\n";
+  std::cout << "blend flip tined trans s d       draws     mpixels"
+               "    ms   avg ns   max ns\n";
+  for (const auto &row : rows) {
+    const auto &s = row.stats;
+    std::cout << std::setw(5) << ((row.mode >> 9) & 1) << std::setw(5)
+              << ((row.mode >> 8) & 1) << std::setw(6) << ((row.mode >> 7) & 1)
+              << std::setw(6) << ((row.mode >> 6) & 1) << std::setw(2)
+              << (row.mode & 7) << std::setw(2) << ((row.mode >> 3) & 7)
+              << std::setw(12) << s.count << std::setw(12) << std::fixed
+              << std::setprecision(2) << s.pixels / 1e6 << std::setw(6)
+              << s.ns / 1000000 << std::setw(9) << s.ns / s.count
+              << std::setw(9) << s.max_ns << "\n";
+  }
+}
+
+// Returns the number of instruction sets whose screens or final VRAM
+// differ from the SSE2 run. Each runs on a fresh blitter.
+static int32_t CompareIsas(std::span<uint8_t> ram, int32_t threads,
+                           const std::vector<uint8_t> &vram,
+                           const std::vector<capture::Frame> &frames) {
+  constexpr size_t kPixels = 320 * 240;
+  std::vector<uint16_t> screens;
+  std::vector<uint16_t> ref_vram;
+  int32_t diverged = 0;
+
+  for (int32_t i = Blitter::kSse2; i < Blitter::kIsaCount; i++) {
+    auto isa = static_cast<Blitter::Isa>(i);
+    counters::Counters counters;
+    auto blitter = std::make_unique<Blitter>(ram, counters);
+    blitter->SetThreads(threads);
+    std::cout << Blitter::GetIsaName(isa) << ": ";
+    if (!blitter->SetIsa(isa)) {
+      std::cout << "not supported\n";
+      continue;
+    }
+
+    blitter->LoadVram(vram);
+    size_t first = frames.size();
+    uint64_t screen_diff = 0;
+    for (size_t f = 0; f < frames.size(); f++) {
+      blitter->Replay(frames[f]);
+      const uint16_t *screen = blitter->GetBlitterData();
+      if (isa == Blitter::kSse2) {
+        screens.insert(screens.end(), screen, screen + kPixels);
+        continue;
+      }
+      const uint16_t *ref = &screens[f * kPixels];
+      uint64_t diff = 0;
+      for (size_t p = 0; p < kPixels; p++) diff += screen[p] != ref[p];
+      if (diff && first == frames.size()) first = f;
+      screen_diff += diff;
+    }
+
+    auto gpu = blitter->GetVram();
+    const uint16_t *pixels = reinterpret_cast<const uint16_t *>(gpu.data());
+    size_t count = gpu.size() / sizeof(uint16_t);
+    if (isa == Blitter::kSse2) {
+      ref_vram.assign(pixels, pixels + count);
+      std::cout << "reference\n";
+      continue;
+    }
+    uint64_t vram_diff = 0;
+    for (size_t p = 0; p < count; p++) vram_diff += pixels[p] != ref_vram[p];
+
+    if (!screen_diff && !vram_diff) {
+      std::cout << "matches\n";
+      continue;
+    }
+    diverged++;
+    std::cout << screen_diff << " screen pixels differ";
+    if (screen_diff) std::cout << ", first in frame " << first;
+    std::cout << ", " << vram_diff << " VRAM pixels differ\n";
+  }
+
+  return diverged;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    std::cout << "usage: blitter_bench <capture> [--threads n] [--repeat n] "
+                 "[--profile] [--compare-isa]\n";
+    return 1;
+  }
+
+  std::string path = argv[1];
+  int32_t threads = 1;
+  int32_t repeat = 1;
+  bool profile = false;
+  bool compare_isa = false;
+
+  for (int i = 2; i < argc; i++) {
+    if (!std::strcmp(argv[i], "--threads") && i + 1 < argc) {
+      threads = std::atoi(argv[++i]);
+    } else if (!std::strcmp(argv[i], "--repeat") && i + 1 < argc) {
+      repeat = std::max(1, std::atoi(argv[++i]));
+    } else if (!std::strcmp(argv[i], "--profile")) {
+      profile = true;
+    } else if (!std::strcmp(argv[i], "--compare-isa")) {
+      compare_isa = true;
+    }
+  }
+
+  std::vector<uint8_t> vram;
+  std::vector<capture::Frame> frames;
+  capture::Reader reader;
+  if (!reader.Open(path, vram)) {
+    std::cout << "can't read capture " << path << "\n";
+    return 1;
+  }
+  for (capture::Frame frame; reader.Next(frame);) {
+    frames.push_back(frame);
+  }
+
+  std::vector<uint8_t> ram(0x01000000);
+  if (compare_isa) {
+    if (frames.empty()) {
+      std::cout << "no frames in " << path << "\n";
+      return 1;
+    }
+    std::cout << frames.size() << " frames, " << threads << " thread(s)\n";
+    return CompareIsas(ram, threads, vram, frames) ? 2 : 0;
+  }
+
+  counters::Counters counters;
+  auto blitter =
+      std::make_unique<Blitter>(std::span<uint8_t>(ram), counters);
+  blitter->SetThreads(threads);
+
+  DrawStats stats;
+  if (profile) blitter->SetStats(&stats);
+
+  std::vector<double> times;
+  uint32_t mismatches = 0;
+
+  for (int32_t pass = 0; pass < repeat; pass++) {
+    blitter->LoadVram(vram);
+    for (const auto &frame : frames) {
+      auto start = std::chrono::steady_clock::now();
+      blitter->Replay(frame);
+      times.push_back(std::chrono::duration<double, std::milli>(
+                          std::chrono::steady_clock::now() - start)
+                          .count());
+
+      uint64_t hash = capture::Hash(blitter->GetBlitterData(),
+                                    320 * 240 * sizeof(uint16_t));
+      if (pass == 0 && hash != frame.screen_hash) mismatches++;
+    }
+  }
+
+  if (times.empty()) {
+    std::cout << "no frames in " << path << "\n";
+    return 1;
+  }
+
+  std::vector<double> sorted = times;
+  std::sort(sorted.begin(), sorted.end());
+  double total = 0;
+  for (double t : times) total += t;
+
+  std::cout << std::fixed << std::setprecision(3);
+  std::cout << frames.size() << " frames x " << repeat << ", " << threads
+            << " thread(s)" << (profile ? ", profiling" : "") << "\n";
+  std::cout << "frame ms: avg " << total / times.size() << ", min "
+            << sorted.front() << ", p50 " << sorted[sorted.size() / 2]
+            << ", p99 " << sorted[sorted.size() * 99 / 100] << ", max "
+            << sorted.back() << "\n";
+  std::cout << "screen hash mismatches: " << mismatches << "\n";
+
+  if (profile) {
+    std::cout << "\n";
+    PrintModes(stats);
+  }
+
+  return mismatches ? 2 : 0;
+}
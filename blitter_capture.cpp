@@ -0,0 +1,80 @@
+#include "blitter_capture.h"
+
+namespace capture {
+
+static constexpr uint32_t kMagic = 0x4c42434e;  // "NCBL"
+static constexpr uint32_t kVersion = 1;
+
+uint64_t Hash(const void *data, size_t size) {
+  const uint8_t *p = static_cast<const uint8_t *>(data);
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for (size_t i = 0; i < size; i++) {
+    hash = (hash ^ p[i]) * 0x100000001b3ull;
+  }
+  return hash;
+}
+
+template <typename T>
+static void Put(std::ofstream &file, const T &value) {
+  file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T>
+static bool Get(std::ifstream &file, T &value) {
+  return static_cast<bool>(
+      file.read(reinterpret_cast<char *>(&value), sizeof(T)));
+}
+
+bool Writer::Open(const std::string &path, const uint8_t *vram,
+                  size_t vram_size) {
+  file_.open(path, std::ios::binary | std::ios::trunc);
+  if (!file_.is_open()) return false;
+
+  Put(file_, kMagic);
+  Put(file_, kVersion);
+  Put(file_, static_cast<uint32_t>(vram_size));
+  file_.write(reinterpret_cast<const char *>(vram), vram_size);
+  return file_.good();
+}
+
+void Writer::Write(const Frame &frame) {
+  Put(file_, frame.regs);
+  Put(file_, frame.list_addr);
+  Put(file_, static_cast<uint32_t>(frame.list.size()));
+  file_.write(reinterpret_cast<const char *>(frame.list.data()),
+              frame.list.size() * sizeof(uint16_t));
+  Put(file_, frame.screen_hash);
+}
+
+void Writer::Close() { file_.close(); }
+
+bool Reader::Open(const std::string &path, std::vector<uint8_t> &vram) {
+  file_.open(path, std::ios::binary);
+  if (!file_.is_open()) return false;
+
+  uint32_t magic, version, vram_size;
+  if (!Get(file_, magic) || !Get(file_, version) || !Get(file_, vram_size)) {
+    return false;
+  }
+  if (magic != kMagic || version != kVersion) return false;
+
+  vram.resize(vram_size);
+  return static_cast<bool>(
+      file_.read(reinterpret_cast<char *>(vram.data()), vram_size));
+}
+
+bool Reader::Next(Frame &frame) {
+  uint32_t size;
+  if (!Get(file_, frame.regs) || !Get(file_, frame.list_addr) ||
+      !Get(file_, size)) {
+    return false;
+  }
+  frame.list.resize(size);
+  if (!file_.read(reinterpret_cast<char *>(frame.list.data()),
+                  size * sizeof(uint16_t))) {
+    return false;
+  }
+  return Get(file_, frame.screen_hash);
+}
+
+}  // namespace capture
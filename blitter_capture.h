@@ -0,0 +1,45 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Display list capture file: a VRAM snapshot followed by the display lists
+// the blitter ran, in order. VRAM is only written by the blitter, so the
+// snapshot plus the lists reproduce every frame without the CPU core.
+namespace capture {
+
+struct Frame {
+  std::array<uint8_t, 0x100> regs;
+  uint32_t list_addr;
+  // The display list as read by Blitter::Run, including upload data.
+  std::vector<uint16_t> list;
+  // Hash of the screen after the list ran.
+  uint64_t screen_hash;
+};
+
+uint64_t Hash(const void *data, size_t size);
+
+class Writer {
+ public:
+  bool Open(const std::string &path, const uint8_t *vram, size_t vram_size);
+  void Write(const Frame &frame);
+  void Close();
+  bool IsOpen() const { return file_.is_open(); }
+
+ private:
+  std::ofstream file_;
+};
+
+class Reader {
+ public:
+  bool Open(const std::string &path, std::vector<uint8_t> &vram);
+  bool Next(Frame &frame);
+
+ private:
+  std::ifstream file_;
+};
+
+}  // namespace capture
@@ -0,0 +1,219 @@
+// Checks the AVX2 and AVX-512BW draw kernels against SSE2. Every DrawTable
+// mode, blended or copied, flipped, tinted and transparent, with every src
+// and dst alpha mode, gets a display list of draws from random VRAM with
+// random alphas, tints and unaligned widths, some of them straddling the
+// clip edges. Each list runs on one blitter per instruction set and the
+// screens must match the SSE2 one byte for byte.
+//
+//   blitter_test
+
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "blitter.h"
+#include "counters.h"
+
+static std::mt19937 rng(1234);
+
+static uint32_t Random(uint32_t max) {
+  return std::uniform_int_distribution<uint32_t>(0, max)(rng);
+}
+
+// Builds a display list in RAM, byte reversed as the blitter reads it.
+class List {
+ public:
+  List(std::vector<uint8_t> &ram, uint32_t addr) : ram_(ram), addr_(addr) {}
+
+  void Put16(uint16_t value) {
+    *(uint16_t *)&ram_[ram_.size() - addr_ - 2] = value;
+    addr_ += 2;
+  }
+
+  void Put32(uint32_t value) {
+    *(uint32_t *)&ram_[ram_.size() - addr_ - 4] = value;
+    addr_ += 4;
+  }
+
+  void Upload(uint32_t x, uint32_t y, uint32_t w, uint32_t h) {
+    Put16(0x2000);
+    for (int32_t i = 0; i < 3; i++) Put16(0);
+    Put16(x);
+    Put16(y);
+    Put16(w - 1);
+    Put16(h - 1);
+    for (uint32_t i = 0; i < w * h; i++) Put16(Random(0xffff));
+  }
+
+ private:
+  std::vector<uint8_t> &ram_;
+  uint32_t addr_;
+};
+
+// The screen window, also the clip rect.
+static constexpr int32_t kScreenX = 64;
+static constexpr int32_t kScreenY = 48;
+static constexpr int32_t kWidth = 320;
+static constexpr int32_t kHeight = 240;
+// Source pixels, away from the window so no draw reads its destination and
+// falls back to SSE2.
+static constexpr uint32_t kSrcX = 1024;
+static constexpr uint32_t kSrcY = 2048;
+static constexpr uint32_t kSrcW = 512;
+static constexpr uint32_t kSrcH = 128;
+
+static constexpr uint32_t kListAddr = 0x00100000;
+
+struct Unit {
+  counters::Counters counters;
+  std::unique_ptr<Blitter> blitter;
+};
+
+static void RunList(Unit &unit) {
+  Blitter &blitter = *unit.blitter;
+  blitter.Write32(0x0008, kListAddr);
+  blitter.Write32(0x0004, 1);
+  // The IRQ counter waits for the list, as the CPU sees it.
+  while (blitter.Read32(0x0010) == 0) {
+    unit.counters.icount = 0;
+    unit.counters.TestCounters();
+  }
+}
+
+static std::string ModeName(uint32_t blend, uint32_t flip_x, uint32_t tinted,
+                            uint32_t transparent, uint32_t s_mode,
+                            uint32_t d_mode) {
+  std::string name = blend ? "blend s" + std::to_string(s_mode) + " d" +
+                                 std::to_string(d_mode)
+                           : "copy";
+  if (flip_x) name += " flip";
+  if (tinted) name += " tint";
+  if (transparent) name += " trans";
+  return name;
+}
+
+// Widths around every kernel's step, 8, 16 and 32 pixels, and the clip.
+static const int32_t kWidths[] = {1,  2,  7,  8,  9,   15,  16,  17,
+                                  31, 32, 33, 63, 64,  65,  100, 161,
+                                  255, 256, 257, 319, 320, 321, 380};
+
+int main() {
+  std::vector<uint8_t> ram(0x01000000);
+  std::vector<std::unique_ptr<Unit>> units;
+  std::vector<Blitter::Isa> isas;
+
+  for (int32_t i = Blitter::kSse2; i < Blitter::kIsaCount; i++) {
+    auto isa = static_cast<Blitter::Isa>(i);
+    auto unit = std::make_unique<Unit>();
+    unit->blitter = std::make_unique<Blitter>(ram, unit->counters);
+    if (!unit->blitter->SetIsa(isa)) {
+      std::cout << Blitter::GetIsaName(isa) << ": not supported\n";
+      continue;
+    }
+    unit->blitter->Init([](int32_t) {});
+    unit->blitter->SetThreads(1);
+    unit->blitter->Write32(0x0014, kScreenX);
+    unit->blitter->Write32(0x0018, kScreenY);
+    unit->blitter->Write32(0x0040, kScreenX);
+    unit->blitter->Write32(0x0044, kScreenY);
+    units.push_back(std::move(unit));
+    isas.push_back(isa);
+  }
+
+  {
+    List list(ram, kListAddr);
+    list.Upload(kSrcX, kSrcY, kSrcW, kSrcH);
+    list.Put16(0);
+  }
+  for (auto &unit : units) RunList(*unit);
+
+  std::vector<uint32_t> failed(units.size());
+  uint32_t modes = 0;
+  uint32_t draws = 0;
+  for (uint32_t blend = 0; blend < 2; blend++) {
+    for (uint32_t mode = 0; mode < (blend ? 64u : 1u); mode++) {
+      for (uint32_t flags = 0; flags < 8; flags++) {
+        uint32_t s_mode = mode & 7;
+        uint32_t d_mode = mode >> 3;
+        uint32_t flip_x = flags & 1;
+        uint32_t tinted = (flags >> 1) & 1;
+        uint32_t transparent = (flags >> 2) & 1;
+
+        List list(ram, kListAddr);
+        list.Put16(0xc000);
+        list.Put16(1);
+        list.Upload(kScreenX, kScreenY, kWidth, kHeight);
+        for (int32_t w : kWidths) {
+          int32_t h = 1 + Random(24);
+          // Mostly inside, a quarter crossing the left or top clip edge and
+          // a quarter crossing the right or bottom one.
+          int32_t x = kScreenX + Random(kWidth - 1);
+          int32_t y = kScreenY + Random(kHeight - 1);
+          switch (Random(3)) {
+            case 0:
+              x = kScreenX - Random(w - 1);
+              y = kScreenY - Random(h - 1);
+              break;
+            case 1:
+              x = kScreenX + kWidth - 1 - Random(w - 1);
+              y = kScreenY + kHeight - 1 - Random(h - 1);
+              break;
+          }
+
+          uint32_t alpha = Random(0xffff);
+          // One of the alphas that make a blend a plain copy.
+          if (blend && Random(7) == 0) alpha = 0x1f1f;
+          uint32_t tine = tinted ? Random(0x00ffffff) : 0x00808080;
+          if (tinted && tine == 0x00808080) tine++;
+
+          list.Put16(0x1000 | d_mode | s_mode << 4 | transparent << 8 |
+                     blend << 9 | Random(1) << 10 | flip_x << 11);
+          list.Put16(alpha);
+          list.Put16(kSrcX + Random(kSrcW - w));
+          list.Put16(kSrcY + Random(kSrcH - 1 - h));
+          list.Put16(x & 0xffff);
+          list.Put16(y & 0xffff);
+          list.Put16(w - 1);
+          list.Put16(h - 1);
+          list.Put32(tine);
+          draws++;
+        }
+        list.Put16(0);
+        modes++;
+
+        std::vector<uint16_t> want;
+        for (size_t i = 0; i < units.size(); i++) {
+          RunList(*units[i]);
+          uint16_t *screen = units[i]->blitter->GetBlitterData();
+          if (i == 0) {
+            want.assign(screen, screen + kWidth * kHeight);
+            continue;
+          }
+          if (std::memcmp(screen, want.data(), want.size() * 2)) {
+            if (!failed[i]) {
+              std::cout << "  " << Blitter::GetIsaName(isas[i])
+                        << " differs: "
+                        << ModeName(blend, flip_x, tinted, transparent,
+                                    s_mode, d_mode)
+                        << "\n";
+            }
+            failed[i]++;
+          }
+        }
+      }
+    }
+  }
+
+  uint32_t total = 0;
+  std::cout << modes << " modes, " << draws << " draws\n";
+  for (size_t i = 1; i < units.size(); i++) {
+    std::cout << Blitter::GetIsaName(isas[i]) << ": " << failed[i]
+              << " modes differ from SSE2\n";
+    total += failed[i];
+  }
+  return total ? 2 : 0;
+}
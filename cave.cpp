@@ -1,60 +1,85 @@
 ﻿
 #include "cave.h"
 
+#include <algorithm>
+#include <chrono>
+#include <iostream>
 #include <thread>
 
-Cave3rd::Cave3rd() : gpu_(ram_, cpu_) {
+#include "frame_pacer.h"
+#include "rom_cache.h"
+
+Cave3rd::Cave3rd(bool threaded)
+    : emu_thread_(nullptr),
+      gpu_(ram_, cpu_),
+      audio_tick_(counters::Counter::kEnable, kAudioBlock,
+                  sh3::Cpu::kHz / kSampleRate,
+                  [this](counters::Counter *) { RenderAudio(); }) {
   ram_.fill(0);
+  ram_dirty_.fill(0);
   bios_.fill(0);
   games_list_.Init();
-  emu_thread_ = new std::thread(&Cave3rd::EmuThread, this);
+  if (threaded) {
+    emu_thread_ = new std::thread(&Cave3rd::EmuThread, this);
+  }
 }
 
 Cave3rd::~Cave3rd() {
-  Stop();
-  emu_thread_->join();
-  delete emu_thread_;
+  if (emu_thread_) {
+    Stop();
+    emu_thread_->join();
+    delete emu_thread_;
+  }
 }
 
-void Cave3rd::Start() {
-  msg_mutex_.lock();
-  message_ = kMsgStart;
-  msg_mutex_.unlock();
-}
+void Cave3rd::Start() { Post(kMsgStart); }
+
+void Cave3rd::Stop() { Post(kMsgStop); }
 
-void Cave3rd::Stop() {
-  msg_mutex_.lock();
-  message_ = kMsgStop;
-  msg_mutex_.unlock();
+void Cave3rd::Post(ThreadMessage message) {
+  messages_.fetch_or(message);
+  messages_.notify_one();
 }
 
+// One emulated frame per frame period, the pacer sleeps off the rest.
+// Messages are taken between frames, an idle thread blocks until one
+// arrives. Requests that arrived together run in the order below.
 void Cave3rd::EmuThread() {
-  bool stop = false;
+  FramePacer pacer(kFrameRate);
 
   while (true) {
-    msg_mutex_.lock();
-    auto msg = message_;
-    message_ = kMsgNone;
-    msg_mutex_.unlock();
-
-    switch (msg) {
-      case kMsgStart:
-        Init();
-        running_ = true;
-        break;
-      case kMsgStop:
-        Close();
-        running_ = false;
-        stop = true;
-        break;
+    uint32_t messages = messages_.exchange(0);
+    if (messages & kMsgStart) {
+      Init();
+      running_ = true;
+      pacer.Reset();
+    }
+    if ((messages & kMsgSave) && running_) {
+      SaveState(GetStatePath());
+    }
+    if ((messages & kMsgLoad) && running_ && LoadState(GetStatePath())) {
+      pacer.Reset();
+    }
+    if (messages & kMsgStop) {
+      Close();
+      running_ = false;
+      return;
     }
 
-    if (stop) {
-      break;
+    if (!running_) {
+      messages_.wait(0);
+      continue;
     }
 
-    if (running_) {
-      Execute();
+    if (!rewinding_) {
+      RunFrame();
+    } else {
+      StepRewind();
+    }
+    if (turbo_) {
+      pacer.Reset();
+    } else {
+      pacer.Wait();
     }
   }
 }
@@ -65,45 +90,19 @@ void Cave3rd::Init() {
 
   // BIOS
 
-  mem_handler.read8 = [this](uint32_t addr) -> uint8_t {
-    return BiosRead<uint8_t>(addr);
-  };
-  mem_handler.read16 = [this](uint32_t addr) -> uint16_t {
-    return BiosRead<uint16_t>(addr);
-  };
-  mem_handler.read32 = [this](uint32_t addr) -> uint32_t {
-    return BiosRead<uint32_t>(addr);
-  };
-  mem_handler.write8 = nullptr;
-  mem_handler.write16 = nullptr;
-  mem_handler.write32 = nullptr;
-  map.push_back(sh3::Map(kBiosBase, kBiosSize, mem_handler));
+  map.push_back(sh3::Map(kBiosBase, kBiosSize, bios_.data(), false));
 
   // RAM
 
-  mem_handler.read8 = [this](uint32_t addr) -> uint8_t {
-    return RamRead<uint8_t>(addr);
-  };
-  mem_handler.read16 = [this](uint32_t addr) -> uint16_t {
-    return RamRead<uint16_t>(addr);
-  };
-  mem_handler.read32 = [this](uint32_t addr) -> uint32_t {
-    return RamRead<uint32_t>(addr);
-  };
-  mem_handler.write8 = [this](uint32_t addr, uint8_t value) -> void {
-    RamWrite<uint8_t>(addr, value);
-  };
-  mem_handler.write16 = [this](uint32_t addr, uint16_t value) -> void {
-    RamWrite<uint16_t>(addr, value);
-  };
-  mem_handler.write32 = [this](uint32_t addr, uint32_t value) -> void {
-    RamWrite<uint32_t>(addr, value);
-  };
-  map.push_back(sh3::Map(kRamBase, kRamSize, mem_handler));
+  map.push_back(
+      sh3::Map(kRamBase, kRamSize, ram_.data(), true, ram_dirty_.data()));
 
   // NAND
 
-  mem_handler.read8 = [this](uint32_t addr) -> uint8_t { return nand_.Read(); };
+  mem_handler.read8 = [this](uint32_t addr) -> uint8_t {
+    cpu_.CountVolatileRead();
+    return nand_.Read();
+  };
   mem_handler.write8 = [this](uint32_t addr, uint8_t value) -> void {
     nand_.Write(value);
   };
@@ -117,6 +116,7 @@ void Cave3rd::Init() {
   // SERIAL EEPROM/RTC
 
   mem_handler.read8 = [this](uint32_t addr) -> uint8_t {
+    cpu_.CountVolatileRead();
     return rtc9701_.Read8(addr);
   };
   mem_handler.write8 = [this](uint32_t addr, uint8_t value) -> void {
@@ -162,6 +162,9 @@ void Cave3rd::Init() {
   map.push_back(sh3::Map(0xB0400000, 0x00010000, mem_handler));
 
   cpu_.Init(map);
+  cpu_.AddCodeRegion(kBiosBase, kBiosSize);
+  cpu_.AddCodeRegion(kRamBase, kRamSize);
+  cpu_.SetJit(jit_);
   cpu_.SetClockRate(4);
   input_data_ = 0xffffffff;
   cpu_.SetIoRead(2, [this]() -> uint8_t {
@@ -178,14 +181,26 @@ void Cave3rd::Init() {
   nand_.Init(&games_list_);
   games_list_.LoadGame(game_idx_, game_path_, true);
 
-  for (int i = 0; i < kBiosSize; i++) {
-    bios_[kBiosSize - i - 1] = games_list_.GetGameRomValue(0x08400000 + i);
+  spu_.ResetCache(static_cast<size_t>(std::max(pcm_cache_size_, 0)) << 20);
+  std::span<uint8_t> images[] = {bios_, spu_.GetRom()};
+  std::string name = games_list_.GetGameField(game_idx_, eGameFieldName);
+  RomCache cache(rom_cache_);
+  if (rom_cache_.empty() ||
+      !cache.Load(name, games_list_.GetRomKey(), images)) {
+    games_list_.ReadGameRom(0x08400000, bios_, true);
+    games_list_.ReadGameRom(0x08800000, spu_.GetRom());
+    if (!rom_cache_.empty()) {
+      cache.Save(name, games_list_.GetRomKey(), images);
+    }
   }
-
-  for (int i = 0; i < Ymz770::kSpuSize; i++) {
-    spu_.WriteRom(i, games_list_.GetGameRomValue(0x08800000 + i));
+  if (pcm_predecode_) {
+    spu_.StartPredecode();
   }
 
+  gpu_.SetThreads(blitter_threads_);
+  if (!blitter_capture_.empty()) {
+    gpu_.StartCapture(blitter_capture_, blitter_capture_frames_);
+  }
   gpu_.Init([this](int32_t code) -> void {
     if (code >= 0) {
       cpu_.SetInterruptPending(code);
@@ -193,8 +208,225 @@ void Cave3rd::Init() {
       cpu_.ResetInterruptPending(-code);
     }
   });
+  cpu_.Insert(&audio_tick_);
+  ResetRewind();
+}
+
+void Cave3rd::RenderAudio() {
+  auto start = std::chrono::steady_clock::now();
+  int16_t block[kAudioBlock * 2];
+  spu_.Render(block, kAudioBlock);
+  // The frame pacer keeps this at the device's rate and the audio callback
+  // trims the small drift left; a full ring, after a stall or while no
+  // device drains it, drops the block.
+  audio_.Write(block, kAudioBlock);
+  audio_ns_ += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now() - start)
+                   .count();
 }
 
 void Cave3rd::Close() {}
 
-void Cave3rd::Execute() { cpu_.Run(); }
\ No newline at end of file
+std::filesystem::path Cave3rd::GetStatePath() const {
+  std::string name = games_list_.GetGameField(game_idx_, eGameFieldName);
+  return std::filesystem::path(state_dir_) / (name + ".state");
+}
+
+static void PutString(state::Writer &writer, const std::string &value) {
+  writer.Put(static_cast<uint32_t>(value.size()));
+  writer.Put(value.data(), value.size());
+}
+
+static std::string GetString(state::Reader &reader) {
+  std::string value(std::min(reader.Get<uint32_t>(), 0x1000u), '\0');
+  reader.Get(value.data(), value.size());
+  return value;
+}
+
+void Cave3rd::SaveMachine(state::Writer &writer) {
+  cpu_.SaveState(writer);
+  // Waits for the blitter, nothing touches ram_ or VRAM after it.
+  gpu_.SaveState(writer);
+  spu_.SaveState(writer);
+  nand_.SaveState(writer);
+  rtc9701_.SaveState(writer);
+  writer.Begin(state::Tag("CAVE"), 1);
+  cpu_.SaveCounter(writer, &audio_tick_);
+}
+
+bool Cave3rd::LoadMachine(const std::vector<state::Chunk> &chunks) {
+  auto reader = [&](const char(&tag)[5]) {
+    return state::Reader(state::Find(chunks, state::Tag(tag)));
+  };
+  state::Reader readers[] = {reader("CPU "), reader("GPU "),
+                             reader("YMZ "), reader("NAND"),
+                             reader("RTC "), reader("CAVE")};
+  auto &[cpu, gpu, spu, nand, rtc, cave] = readers;
+  // The cpu empties the scheduler, every other counter is queued again
+  // after it.
+  cpu_.LoadState(cpu);
+  gpu_.LoadState(gpu);
+  spu_.LoadState(spu);
+  nand_.LoadState(nand);
+  rtc9701_.LoadState(rtc);
+  cpu_.LoadCounter(cave, &audio_tick_);
+  return std::all_of(std::begin(readers), std::end(readers),
+                     [](const state::Reader &r) { return r.IsDone(); });
+}
+
+void Cave3rd::SaveState(const std::filesystem::path &path) {
+  state::Writer writer(saver_.TakeSpare());
+  writer.Begin(state::Tag("HEAD"), 1);
+  PutString(writer, games_list_.GetGameField(game_idx_, eGameFieldName));
+  PutString(writer, games_list_.GetRomKey());
+  SaveMachine(writer);
+  writer.PutMemory(state::Tag("VRAM"), 1, gpu_.GetVram());
+  writer.PutMemory(state::Tag("RAM "), 1, ram_);
+
+  saver_.Save(path, std::move(writer.GetChunks()));
+}
+
+bool Cave3rd::LoadState(const std::filesystem::path &path) {
+  // A save still being written may be the one asked for.
+  saver_.Wait();
+  std::vector<state::Chunk> chunks;
+  if (!state::Load(path, chunks)) {
+    std::cout << "Can't read state " << path.string() << std::endl;
+    return false;
+  }
+
+  state::Reader head(state::Find(chunks, state::Tag("HEAD")));
+  std::string name = GetString(head);
+  std::string key = GetString(head);
+  if (!head.IsDone() ||
+      name != games_list_.GetGameField(game_idx_, eGameFieldName) ||
+      key != games_list_.GetRomKey()) {
+    std::cout << "State " << path.string() << " is for another game"
+              << std::endl;
+    return false;
+  }
+
+  bool done = LoadMachine(chunks);
+  state::Reader vram(state::Find(chunks, state::Tag("VRAM")));
+  state::Reader ram(state::Find(chunks, state::Tag("RAM ")));
+  vram.GetMemory(gpu_.GetVram());
+  ram.GetMemory(ram_);
+  if (!done || !vram.IsDone() || !ram.IsDone()) {
+    std::cout << "State " << path.string() << " is corrupt, restarting"
+              << std::endl;
+    ram_.fill(0);
+    Init();
+    return false;
+  }
+  ResetRewind();
+  return true;
+}
+
+// The reference copy is taken here, between frames.
+void Cave3rd::ResetRewind() {
+  rewind_frames_ = 0;
+  if (rewind_size_ <= 0) {
+    rewind_.Reset(0, {}, {});
+    return;
+  }
+  state::Writer writer;
+  SaveMachine(writer);
+  state::Pack(writer.GetChunks(), rewind_state_);
+  rewind_.Reset(static_cast<size_t>(rewind_size_) << 20,
+                {{ram_, ram_dirty_}, {gpu_.GetVram(), gpu_.GetVramDirty()}},
+                rewind_state_);
+}
+
+void Cave3rd::CaptureRewind() {
+  auto start = std::chrono::steady_clock::now();
+  state::Writer writer;
+  SaveMachine(writer);
+  state::Pack(writer.GetChunks(), rewind_state_);
+  rewind_.Capture(rewind_state_);
+  rewind_frames_ = 0;
+  rewind_ns_ += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start)
+                    .count();
+}
+
+// Frames run since the last snapshot are undone first, then one snapshot
+// per call.
+bool Cave3rd::StepRewind() {
+  if (!rewind_.IsEnabled() || (rewind_frames_ == 0 && !rewind_.Drop())) {
+    return false;
+  }
+  gpu_.Sync();
+  std::vector<state::Chunk> chunks;
+  state::Unpack(rewind_.Restore(), chunks);
+  LoadMachine(chunks);
+  rewind_frames_ = 0;
+  return true;
+}
+
+void Cave3rd::LoadConfig(const toml::table &data) {
+  if (data.contains("jit")) {
+    jit_ = data.at("jit").as_boolean();
+  }
+  if (data.contains("rom_cache")) {
+    rom_cache_ = toml::get<std::string>(data.at("rom_cache"));
+  }
+  if (data.contains("turbo")) {
+    turbo_ = data.at("turbo").as_boolean();
+  }
+  if (data.contains("pcm_cache_size")) {
+    pcm_cache_size_ =
+        static_cast<int32_t>(data.at("pcm_cache_size").as_integer());
+  }
+  if (data.contains("pcm_predecode")) {
+    pcm_predecode_ = data.at("pcm_predecode").as_boolean();
+  }
+  if (data.contains("blitter_threads")) {
+    blitter_threads_ =
+        static_cast<int32_t>(data.at("blitter_threads").as_integer());
+  }
+  if (data.contains("state_dir")) {
+    state_dir_ = toml::get<std::string>(data.at("state_dir"));
+  }
+  if (data.contains("rewind_size")) {
+    rewind_size_ = static_cast<int32_t>(data.at("rewind_size").as_integer());
+  }
+  if (data.contains("rewind_interval")) {
+    rewind_interval_ = std::max(
+        1, static_cast<int32_t>(data.at("rewind_interval").as_integer()));
+  }
+  if (data.contains("blitter_capture")) {
+    blitter_capture_ = toml::get<std::string>(data.at("blitter_capture"));
+  }
+  if (data.contains("blitter_capture_frames")) {
+    blitter_capture_frames_ =
+        static_cast<int32_t>(data.at("blitter_capture_frames").as_integer());
+  }
+}
+
+void Cave3rd::SaveConfig(toml::table &data) {
+  data["jit"] = jit_;
+  data["turbo"] = turbo_.load();
+  data["rom_cache"] = rom_cache_;
+  data["pcm_cache_size"] = pcm_cache_size_;
+  data["pcm_predecode"] = pcm_predecode_;
+  data["blitter_threads"] = blitter_threads_;
+  data["state_dir"] = state_dir_;
+  data["rewind_size"] = rewind_size_;
+  data["rewind_interval"] = rewind_interval_;
+  if (!blitter_capture_.empty()) {
+    data["blitter_capture"] = blitter_capture_;
+    data["blitter_capture_frames"] = blitter_capture_frames_;
+  }
+}
+
+void Cave3rd::Execute() { cpu_.Run(); }
+
+void Cave3rd::RunFrame() {
+  uint64_t end = cpu_.GetCycle() + kFrameCycles;
+  while (cpu_.GetCycle() < end) {
+    Execute();
+  }
+  if (rewind_.IsEnabled() && ++rewind_frames_ >= rewind_interval_) {
+    CaptureRewind();
+  }
+}
\ No newline at end of file
@@ -1,17 +1,22 @@
 ﻿#pragma once
 
 #include <array>
+#include <atomic>
 #include <cstdint>
 #include <filesystem>
-#include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
+#include "audio_ring.h"
 #include "blitter.h"
 #include "counters.h"
+#include "iconfig.h"
 #include "nand.h"
+#include "rewind.h"
 #include "roms.h"
 #include "rtc9701.h"
+#include "save_state.h"
 #include "sh3.h"
 #include "ymz770.h"
 
@@ -25,66 +30,130 @@ enum : uint32_t {
   kRamBase = 0x0c000000,
 };
 
-class Cave3rd {
+class Cave3rd : public config::IConfig {
  public:
-  Cave3rd();
+  // Without a thread the owner drives emulation with Boot() and RunFrame().
+  explicit Cave3rd(bool threaded = true);
   ~Cave3rd();
 
   void Start();
   void Stop();
   uint16_t *GetBlitterData() { return gpu_.GetBlitterData(); }
-  int16_t GetNextSample() { return spu_.GetNextSample(); }
+  // Audio is rendered in emulated time, the device callback drains it.
+  static constexpr uint32_t kSampleRate = 16000;
+  size_t ReadAudio(int16_t *out, size_t n) { return audio_.Read(out, n); }
+  size_t GetAudioFill() const { return audio_.GetFill(); }
   void SetInputState(uint32_t input) { input_data_ = input; }
+  // Runs as fast as the host allows instead of at the game's frame rate.
+  void SetTurbo(bool enable) { turbo_ = enable; }
+  bool GetTurbo() const { return turbo_; }
+  // While set, each frame steps back one snapshot instead of running.
+  void SetRewinding(bool enable) { rewinding_ = enable; }
+  // Snapshots of the running game in <state_dir>/<game>.state, taken
+  // between frames.
+  void QueueSaveState() { Post(kMsgSave); }
+  void QueueLoadState() { Post(kMsgLoad); }
   GamesList &GetGameList() { return games_list_; }
   void SetGame(int idx, std::string path) {
     game_idx_ = idx;
     game_path_ = path;
   }
 
+  // Headless runs, see neocave_bench.cpp.
+  static constexpr double kFrameRate = 60.0178;
+  static constexpr uint64_t kFrameCycles =
+      static_cast<uint64_t>(sh3::Cpu::kHz / kFrameRate);
+  void Boot() { Init(); }
+  void RunFrame();
+  void SetJit(bool enable) { jit_ = enable; }
+  void SetBlitterThreads(int32_t threads) { blitter_threads_ = threads; }
+  void SetPcmCacheSize(int32_t size) { pcm_cache_size_ = size; }
+  void SetRewindSize(int32_t size) { rewind_size_ = size; }
+  uint64_t GetCycle() const { return cpu_.GetCycle(); }
+  uint64_t GetIdleCycles() const { return cpu_.GetIdleCycles(); }
+  uint64_t GetBlitterNs() const { return gpu_.GetBusyNs(); }
+  uint64_t GetAudioNs() const { return audio_ns_; }
+  uint64_t GetRewindNs() const { return rewind_ns_; }
+  const RewindBuffer &GetRewind() const { return rewind_; }
+  // The file is compressed and written on another thread, WaitSaveState()
+  // blocks until it is and returns false if it couldn't be written, which
+  // is also logged. A state that doesn't fit the loaded game is refused, a
+  // corrupt one restarts it.
+  void SaveState(const std::filesystem::path &path);
+  bool LoadState(const std::filesystem::path &path);
+  bool WaitSaveState() { return saver_.Wait(); }
+
+  void LoadConfig(const toml::table &data) override;
+  void SaveConfig(toml::table &data) override;
+
  private:
   bool running_ = false;
+  std::atomic<bool> turbo_ = false;
+  std::atomic<bool> rewinding_ = false;
+  bool jit_ = false;
+  // Directory of laid out rom images, empty disables the cache.
+  std::string rom_cache_ = "cache";
+  // Decoded sound sample cache in MiB, 0 disables it.
+  int32_t pcm_cache_size_ = 16;
+  bool pcm_predecode_ = true;
+  int32_t blitter_threads_ = 0;
+  std::string blitter_capture_;
+  int32_t blitter_capture_frames_ = 600;
+  std::string state_dir_ = "states";
+  // Rewind history in MiB, 0 disables it, and frames between snapshots.
+  int32_t rewind_size_ = 256;
+  int32_t rewind_interval_ = 4;
   int game_idx_;
   std::string game_path_;
 
-  enum ThreadMessage { kMsgNone = 0, kMsgStart, kMsgStop };
+  // One bit per request, so a request posted before the thread took the
+  // previous one isn't lost.
+  enum ThreadMessage : uint32_t {
+    kMsgStart = 1 << 0,
+    kMsgStop = 1 << 1,
+    kMsgSave = 1 << 2,
+    kMsgLoad = 1 << 3,
+  };
 
-  ThreadMessage message_ = kMsgNone;
+  std::atomic<uint32_t> messages_ = 0;
 
   std::thread *emu_thread_;
-  std::mutex msg_mutex_;
 
   sh3::Cpu cpu_;
   Blitter gpu_;
   Ymz770 spu_;
+  // Frames rendered per audio_tick_, 4 ms.
+  static constexpr uint32_t kAudioBlock = 64;
+  counters::Counter audio_tick_;
+  AudioRing audio_;
+  uint64_t audio_ns_ = 0;
   Nand nand_;
   Rtc9701 rtc9701_;
   GamesList games_list_;
+  state::AsyncSaver saver_;
+  RewindBuffer rewind_;
+  std::vector<uint8_t> rewind_state_;
+  int32_t rewind_frames_ = 0;
+  uint64_t rewind_ns_ = 0;
 
   std::array<uint8_t, kBiosSize> bios_;
   std::array<uint8_t, kRamSize> ram_;
+  std::array<uint8_t, (kRamSize >> sh3::Mmu::kDirtyPageShift)> ram_dirty_;
   uint32_t input_data_;
 
-  template <typename T>
-  T BiosRead(uint32_t addr) {
-    addr &= bios_.size() - 1;
-    return *(T *)&bios_[bios_.size() - addr - sizeof(T)];
-  }
-
-  template <typename T>
-  T RamRead(uint32_t addr) {
-    addr &= ram_.size() - 1;
-    return *(T *)&ram_[ram_.size() - addr - sizeof(T)];
-  }
-
-  template <typename T>
-  void RamWrite(uint32_t addr, T value) {
-    addr &= ram_.size() - 1;
-    *(T *)&ram_[ram_.size() - addr - sizeof(T)] = value;
-  }
-
   void EmuThread();
+  void RenderAudio();
+  std::filesystem::path GetStatePath() const;
+  // Everything but RAM and VRAM, which are saved as memory chunks or
+  // tracked by page for rewinding.
+  void SaveMachine(state::Writer &writer);
+  bool LoadMachine(const std::vector<state::Chunk> &chunks);
+  void ResetRewind();
+  void CaptureRewind();
+  bool StepRewind();
 
   void Init();
   void Execute();
   void Close();
+  void Post(ThreadMessage message);
 };
\ No newline at end of file
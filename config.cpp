@@ -15,6 +15,9 @@ bool Config::Load() {
     state_.path = toml::find<std::string>(game, "path");
 
     for (const auto& [name, config] : configs_) {
+      if (!tbl.contains(name)) {
+        continue;
+      }
       auto node = toml::find(tbl, name);
       if (node.is_table()) {
         config->LoadConfig(node.as_table());
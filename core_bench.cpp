@@ -0,0 +1,166 @@
+// Microbenchmarks for the CPU core's memory access and event scheduler.
+//
+//   core_bench [mmu] [counters] [--iterations n] [--slices n]
+//
+// mmu times a RAM heavy access pattern, a 32 bit load, add and store and a
+// 16 bit load, through a host mapped region (the inline fast path) and
+// through the same memory behind handlers (the MemAccess path). counters
+// runs the scheduler with 4, 64 and 1024 periodic timers that each re-arm
+// a one shot IRQ counter when they fire, and re-programs a random timer
+// every eighth slice, as TMU writes do. Both run when neither is given.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "counters.h"
+#include "sh3_mmu.h"
+
+using Clock = std::chrono::steady_clock;
+
+static double Seconds(Clock::duration d) {
+  return std::chrono::duration<double>(d).count();
+}
+
+static void BenchMmu(uint32_t iterations) {
+  constexpr uint32_t kSize = 0x01000000;
+  constexpr uint32_t kFastBase = 0x0c000000;
+  constexpr uint32_t kSlowBase = 0x08000000;
+
+  // Byte reversed as the Mmu expects, the handlers read the same layout.
+  std::vector<uint8_t> ram(kSize);
+  auto at = [&](uint32_t addr, size_t size) {
+    return &ram[kSize - (addr & (kSize - 1)) - size];
+  };
+
+  sh3::MemHandler handler;
+  handler.read8 = [&](uint32_t addr) -> uint8_t { return *at(addr, 1); };
+  handler.read16 = [&](uint32_t addr) -> uint16_t {
+    uint16_t v;
+    std::memcpy(&v, at(addr, 2), 2);
+    return v;
+  };
+  handler.read32 = [&](uint32_t addr) -> uint32_t {
+    uint32_t v;
+    std::memcpy(&v, at(addr, 4), 4);
+    return v;
+  };
+  handler.write8 = [&](uint32_t addr, uint8_t v) { *at(addr, 1) = v; };
+  handler.write16 = [&](uint32_t addr, uint16_t v) {
+    std::memcpy(at(addr, 2), &v, 2);
+  };
+  handler.write32 = [&](uint32_t addr, uint32_t v) {
+    std::memcpy(at(addr, 4), &v, 4);
+  };
+
+  std::vector<sh3::Map> map;
+  map.push_back(sh3::Map(kFastBase, kSize, ram.data(), true));
+  map.push_back(sh3::Map(kSlowBase, kSize, handler));
+  auto mmu = std::make_unique<sh3::Mmu>();
+  mmu->Init(map);
+
+  struct Run {
+    const char *name;
+    uint32_t base;
+  };
+  // P1, cached and untranslated, where the games run.
+  const Run runs[] = {{"host mapped", kFastBase | 0x80000000},
+                      {"handlers", kSlowBase | 0x80000000}};
+
+  std::cout << "mmu: " << iterations << " iterations, 3 accesses each\n";
+  double times[2];
+  for (size_t r = 0; r < 2; r++) {
+    const auto &run = runs[r];
+    uint32_t sum = 0;
+    auto start = Clock::now();
+    for (uint32_t i = 0; i < iterations; i++) {
+      uint32_t addr = run.base + ((i * 4) & 0xfffc);
+      uint32_t v = mmu->Read32(addr);
+      mmu->Write32(addr, v + i);
+      sum += mmu->Read16(addr + 2);
+    }
+    double seconds = Seconds(Clock::now() - start);
+    times[r] = seconds;
+
+    std::cout << std::fixed << std::setprecision(3) << "  " << run.name
+              << ": " << seconds << " s, " << std::setprecision(2)
+              << seconds * 1e9 / (iterations * 3.0) << " ns per access (sum "
+              << sum << ")\n";
+  }
+  std::cout << "  host mapped is " << times[1] / times[0]
+            << "x faster\n";
+}
+
+static void BenchCounters(uint32_t timers, uint32_t slices) {
+  counters::Counters scheduler;
+  std::mt19937 rng(1);
+  uint64_t fired = 0;
+  uint64_t sum = 0;
+
+  counters::Counter irq(counters::Counter::kOneShot, 1, 1, nullptr);
+  std::vector<std::unique_ptr<counters::Counter>> periodic;
+  for (uint32_t i = 0; i < timers; i++) {
+    periodic.push_back(std::make_unique<counters::Counter>(
+        counters::Counter::kNone, 100 + rng() % 100000, 1,
+        [&](counters::Counter *) {
+          fired++;
+          scheduler.Insert(&irq);
+        }));
+    scheduler.Insert(periodic.back().get());
+  }
+
+  auto start = Clock::now();
+  for (uint32_t i = 0; i < slices; i++) {
+    // The CPU ran up to the next event.
+    scheduler.icount = 0;
+    scheduler.TestCounters();
+    if ((i & 7) == 0) {
+      auto *counter = periodic[rng() % timers].get();
+      scheduler.Insert(counter);
+      sum += scheduler.ReadCounter(counter);
+    }
+  }
+  double seconds = Seconds(Clock::now() - start);
+
+  std::cout << std::fixed << std::setprecision(3) << "  " << std::setw(5)
+            << timers << " timers: " << seconds << " s, "
+            << std::setprecision(1) << seconds * 1e9 / slices
+            << " ns per slice, " << fired << " fired (sum " << sum << ")\n";
+}
+
+int main(int argc, char **argv) {
+  bool mmu = false;
+  bool counters = false;
+  uint32_t iterations = 100000000;
+  uint32_t slices = 2000000;
+
+  for (int i = 1; i < argc; i++) {
+    if (!std::strcmp(argv[i], "mmu")) {
+      mmu = true;
+    } else if (!std::strcmp(argv[i], "counters")) {
+      counters = true;
+    } else if (!std::strcmp(argv[i], "--iterations") && i + 1 < argc) {
+      iterations = static_cast<uint32_t>(std::max(1, std::atoi(argv[++i])));
+    } else if (!std::strcmp(argv[i], "--slices") && i + 1 < argc) {
+      slices = static_cast<uint32_t>(std::max(1, std::atoi(argv[++i])));
+    } else {
+      std::cout << "usage: core_bench [mmu] [counters] [--iterations n] "
+                   "[--slices n]\n";
+      return 1;
+    }
+  }
+  if (!mmu && !counters) mmu = counters = true;
+
+  if (mmu) BenchMmu(iterations);
+  if (counters) {
+    std::cout << "counters: " << slices << " slices\n";
+    for (uint32_t timers : {4, 64, 1024}) BenchCounters(timers, slices);
+  }
+  return 0;
+}
@@ -2,71 +2,69 @@
 
 namespace counters {
 void Counters::Insert(Counter *counter) {
-  Remove(counter);
   cycle = e_cycle - icount;
-  counter->mode |= Counter::kEnable;
   counter->s_cycle = cycle;
   counter->e_cycle = cycle + static_cast<uint64_t>(counter->count) *
                                  static_cast<uint64_t>(counter->rate);
+  counter->order = order++;
 
-  if (head == nullptr) {
-    head = counter;
-    counter->next = nullptr;
-    counter->prev = nullptr;
+  if (counter->index == Counter::kUnqueued) {
+    counter->mode |= Counter::kEnable;
+    heap.push_back(counter);
+    counter->index = heap.size() - 1;
   } else {
-    if (head->e_cycle < counter->e_cycle) {
-      Counter *current_counter = head;
-      Counter *next_counter = head->next;
-
-      while (next_counter != nullptr) {
-        if (next_counter->e_cycle > counter->e_cycle) {
-          break;
-        }
-        current_counter = next_counter;
-        next_counter = next_counter->next;
-      }
-
-      if (current_counter == head) {
-        counter->next = head->next;
-        counter->prev = head;
-        if (head->next != nullptr) head->next->prev = counter;
-        head->next = counter;
-      } else {
-        counter->next = next_counter;
-        if (next_counter != nullptr) next_counter->prev = counter;
-        counter->prev = current_counter;
-        current_counter->next = counter;
-      }
-    } else {
-      counter->next = head;
-      head->prev = counter;
-      head = counter;
-      head->prev = nullptr;
-    }
+    SiftDown(counter->index);
   }
+  SiftUp(counter->index);
   GetNextCounter();
 }
 
 void Counters::Remove(Counter *counter) {
-  if (counter->mode & Counter::kEnable) {
-    if (counter == head) {
-      head = head->next;
-      if (head != nullptr) head->prev = nullptr;
-    } else {
-      if (counter->prev != nullptr) counter->prev->next = counter->next;
-      if (counter->next != nullptr) counter->next->prev = counter->prev;
+  if (counter->index != Counter::kUnqueued) {
+    cycle = e_cycle - icount;
+    Counter *last = heap.back();
+    heap.pop_back();
+    if (last != counter) {
+      size_t index = counter->index;
+      Place(last, index);
+      SiftDown(index);
+      SiftUp(last->index);
     }
-    counter->mode &= ~Counter::kEnable;
-    counter->next = nullptr;
-    counter->prev = nullptr;
+    counter->index = Counter::kUnqueued;
     GetNextCounter();
   }
+  counter->mode &= ~Counter::kEnable;
+}
+
+void Counters::SiftUp(size_t index) {
+  Counter *counter = heap[index];
+  while (index > 0) {
+    size_t parent = (index - 1) / 2;
+    if (!Before(counter, heap[parent])) break;
+    Place(heap[parent], index);
+    index = parent;
+  }
+  Place(counter, index);
+}
+
+void Counters::SiftDown(size_t index) {
+  Counter *counter = heap[index];
+  size_t size = heap.size();
+  while (true) {
+    size_t child = index * 2 + 1;
+    if (child >= size) break;
+    if (child + 1 < size && Before(heap[child + 1], heap[child])) child++;
+    if (!Before(heap[child], counter)) break;
+    Place(heap[child], index);
+    index = child;
+  }
+  Place(counter, index);
 }
 
 void Counters::GetNextCounter() {
-  if (nullptr == head) return;
+  if (heap.empty()) return;
 
-  auto next_counter = head->e_cycle - cycle;
+  auto next_counter = heap.front()->e_cycle - cycle;
   s_cycle = cycle;
   e_cycle = cycle + next_counter;
   icount = static_cast<int32_t>(next_counter);
@@ -84,24 +82,63 @@ uint32_t Counters::ReadCounter(Counter *counter) {
 void Counters::TestCounters() {
   cycle = e_cycle - icount;
 
-  Counter *current_counter = head;
-  while (current_counter != nullptr) {
-    if (current_counter->e_cycle <= cycle) {
-      auto callback = current_counter->callback;
-      if (callback) {
-        callback(current_counter);
-      }
+  while (!heap.empty() && heap.front()->e_cycle <= cycle) {
+    Counter *current_counter = heap.front();
+    auto &callback = current_counter->callback;
+    if (callback) {
+      callback(current_counter);
+    }
+    if (current_counter->mode & Counter::kOneShot) {
       Remove(current_counter);
-      if ((current_counter->mode & Counter::kOneShot) == 0) {
-        Insert(current_counter);
-        current_counter = head;
-        continue;
-      }
     } else {
-      break;
+      Insert(current_counter);
     }
-    current_counter = current_counter->next;
   }
   GetNextCounter();
 }
-}  // namespace counters
\ No newline at end of file
+
+void Counters::SaveState(state::Writer &writer) const {
+  writer.Put(icount);
+  writer.Put(cycle);
+  writer.Put(s_cycle);
+  writer.Put(e_cycle);
+  writer.Put(order);
+}
+
+void Counters::LoadState(state::Reader &reader) {
+  reader.Get(icount);
+  reader.Get(cycle);
+  reader.Get(s_cycle);
+  reader.Get(e_cycle);
+  reader.Get(order);
+  for (Counter *counter : heap) {
+    counter->index = Counter::kUnqueued;
+  }
+  heap.clear();
+}
+
+void Counters::SaveCounter(state::Writer &writer,
+                           const Counter *counter) const {
+  writer.Put(counter->mode);
+  writer.Put(counter->count);
+  writer.Put(counter->rate);
+  writer.Put(counter->e_cycle);
+  writer.Put(counter->s_cycle);
+  writer.Put(counter->order);
+  writer.Put(counter->index != Counter::kUnqueued);
+}
+
+void Counters::LoadCounter(state::Reader &reader, Counter *counter) {
+  reader.Get(counter->mode);
+  reader.Get(counter->count);
+  reader.Get(counter->rate);
+  reader.Get(counter->e_cycle);
+  reader.Get(counter->s_cycle);
+  reader.Get(counter->order);
+  if (reader.Get<bool>()) {
+    heap.push_back(counter);
+    counter->index = heap.size() - 1;
+    SiftUp(counter->index);
+  }
+}
+}  // namespace counters
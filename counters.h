@@ -1,7 +1,11 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <vector>
+
+#include "save_state.h"
 
 namespace counters {
 class Counters;
@@ -20,21 +24,23 @@ class Counter {
         e_cycle(0),
         s_cycle(0),
         callback(handler),
-        next(nullptr),
-        prev(nullptr) {}
+        order(0),
+        index(kUnqueued) {}
 
   void SetCount(uint32_t c) { count = c; }
   void SetRate(uint32_t r) { rate = r; }
 
  private:
+  const static size_t kUnqueued = SIZE_MAX;
+
   uint32_t mode;
   uint32_t count;
   uint32_t rate;
   uint64_t e_cycle;
   uint64_t s_cycle;
   Callback callback;
-  Counter *next;
-  Counter *prev;
+  uint64_t order;
+  size_t index;
 };
 
 class Counters {
@@ -46,14 +52,39 @@ class Counters {
   void TestCounters();
   void GetNextCounter();
   uint32_t ReadCounter(Counter *counter);
+  uint64_t GetCycle() const { return e_cycle - icount; }
+
+  // Scheduler state. Loading empties the queue, every counter is then
+  // loaded by its owner with LoadCounter(), which queues it again if it
+  // was queued when saved.
+  void SaveState(state::Writer &writer) const;
+  void LoadState(state::Reader &reader);
+  void SaveCounter(state::Writer &writer, const Counter *counter) const;
+  void LoadCounter(state::Reader &reader, Counter *counter);
 
-  Counters() : icount(0), cycle(0), s_cycle(0), e_cycle(0), head(nullptr) {}
+  Counters() : icount(0), cycle(0), s_cycle(0), e_cycle(0), order(0) {}
 
  private:
   uint64_t cycle;
   uint64_t s_cycle;
   uint64_t e_cycle;
+  uint64_t order;
+
+  // Min-heap on e_cycle, counters due on the same cycle fire in insertion
+  // order. Each counter keeps its own slot in |index|.
+  std::vector<Counter *> heap;
+
+  bool Before(const Counter *a, const Counter *b) const {
+    return a->e_cycle != b->e_cycle ? a->e_cycle < b->e_cycle
+                                    : a->order < b->order;
+  }
+
+  void Place(Counter *counter, size_t index) {
+    heap[index] = counter;
+    counter->index = index;
+  }
 
-  Counter *head;
+  void SiftUp(size_t index);
+  void SiftDown(size_t index);
 };
-}  // namespace counters
\ No newline at end of file
+}  // namespace counters
@@ -0,0 +1,37 @@
+#include "frame_pacer.h"
+
+#include <algorithm>
+#include <thread>
+
+FramePacer::FramePacer(double rate)
+    : period_(std::chrono::duration_cast<Clock::duration>(
+          std::chrono::duration<double>(1.0 / rate))) {
+  Reset();
+}
+
+void FramePacer::Reset() { deadline_ = Clock::now() + period_; }
+
+void FramePacer::Wait() {
+  auto now = Clock::now();
+  if (now > deadline_ + kMaxLag * period_) {
+    deadline_ = now + period_;
+    return;
+  }
+
+  if (deadline_ - now > margin_) {
+    auto target = deadline_ - margin_;
+    std::this_thread::sleep_until(target);
+    // Rise straight to a late wake up, decay slowly after one.
+    auto late = Clock::now() - target;
+    if (late > margin_) {
+      margin_ = late;
+    } else {
+      margin_ -= (margin_ - late) / 16;
+    }
+    margin_ = std::clamp(margin_, kMinMargin, period_);
+  }
+  while (Clock::now() < deadline_) {
+    std::this_thread::yield();
+  }
+  deadline_ += period_;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <chrono>
+
+// Holds a thread to a fixed frame rate against the host clock. Wait()
+// sleeps until shortly before the deadline and yields for the rest. The
+// margin left for the yield follows how late the OS wakes the thread, so
+// it stays small on a precise timer and grows on a coarse one.
+class FramePacer {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  explicit FramePacer(double rate);
+
+  // The next deadline is one frame from now, nothing is caught up.
+  void Reset();
+  // Waits for the end of the frame just run. After falling more than a few
+  // frames behind, the missed time is dropped instead of run flat out.
+  void Wait();
+
+ private:
+  static constexpr int kMaxLag = 4;
+  static constexpr Clock::duration kMinMargin = std::chrono::microseconds(100);
+
+  Clock::duration period_;
+  Clock::time_point deadline_;
+  Clock::duration margin_ = std::chrono::milliseconds(1);
+};
@@ -0,0 +1,166 @@
+#include "lz.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace lz {
+
+static constexpr size_t kMinMatch = 4;
+// The format ends every block with 5 literals, and no match may start in
+// the last 12 bytes.
+static constexpr size_t kLastLiterals = 5;
+static constexpr size_t kMatchLimit = 12;
+static constexpr size_t kMaxOffset = 65535;
+static constexpr int kHashBits = 14;
+
+static uint32_t Load32(const uint8_t *p) {
+  uint32_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+static uint64_t Load64(const uint8_t *p) {
+  uint64_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+static uint32_t Hash(uint32_t v) {
+  return (v * 2654435761u) >> (32 - kHashBits);
+}
+
+// Lengths past the 4-bit token field continue in bytes of up to 255.
+static uint8_t *PutLength(uint8_t *out, size_t length) {
+  while (length >= 255) {
+    *out++ = 255;
+    length -= 255;
+  }
+  *out++ = static_cast<uint8_t>(length);
+  return out;
+}
+
+static bool GetLength(const uint8_t *&in, const uint8_t *end, size_t &length) {
+  uint8_t byte;
+  do {
+    if (in == end) return false;
+    byte = *in++;
+    length += byte;
+  } while (byte == 255);
+  return true;
+}
+
+static uint8_t *PutLiterals(uint8_t *out, const uint8_t *literals,
+                            size_t count, uint8_t match) {
+  *out++ = static_cast<uint8_t>(std::min<size_t>(count, 15) << 4 | match);
+  if (count >= 15) out = PutLength(out, count - 15);
+  if (count) std::memcpy(out, literals, count);
+  return out + count;
+}
+
+size_t Compress(const uint8_t *src, size_t n, uint8_t *dst) {
+  const uint8_t *end = src + n;
+  const uint8_t *anchor = src;
+  uint8_t *out = dst;
+
+  if (n > kMatchLimit) {
+    // Entries left from an earlier block are only candidates, every match
+    // is checked, so the table is never cleared.
+    static thread_local uint32_t table[1 << kHashBits];
+    const uint8_t *match_limit = end - kMatchLimit;
+    const uint8_t *copy_limit = end - kLastLiterals;
+    const uint8_t *ip = src + 1;
+    uint32_t misses = 0;
+
+    while (ip < match_limit) {
+      uint32_t seq = Load32(ip);
+      uint32_t pos = static_cast<uint32_t>(ip - src);
+      uint32_t candidate = table[Hash(seq)];
+      table[Hash(seq)] = pos;
+      if (candidate >= pos || pos - candidate > kMaxOffset ||
+          Load32(src + candidate) != seq) {
+        // Step faster through data that doesn't compress.
+        ip += 1 + (misses++ >> 6);
+        continue;
+      }
+      misses = 0;
+
+      const uint8_t *ref = src + candidate;
+      while (ip > anchor && ref > src && ip[-1] == ref[-1]) {
+        ip--;
+        ref--;
+      }
+      size_t length = kMinMatch;
+      while (ip + length + 8 <= copy_limit) {
+        uint64_t diff = Load64(ip + length) ^ Load64(ref + length);
+        if (diff) {
+          length += std::countr_zero(diff) / 8;
+          goto found;
+        }
+        length += 8;
+      }
+      while (ip + length < copy_limit && ip[length] == ref[length]) {
+        length++;
+      }
+    found:
+      size_t match = length - kMinMatch;
+      out = PutLiterals(out, anchor, ip - anchor,
+                        static_cast<uint8_t>(std::min<size_t>(match, 15)));
+      size_t offset = ip - ref;
+      *out++ = static_cast<uint8_t>(offset);
+      *out++ = static_cast<uint8_t>(offset >> 8);
+      if (match >= 15) out = PutLength(out, match - 15);
+
+      ip += length;
+      anchor = ip;
+    }
+  }
+
+  out = PutLiterals(out, anchor, end - anchor, 0);
+  return out - dst;
+}
+
+bool Decompress(const uint8_t *src, size_t n, uint8_t *dst, size_t size) {
+  const uint8_t *in = src;
+  const uint8_t *in_end = src + n;
+  uint8_t *out = dst;
+  uint8_t *out_end = dst + size;
+
+  while (in < in_end) {
+    uint8_t token = *in++;
+    size_t literals = token >> 4;
+    if (literals == 15 && !GetLength(in, in_end, literals)) return false;
+    if (literals > static_cast<size_t>(in_end - in) ||
+        literals > static_cast<size_t>(out_end - out)) {
+      return false;
+    }
+    if (literals) std::memcpy(out, in, literals);
+    in += literals;
+    out += literals;
+    // The last sequence has no match.
+    if (in == in_end) break;
+
+    if (in_end - in < 2) return false;
+    size_t offset = in[0] | in[1] << 8;
+    in += 2;
+    size_t length = token & 15;
+    if (length == 15 && !GetLength(in, in_end, length)) return false;
+    length += kMinMatch;
+    if (offset == 0 || offset > static_cast<size_t>(out - dst) ||
+        length > static_cast<size_t>(out_end - out)) {
+      return false;
+    }
+
+    const uint8_t *ref = out - offset;
+    if (offset >= length) {
+      std::memcpy(out, ref, length);
+    } else {
+      // Overlapping, repeats the last offset bytes.
+      for (size_t i = 0; i < length; i++) out[i] = ref[i];
+    }
+    out += length;
+  }
+  return out == out_end;
+}
+
+}  // namespace lz
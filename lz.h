@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// LZ4 block format compression, without the frame format around it. Fast
+// rather than small, used for save states.
+namespace lz {
+
+// Worst case compressed size of n bytes.
+constexpr size_t GetBound(size_t n) { return n + n / 255 + 16; }
+
+// Compresses n bytes from src into dst, which holds GetBound(n) bytes.
+// Returns the compressed size. Offsets are 16 bits, so blocks larger than
+// 64 KiB only find matches within the last 64 KiB.
+size_t Compress(const uint8_t *src, size_t n, uint8_t *dst);
+// Decompresses exactly size bytes into dst, false if src is malformed.
+bool Decompress(const uint8_t *src, size_t n, uint8_t *dst, size_t size);
+
+}  // namespace lz
@@ -11,9 +11,39 @@ void Nand::Init(GamesList *l) {
   nand_ack_delay = 1;
   nand_column = 0;
   nand_row = 0;
+  nand_page = nullptr;
   gameList = l;
 }
 
+void Nand::SaveState(state::Writer &writer) const {
+  writer.Begin(state::Tag("NAND"), 1);
+  writer.Put(nand_ack);
+  writer.Put(nand_ack_delay);
+  writer.Put(nand_state);
+  writer.Put(nand_substate);
+  writer.Put(nand_count);
+  writer.Put(nand_column);
+  writer.Put(nand_row);
+  writer.Put(nand_page != nullptr);
+  auto blocks = gameList->GetNandBuffer();
+  writer.Put(blocks.data(), blocks.size());
+}
+
+void Nand::LoadState(state::Reader &reader) {
+  reader.Get(nand_ack);
+  reader.Get(nand_ack_delay);
+  reader.Get(nand_state);
+  reader.Get(nand_substate);
+  reader.Get(nand_count);
+  reader.Get(nand_column);
+  reader.Get(nand_row);
+  nand_page = reader.Get<bool>()
+                  ? gameList->GetGameRomPtr(nand_row * 0x840, 0x1000)
+                  : nullptr;
+  auto blocks = gameList->GetNandBuffer();
+  reader.Get(blocks.data(), blocks.size());
+}
+
 int Nand::Read() {
   switch (nand_state) {
     case kCmdIdSend:
@@ -28,7 +58,10 @@ int Nand::Read() {
       }
       break;
     case kCmdReadData: {
-      int ret = gameList->GetGameRomValue((nand_row * 0x840) + nand_column);
+      int ret = nand_page && nand_column < 0x1000
+                    ? nand_page[nand_column]
+                    : gameList->GetGameRomValue((nand_row * 0x840) +
+                                                nand_column);
       nand_column++;
       if (nand_column == 0x840) nand_state = kCmdReady;
       return ret;
@@ -121,6 +154,8 @@ void Nand::Write(int byte) {
         case kCmdReadCycle1:
           switch (byte) {
             case 0x30:
+              // Columns are 12 bits, map enough for any start column.
+              nand_page = gameList->GetGameRomPtr(nand_row * 0x840, 0x1000);
               nand_state = kCmdReadData;
               nand_substate = kCmdNone;
               nand_count = 0;
@@ -2,6 +2,8 @@
 
 #include <cstdint>
 
+#include "save_state.h"
+
 class GamesList;
 
 class Nand {
@@ -11,6 +13,9 @@ class Nand {
   void Write(int byte);
   int Ack();
 
+  void SaveState(state::Writer &writer) const;
+  void LoadState(state::Reader &reader);
+
  private:
   GamesList *gameList;
   enum {
@@ -41,4 +46,6 @@ class Nand {
   uint8_t nand_count;
   uint16_t nand_column;
   uint16_t nand_row;
+  // Mapped rom at the page being read, nullptr falls back to byte reads.
+  const uint8_t *nand_page;
 };
\ No newline at end of file
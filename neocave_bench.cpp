@@ -0,0 +1,197 @@
+// Runs a romset as fast as possible with no window or audio device and
+// reports emulation speed. The CPU core and audio run on the calling thread,
+// the blitter on its own thread as in the app.
+//
+//   neocave_bench <romset> <rom dir> [--frames n] [--jit] [--threads n]
+//                 [--input script] [--pcm-cache mib]
+//                 [--load-state file] [--save-state file] [--rewind mib]
+//
+// The rom dir is the romset directory itself or the directory holding it.
+// An input script holds "<frame> <input>" lines, the input is a hex word in
+// the active low layout of Cave3rd::SetInputState and is held from that
+// frame on. Lines starting with # are ignored. A loaded state replaces the
+// boot, a saved one is taken after the last frame and timed. Rewind
+// snapshots are off unless given a budget.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cave.h"
+
+using Clock = std::chrono::steady_clock;
+
+static double Seconds(Clock::duration d) {
+  return std::chrono::duration<double>(d).count();
+}
+
+static bool LoadScript(const std::string &path,
+                       std::vector<std::pair<uint32_t, uint32_t>> &script) {
+  std::ifstream file(path);
+  if (!file.is_open()) return false;
+
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    std::istringstream in(line);
+    uint32_t frame, input;
+    if (!(in >> frame >> std::hex >> input)) return false;
+    script.push_back({frame, input});
+  }
+  std::stable_sort(
+      script.begin(), script.end(),
+      [](const auto &a, const auto &b) { return a.first < b.first; });
+  return true;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    std::cout << "usage: neocave_bench <romset> <rom dir> [--frames n] [--jit] "
+                 "[--threads n] [--input script] [--pcm-cache mib] "
+                 "[--load-state file] [--save-state file] [--rewind mib]\n";
+    return 1;
+  }
+
+  std::string name = argv[1];
+  std::filesystem::path path = argv[2];
+  uint32_t frames = 3600;
+  bool jit = false;
+  int32_t threads = 0;
+  std::string script_path;
+  int32_t pcm_cache = 16;
+  std::string load_state;
+  std::string save_state;
+  int32_t rewind = 0;
+
+  for (int i = 3; i < argc; i++) {
+    if (!std::strcmp(argv[i], "--frames") && i + 1 < argc) {
+      frames = static_cast<uint32_t>(std::max(1, std::atoi(argv[++i])));
+    } else if (!std::strcmp(argv[i], "--jit")) {
+      jit = true;
+    } else if (!std::strcmp(argv[i], "--threads") && i + 1 < argc) {
+      threads = std::atoi(argv[++i]);
+    } else if (!std::strcmp(argv[i], "--input") && i + 1 < argc) {
+      script_path = argv[++i];
+    } else if (!std::strcmp(argv[i], "--pcm-cache") && i + 1 < argc) {
+      pcm_cache = std::atoi(argv[++i]);
+    } else if (!std::strcmp(argv[i], "--load-state") && i + 1 < argc) {
+      load_state = argv[++i];
+    } else if (!std::strcmp(argv[i], "--save-state") && i + 1 < argc) {
+      save_state = argv[++i];
+    } else if (!std::strcmp(argv[i], "--rewind") && i + 1 < argc) {
+      rewind = std::atoi(argv[++i]);
+    }
+  }
+
+  std::vector<std::pair<uint32_t, uint32_t>> script;
+  if (!script_path.empty() && !LoadScript(script_path, script)) {
+    std::cout << "can't read input script " << script_path << "\n";
+    return 1;
+  }
+
+  auto cave3rd = std::make_unique<Cave3rd>(false);
+  auto &games = cave3rd->GetGameList();
+  uint32_t idx = games.IndexOfName(name.c_str());
+  if (idx == static_cast<uint32_t>(-1)) {
+    std::cout << "unknown romset " << name << "\n";
+    return 1;
+  }
+  if (std::filesystem::is_directory(path / name)) path /= name;
+  if (!games.LoadGame(idx, path.string(), false)) {
+    std::cout << "romset " << name << " not found in " << path.string()
+              << "\n";
+    return 1;
+  }
+
+  cave3rd->SetGame(idx, path.string());
+  cave3rd->SetJit(jit);
+  cave3rd->SetBlitterThreads(threads);
+  cave3rd->SetPcmCacheSize(pcm_cache);
+  cave3rd->SetRewindSize(rewind);
+  cave3rd->Boot();
+  if (!load_state.empty() && !cave3rd->LoadState(load_state)) {
+    return 1;
+  }
+
+  std::vector<double> times;
+  times.reserve(frames);
+  uint64_t start_cycle = cave3rd->GetCycle();
+  uint64_t start_idle = cave3rd->GetIdleCycles();
+  uint64_t start_blitter = cave3rd->GetBlitterNs();
+  uint64_t start_audio = cave3rd->GetAudioNs();
+  uint64_t start_rewind = cave3rd->GetRewindNs();
+  // Audio is rendered during RunFrame(), drained here as a device would.
+  std::vector<int16_t> audio(2 * AudioRing::kFrames);
+  size_t next_input = 0;
+
+  auto start = Clock::now();
+  for (uint32_t frame = 0; frame < frames; frame++) {
+    while (next_input < script.size() && script[next_input].first <= frame) {
+      cave3rd->SetInputState(script[next_input++].second);
+    }
+
+    auto frame_start = Clock::now();
+    cave3rd->RunFrame();
+    cave3rd->ReadAudio(audio.data(), AudioRing::kFrames);
+    auto frame_end = Clock::now();
+
+    times.push_back(
+        std::chrono::duration<double, std::milli>(frame_end - frame_start)
+            .count());
+  }
+  double total = Seconds(Clock::now() - start);
+
+  uint64_t cycles = cave3rd->GetCycle() - start_cycle;
+  uint64_t idle = cave3rd->GetIdleCycles() - start_idle;
+  double blitter = (cave3rd->GetBlitterNs() - start_blitter) / 1e9;
+  double audio_time = (cave3rd->GetAudioNs() - start_audio) / 1e9;
+  double rewind_time = (cave3rd->GetRewindNs() - start_rewind) / 1e9;
+  double emulated = frames / 60.0178;
+
+  std::vector<double> sorted = times;
+  std::sort(sorted.begin(), sorted.end());
+
+  std::cout << std::fixed << std::setprecision(3);
+  std::cout << name << ": " << frames << " frames, "
+            << (jit ? "jit" : "interpreter") << "\n";
+  std::cout << "time: " << total << " s, " << frames / total << " fps, "
+            << emulated / total << "x realtime\n";
+  std::cout << "cpu: " << cycles / 1e6 << " M cycles, " << idle / 1e6
+            << " M idle, " << (cycles - idle) / total / 1e6 << " MIPS\n";
+  std::cout << "split: cpu " << total - audio_time - rewind_time
+            << " s, audio " << audio_time << " s, blitter " << blitter
+            << " s (own thread)\n";
+  std::cout << "frame ms: avg " << total * 1000 / frames << ", min "
+            << sorted.front() << ", p50 " << sorted[sorted.size() / 2]
+            << ", p99 " << sorted[sorted.size() * 99 / 100] << ", max "
+            << sorted.back() << "\n";
+
+  if (rewind > 0) {
+    const auto &buffer = cave3rd->GetRewind();
+    std::cout << "rewind: " << buffer.GetCount() << " snapshots, "
+              << buffer.GetSize() / 1048576.0 << " MiB, capture "
+              << rewind_time << " s\n";
+  }
+
+  if (!save_state.empty()) {
+    auto save_start = Clock::now();
+    cave3rd->SaveState(save_state);
+    auto snapshot_end = Clock::now();
+    if (!cave3rd->WaitSaveState()) return 1;
+    std::cout << "save state: snapshot "
+              << Seconds(snapshot_end - save_start) * 1000 << " ms, write "
+              << Seconds(Clock::now() - snapshot_end) * 1000 << " ms\n";
+  }
+
+  return 0;
+}
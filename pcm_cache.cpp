@@ -0,0 +1,57 @@
+#include "pcm_cache.h"
+
+void PcmCache::Reset(size_t budget) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &entry : entries_) {
+    entry = Entry{};
+  }
+  size_ = 0;
+  budget_ = budget;
+  generation_++;
+}
+
+std::shared_ptr<const PcmCache::Samples> PcmCache::Find(uint8_t msn) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Entry &entry = entries_[msn];
+  if (entry.samples) {
+    entry.used = ++clock_;
+  }
+  return entry.samples;
+}
+
+bool PcmCache::Contains(uint8_t msn) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_[msn].samples != nullptr;
+}
+
+void PcmCache::Insert(uint8_t msn, std::shared_ptr<const Samples> samples,
+                      uint32_t generation, bool warm) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t bytes = GetBytes(*samples);
+  if (generation != generation_ || bytes > budget_ / 4) {
+    return;
+  }
+
+  Entry &entry = entries_[msn];
+  if (entry.samples) {
+    size_ -= GetBytes(*entry.samples);
+    entry.samples.reset();
+  }
+  while (warm && size_ + bytes > budget_) {
+    Entry *oldest = nullptr;
+    for (auto &other : entries_) {
+      if (other.samples && (!oldest || other.used < oldest->used)) {
+        oldest = &other;
+      }
+    }
+    size_ -= GetBytes(*oldest->samples);
+    oldest->samples.reset();
+  }
+  if (size_ + bytes > budget_) {
+    return;
+  }
+
+  entry.samples = std::move(samples);
+  entry.used = warm ? ++clock_ : 0;
+  size_ += bytes;
+}
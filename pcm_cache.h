@@ -0,0 +1,52 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Fully decoded YMZ770 samples keyed by msn, so a sound that is triggered
+// again is copied instead of decoded. Bounded by a byte budget, the least
+// recently used samples are dropped first. Safe to share between the audio
+// thread and a pre-decode thread. Channels hold their samples by pointer,
+// so an entry can be dropped while it plays.
+class PcmCache {
+ public:
+  using Samples = std::vector<int16_t>;
+
+  // Drops every entry, samples recorded before the call are not inserted.
+  // A budget of 0 disables the cache.
+  void Reset(size_t budget);
+  bool IsEnabled() const { return budget_ != 0; }
+  // Longest sample worth recording, so one long track can't flush the rest.
+  size_t GetMaxSamples() const { return budget_ / 4 / sizeof(int16_t); }
+  uint32_t GetGeneration() const { return generation_; }
+
+  std::shared_ptr<const Samples> Find(uint8_t msn);
+  bool Contains(uint8_t msn);
+  // Ignored if the cache was reset since generation. A warm insert evicts
+  // old entries to make room, a cold one (pre-decoding) only fills free
+  // space and ranks below everything played.
+  void Insert(uint8_t msn, std::shared_ptr<const Samples> samples,
+              uint32_t generation, bool warm = true);
+
+ private:
+  struct Entry {
+    std::shared_ptr<const Samples> samples;
+    uint64_t used = 0;
+  };
+
+  static size_t GetBytes(const Samples &samples) {
+    return samples.size() * sizeof(int16_t);
+  }
+
+  std::mutex mutex_;
+  std::array<Entry, 256> entries_;
+  std::atomic<size_t> budget_ = 0;
+  std::atomic<uint32_t> generation_ = 0;
+  size_t size_ = 0;
+  uint64_t clock_ = 0;
+};
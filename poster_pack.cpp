@@ -0,0 +1,145 @@
+// Packs the game posters into the atlas blob loaded by ui::PosterAtlas.
+// Every image is scaled to one tile and converted to RGB565, so the UI
+// uploads the whole file as a texture without decoding anything.
+//
+// Usage: poster_pack <out> <image>=<driver>[,<driver>...] ...
+//
+// Layout, all fields native 32-bit:
+//   magic "NCPA", version, tile size, columns, rows, name count
+//   columns * rows tiles of RGB565 pixels, row major, top row first
+//   per name: slot, length, characters
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+
+static constexpr uint32_t kMagic = 0x4150434e;  // "NCPA"
+static constexpr uint32_t kVersion = 1;
+static constexpr int kTileSize = 192;
+
+template <typename T>
+static void Put(std::ofstream &file, const T &value) {
+  file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+// Box filters an RGB image to size x size, each destination pixel averages
+// the source pixels it covers, at least one.
+static void Scale(const uint8_t *src, int width, int height, uint8_t *dst,
+                  int size) {
+  for (int y = 0; y < size; y++) {
+    int y0 = y * height / size;
+    int y1 = std::max(y0 + 1, (y + 1) * height / size);
+    for (int x = 0; x < size; x++) {
+      int x0 = x * width / size;
+      int x1 = std::max(x0 + 1, (x + 1) * width / size);
+      uint32_t sum[3] = {0, 0, 0};
+      for (int sy = y0; sy < y1; sy++) {
+        const uint8_t *p = src + (sy * width + x0) * 3;
+        for (int sx = x0; sx < x1; sx++, p += 3) {
+          sum[0] += p[0];
+          sum[1] += p[1];
+          sum[2] += p[2];
+        }
+      }
+      uint32_t count = (y1 - y0) * (x1 - x0);
+      uint8_t *out = dst + (y * size + x) * 3;
+      out[0] = static_cast<uint8_t>(sum[0] / count);
+      out[1] = static_cast<uint8_t>(sum[1] / count);
+      out[2] = static_cast<uint8_t>(sum[2] / count);
+    }
+  }
+}
+
+// Rounds to nearest, matching GL_UNSIGNED_SHORT_5_6_5.
+static uint16_t ToRgb565(const uint8_t *p) {
+  uint32_t r = (p[0] * 31 + 127) / 255;
+  uint32_t g = (p[1] * 63 + 127) / 255;
+  uint32_t b = (p[2] * 31 + 127) / 255;
+  return static_cast<uint16_t>(r << 11 | g << 5 | b);
+}
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    std::cout << "Usage: " << argv[0]
+              << " <out> <image>=<driver>[,<driver>...] ..." << std::endl;
+    return 1;
+  }
+
+  std::vector<std::string> images;
+  std::vector<std::pair<std::string, uint32_t>> names;
+  for (int i = 2; i < argc; i++) {
+    std::string arg = argv[i];
+    size_t eq = arg.find('=');
+    if (eq == std::string::npos) {
+      std::cout << "Missing driver names: " << arg << std::endl;
+      return 1;
+    }
+    std::istringstream drivers(arg.substr(eq + 1));
+    std::string driver;
+    while (std::getline(drivers, driver, ',')) {
+      names.emplace_back(driver, static_cast<uint32_t>(images.size()));
+    }
+    images.push_back(arg.substr(0, eq));
+  }
+
+  int columns = static_cast<int>(std::ceil(std::sqrt(images.size())));
+  int rows = static_cast<int>((images.size() + columns - 1) / columns);
+  int width = columns * kTileSize;
+  std::vector<uint16_t> atlas(static_cast<size_t>(width) * rows * kTileSize);
+
+  std::vector<uint8_t> tile(kTileSize * kTileSize * 3);
+  for (size_t i = 0; i < images.size(); i++) {
+    int image_width, image_height, channels;
+    unsigned char *data = stbi_load(images[i].c_str(), &image_width,
+                                    &image_height, &channels, 3);
+    if (!data) {
+      std::cout << "Failed to load " << images[i] << ": "
+                << stbi_failure_reason() << std::endl;
+      return 1;
+    }
+    Scale(data, image_width, image_height, tile.data(), kTileSize);
+    stbi_image_free(data);
+
+    uint16_t *out = atlas.data() + (i / columns) * kTileSize * width +
+                    (i % columns) * kTileSize;
+    for (int y = 0; y < kTileSize; y++, out += width) {
+      for (int x = 0; x < kTileSize; x++) {
+        out[x] = ToRgb565(&tile[(y * kTileSize + x) * 3]);
+      }
+    }
+  }
+
+  std::ofstream file(argv[1], std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) {
+    std::cout << "Failed to open " << argv[1] << std::endl;
+    return 1;
+  }
+  Put(file, kMagic);
+  Put(file, kVersion);
+  Put(file, static_cast<uint32_t>(kTileSize));
+  Put(file, static_cast<uint32_t>(columns));
+  Put(file, static_cast<uint32_t>(rows));
+  Put(file, static_cast<uint32_t>(names.size()));
+  file.write(reinterpret_cast<const char *>(atlas.data()),
+             atlas.size() * sizeof(uint16_t));
+  for (const auto &[name, slot] : names) {
+    Put(file, slot);
+    Put(file, static_cast<uint32_t>(name.size()));
+    file.write(name.data(), name.size());
+  }
+  file.close();
+
+  if (file.fail()) {
+    std::cout << "Failed to write " << argv[1] << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,206 @@
+#include "rewind.h"
+
+#include <algorithm>
+#include <cstring>
+
+// A delta is a run of tokens over 64-bit words: the number of unchanged
+// words to skip and the number of changed ones, LEB128 coded, then the
+// changed words XORed with the other side. A delta record holds the state
+// and then each region's changed pages:
+//   state: kind u8, size u32, bytes (a delta or, kStateRaw, the old state)
+//   per region: page count u32, per page index u32, size u32, delta
+enum StateKind : uint8_t { kStateDelta, kStateRaw };
+
+static uint64_t Load64(const uint8_t *p) {
+  uint64_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+template <typename T>
+static void Put(std::vector<uint8_t> &out, T value) {
+  auto bytes = reinterpret_cast<const uint8_t *>(&value);
+  out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+static T Get(const uint8_t *&in) {
+  T value;
+  std::memcpy(&value, in, sizeof(T));
+  in += sizeof(T);
+  return value;
+}
+
+static void PutVarint(std::vector<uint8_t> &out, size_t value) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+static size_t GetVarint(const uint8_t *&in) {
+  size_t value = 0;
+  for (int shift = 0;; shift += 7) {
+    uint8_t byte = *in++;
+    value |= static_cast<size_t>(byte & 0x7f) << shift;
+    if (!(byte & 0x80)) return value;
+  }
+}
+
+// Appends the delta between two buffers of size bytes, a multiple of 8.
+// Nothing is appended if they are equal.
+static void Encode(const uint8_t *old, const uint8_t *cur, size_t size,
+                   std::vector<uint8_t> &out) {
+  size_t words = size / sizeof(uint64_t);
+  size_t i = 0;
+  while (true) {
+    size_t skip = i;
+    while (i < words && Load64(old + i * 8) == Load64(cur + i * 8)) i++;
+    if (i == words) break;
+    size_t start = i;
+    while (i < words && Load64(old + i * 8) != Load64(cur + i * 8)) i++;
+
+    PutVarint(out, start - skip);
+    PutVarint(out, i - start);
+    size_t pos = out.size();
+    out.resize(pos + (i - start) * 8);
+    for (size_t j = start; j < i; j++, pos += 8) {
+      uint64_t x = Load64(old + j * 8) ^ Load64(cur + j * 8);
+      std::memcpy(&out[pos], &x, sizeof(x));
+    }
+  }
+}
+
+// XORs a delta of n bytes into dst.
+static void Apply(const uint8_t *in, size_t n, uint8_t *dst) {
+  const uint8_t *end = in + n;
+  uint8_t *out = dst;
+  while (in < end) {
+    out += GetVarint(in) * 8;
+    for (size_t count = GetVarint(in); count; count--, in += 8, out += 8) {
+      uint64_t x = Load64(out) ^ Load64(in);
+      std::memcpy(out, &x, sizeof(x));
+    }
+  }
+}
+
+static void Pad(std::span<const uint8_t> state, std::vector<uint8_t> &out) {
+  out.assign(state.begin(), state.end());
+  out.resize((out.size() + 7) & ~size_t{7});
+}
+
+void RewindBuffer::Reset(size_t budget, std::vector<Region> regions,
+                         std::span<const uint8_t> state) {
+  budget_ = budget;
+  size_ = 0;
+  deltas_.clear();
+  tracked_.clear();
+  state_.clear();
+  if (!budget_) return;
+
+  for (auto &region : regions) {
+    std::fill(region.dirty.begin(), region.dirty.end(), 0);
+    tracked_.push_back({region, region.memory.size() / region.dirty.size(),
+                        std::vector<uint8_t>(region.memory.begin(),
+                                             region.memory.end())});
+  }
+  Pad(state, state_);
+}
+
+void RewindBuffer::Capture(std::span<const uint8_t> state) {
+  std::vector<uint8_t> delta;
+  std::vector<uint8_t> next;
+  Pad(state, next);
+  bool same_size = next.size() == state_.size();
+  Put(delta, same_size ? kStateDelta : kStateRaw);
+  Put(delta, uint32_t{0});
+  if (same_size) {
+    Encode(next.data(), state_.data(), state_.size(), delta);
+  } else {
+    delta.insert(delta.end(), state_.begin(), state_.end());
+  }
+  uint32_t size = static_cast<uint32_t>(delta.size() - 5);
+  std::memcpy(&delta[1], &size, sizeof(size));
+  state_ = std::move(next);
+
+  for (auto &tracked : tracked_) {
+    auto &region = tracked.region;
+    size_t count_pos = delta.size();
+    uint32_t count = 0;
+    Put(delta, count);
+    for (size_t page = 0; page < region.dirty.size(); page++) {
+      if (!region.dirty[page]) continue;
+      region.dirty[page] = 0;
+
+      size_t offset = page * tracked.page_size;
+      uint8_t *cur = region.memory.data() + offset;
+      uint8_t *ref = tracked.reference.data() + offset;
+      size_t header = delta.size();
+      Put(delta, static_cast<uint32_t>(page));
+      Put(delta, uint32_t{0});
+      Encode(ref, cur, tracked.page_size, delta);
+      if (delta.size() == header + 8) {
+        // Written back unchanged.
+        delta.resize(header);
+        continue;
+      }
+      size = static_cast<uint32_t>(delta.size() - header - 8);
+      std::memcpy(&delta[header + 4], &size, sizeof(size));
+      std::memcpy(ref, cur, tracked.page_size);
+      count++;
+    }
+    std::memcpy(&delta[count_pos], &count, sizeof(count));
+  }
+
+  delta.shrink_to_fit();
+  size_ += delta.size();
+  deltas_.push_back(std::move(delta));
+  while (size_ > budget_ && !deltas_.empty()) {
+    size_ -= deltas_.front().size();
+    deltas_.pop_front();
+  }
+}
+
+bool RewindBuffer::Drop() {
+  if (deltas_.empty()) return false;
+
+  const auto &delta = deltas_.back();
+  const uint8_t *in = delta.data();
+  auto kind = Get<StateKind>(in);
+  auto size = Get<uint32_t>(in);
+  if (kind == kStateDelta) {
+    Apply(in, size, state_.data());
+  } else {
+    state_.assign(in, in + size);
+  }
+  in += size;
+
+  for (auto &tracked : tracked_) {
+    for (auto count = Get<uint32_t>(in); count; count--) {
+      auto page = Get<uint32_t>(in);
+      size = Get<uint32_t>(in);
+      Apply(in, size, tracked.reference.data() + page * tracked.page_size);
+      in += size;
+      tracked.region.dirty[page] = 1;
+    }
+  }
+
+  size_ -= delta.size();
+  deltas_.pop_back();
+  return true;
+}
+
+const std::vector<uint8_t> &RewindBuffer::Restore() {
+  for (auto &tracked : tracked_) {
+    auto &region = tracked.region;
+    for (size_t page = 0; page < region.dirty.size(); page++) {
+      if (!region.dirty[page]) continue;
+      region.dirty[page] = 0;
+      size_t offset = page * tracked.page_size;
+      std::memcpy(region.memory.data() + offset,
+                  tracked.reference.data() + offset, tracked.page_size);
+    }
+  }
+  return state_;
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <span>
+#include <vector>
+
+// Recent snapshots of the machine for stepping back in time. The last
+// snapshot is kept whole as a reference, every older one only as its
+// difference to the next: the pages that changed, XORed with the newer
+// page and run length coded, and likewise the rest of the machine state.
+// The differences are bounded by a byte budget, the oldest go first; the
+// reference adds the size of the tracked memory on top.
+//
+// Memory is tracked in pages, each with a flag its writer sets on a write.
+// Only flagged pages are compared, so a snapshot costs in proportion to
+// what the game touched.
+class RewindBuffer {
+ public:
+  struct Region {
+    std::span<uint8_t> memory;
+    // One byte per page, the page size is memory.size() / dirty.size().
+    std::span<uint8_t> dirty;
+  };
+
+  // Drops every snapshot and takes the current memory and state as the
+  // reference. A budget of 0 disables the buffer.
+  void Reset(size_t budget, std::vector<Region> regions,
+             std::span<const uint8_t> state);
+  bool IsEnabled() const { return budget_ != 0; }
+
+  // Records the changes since the last snapshot and clears the flags.
+  void Capture(std::span<const uint8_t> state);
+  // Makes the snapshot before the last one the last, false if there is
+  // none. Memory is only written by Restore().
+  bool Drop();
+  // Puts flagged pages back to the last snapshot and returns its state.
+  const std::vector<uint8_t> &Restore();
+
+  size_t GetCount() const { return deltas_.size(); }
+  size_t GetSize() const { return size_; }
+
+ private:
+  struct Tracked {
+    Region region;
+    size_t page_size;
+    std::vector<uint8_t> reference;
+  };
+
+  size_t budget_ = 0;
+  size_t size_ = 0;
+  std::vector<Tracked> tracked_;
+  // Padded to whole words for the delta coder.
+  std::vector<uint8_t> state_;
+  std::deque<std::vector<uint8_t>> deltas_;
+};
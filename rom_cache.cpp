@@ -0,0 +1,94 @@
+#include "rom_cache.h"
+
+#include <cstring>
+#include <fstream>
+#include <system_error>
+
+#include "mapped_file.h"
+
+static constexpr uint32_t kMagic = 0x4952434e;  // "NCRI"
+static constexpr uint32_t kVersion = 1;
+
+template <typename T>
+static void Put(std::ofstream &file, const T &value) {
+  file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+// Reads a T at pos, false if the file is too short.
+template <typename T>
+static bool Get(const MappedFile &file, size_t &pos, T &value) {
+  if (file.GetSize() - pos < sizeof(T)) return false;
+  std::memcpy(&value, file.GetData() + pos, sizeof(T));
+  pos += sizeof(T);
+  return true;
+}
+
+bool RomCache::Load(const std::string &game, const std::string &key,
+                    std::span<const std::span<uint8_t>> images) {
+  MappedFile file;
+  if (!file.Open(GetPath(game))) return false;
+
+  size_t pos = 0;
+  uint32_t magic, version, key_size, count;
+  if (!Get(file, pos, magic) || !Get(file, pos, version) ||
+      !Get(file, pos, key_size)) {
+    return false;
+  }
+  if (magic != kMagic || version != kVersion) return false;
+  if (file.GetSize() - pos < key_size ||
+      key.compare(0, std::string::npos,
+                  reinterpret_cast<const char *>(file.GetData() + pos),
+                  key_size) != 0) {
+    return false;
+  }
+  pos += key_size;
+
+  if (!Get(file, pos, count) || count != images.size()) return false;
+
+  // Check every image before touching any of them.
+  size_t data = pos;
+  for (const auto &image : images) {
+    uint32_t size;
+    if (!Get(file, data, size) || size != image.size()) return false;
+    if (file.GetSize() - data < size) return false;
+    data += size;
+  }
+
+  for (const auto &image : images) {
+    pos += sizeof(uint32_t);
+    std::memcpy(image.data(), file.GetData() + pos, image.size());
+    pos += image.size();
+  }
+  return true;
+}
+
+void RomCache::Save(const std::string &game, const std::string &key,
+                    std::span<const std::span<uint8_t>> images) {
+  std::error_code ec;
+  std::filesystem::create_directories(dir_, ec);
+
+  // Written aside and renamed so a crash never leaves a partial image.
+  auto path = GetPath(game);
+  auto tmp_path = path;
+  tmp_path += ".tmp";
+
+  std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) return;
+
+  Put(file, kMagic);
+  Put(file, kVersion);
+  Put(file, static_cast<uint32_t>(key.size()));
+  file.write(key.data(), key.size());
+  Put(file, static_cast<uint32_t>(images.size()));
+  for (const auto &image : images) {
+    Put(file, static_cast<uint32_t>(image.size()));
+    file.write(reinterpret_cast<const char *>(image.data()), image.size());
+  }
+  file.close();
+
+  if (file.fail()) {
+    std::filesystem::remove(tmp_path, ec);
+    return;
+  }
+  std::filesystem::rename(tmp_path, path, ec);
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+
+// Rom images as Cave3rd lays them out (reversed BIOS, sound rom), saved to
+// <dir>/<game>.img after a game is first loaded. Later launches copy them
+// from the mapped cache instead of reading and swapping the rom files. A
+// cache file is only used while its key matches GamesList::GetRomKey(), so
+// replacing or touching any rom file falls back to a fresh load.
+class RomCache {
+ public:
+  explicit RomCache(std::filesystem::path dir) : dir_(std::move(dir)) {}
+
+  bool Load(const std::string &game, const std::string &key,
+            std::span<const std::span<uint8_t>> images);
+  void Save(const std::string &game, const std::string &key,
+            std::span<const std::span<uint8_t>> images);
+
+ private:
+  std::filesystem::path dir_;
+
+  std::filesystem::path GetPath(const std::string &game) const {
+    return dir_ / (game + ".img");
+  }
+};
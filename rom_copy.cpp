@@ -0,0 +1,124 @@
+#include "rom_copy.h"
+
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include <cstring>
+
+#if defined(__GNUC__)
+#define ROM_COPY_TARGET(isa) __attribute__((target(isa)))
+#else
+#define ROM_COPY_TARGET(isa)
+#endif
+
+namespace rom_copy {
+
+using CopyFn = void (*)(uint8_t *out, const uint8_t *in, size_t size,
+                        bool swap, bool reverse);
+
+// pshufb controls for a 16 byte block, indexed by swap | reverse << 1.
+alignas(16) static const uint8_t kShuffles[4][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14},
+    {15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0},
+    {14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1},
+};
+
+static void CopyScalar(uint8_t *out, const uint8_t *in, size_t size,
+                       bool swap, bool reverse) {
+  if (!swap && !reverse) {
+    std::memcpy(out, in, size);
+    return;
+  }
+  size_t x = swap ? 1 : 0;
+  for (size_t i = 0; i < size; i++) {
+    if (reverse) {
+      out[-1 - static_cast<ptrdiff_t>(i)] = in[i ^ x];
+    } else {
+      out[i] = in[i ^ x];
+    }
+  }
+}
+
+ROM_COPY_TARGET("ssse3")
+static void CopySsse3(uint8_t *out, const uint8_t *in, size_t size, bool swap,
+                      bool reverse) {
+  if (!swap && !reverse) {
+    std::memcpy(out, in, size);
+    return;
+  }
+  __m128i shuffle = _mm_load_si128(
+      reinterpret_cast<const __m128i *>(kShuffles[swap | reverse << 1]));
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    __m128i v = _mm_shuffle_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i)), shuffle);
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i *>(reverse ? out - i - 16 : out + i), v);
+  }
+  CopyScalar(reverse ? out - i : out + i, in + i, size - i, swap, reverse);
+}
+
+ROM_COPY_TARGET("avx2")
+static void CopyAvx2(uint8_t *out, const uint8_t *in, size_t size, bool swap,
+                     bool reverse) {
+  if (!swap && !reverse) {
+    std::memcpy(out, in, size);
+    return;
+  }
+  __m256i shuffle = _mm256_broadcastsi128_si256(_mm_load_si128(
+      reinterpret_cast<const __m128i *>(kShuffles[swap | reverse << 1])));
+  size_t i = 0;
+  for (; i + 32 <= size; i += 32) {
+    __m256i v = _mm256_shuffle_epi8(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i)),
+        shuffle);
+    // pshufb stays within 128 bit lanes, reversing also swaps the lanes.
+    if (reverse) v = _mm256_permute4x64_epi64(v, 0x4e);
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i *>(reverse ? out - i - 32 : out + i), v);
+  }
+  CopySsse3(reverse ? out - i : out + i, in + i, size - i, swap, reverse);
+}
+
+static const CopyFn kCopies[kIsaCount] = {CopyScalar, CopySsse3, CopyAvx2};
+
+Isa DetectIsa() {
+#if defined(_MSC_VER) && !defined(__clang__)
+  int info[4];
+  __cpuid(info, 1);
+  bool ssse3 = info[2] & (1 << 9);
+  if (!(info[2] & (1 << 27))) return ssse3 ? kSsse3 : kScalar;
+  uint64_t xcr0 = _xgetbv(0);
+  __cpuidex(info, 7, 0);
+  if ((info[1] & (1 << 5)) && (xcr0 & 0x06) == 0x06) return kAvx2;
+  return ssse3 ? kSsse3 : kScalar;
+#else
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) return kAvx2;
+  if (__builtin_cpu_supports("ssse3")) return kSsse3;
+  return kScalar;
+#endif
+}
+
+static CopyFn copy = kCopies[DetectIsa()];
+
+const char *GetIsaName(Isa isa) {
+  static const char *const kNames[kIsaCount] = {"scalar", "SSSE3", "AVX2"};
+  return kNames[isa];
+}
+
+bool SetIsa(Isa isa) {
+  if (isa < kScalar || isa > DetectIsa()) return false;
+  copy = kCopies[isa];
+  return true;
+}
+
+void Copy(uint8_t *out, const uint8_t *in, size_t size, bool swap,
+          bool reverse) {
+  copy(out, in, size, swap, reverse);
+}
+
+}  // namespace rom_copy
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Bulk copies for laying out rom images, see GamesList::ReadGameRom. The
+// kernels are picked once by CPUID.
+namespace rom_copy {
+
+enum Isa : int32_t { kScalar = 0, kSsse3, kAvx2, kIsaCount };
+
+Isa DetectIsa();
+const char *GetIsaName(Isa isa);
+// Copies with the kernels of isa from now on, false if the host lacks it.
+// Not thread safe, meant for tests.
+bool SetIsa(Isa isa);
+
+// Copies in[0, size) to out. Reversed copies write in[i] to out[-1 - i],
+// swapped ones exchange the bytes of every 16 bit word of in, which must
+// then start on a word.
+void Copy(uint8_t *out, const uint8_t *in, size_t size, bool swap,
+          bool reverse);
+
+}  // namespace rom_copy
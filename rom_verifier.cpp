@@ -0,0 +1,261 @@
+#include "rom_verifier.h"
+
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <sstream>
+
+#include "mapped_file.h"
+
+#if defined(__GNUC__)
+#define CRC_TARGET(isa) __attribute__((target(isa)))
+#else
+#define CRC_TARGET(isa)
+#endif
+
+// Crc32 works on the inverted crc, the kernels take and return it as is.
+using Crc32Fn = uint32_t (*)(const uint8_t *data, size_t size, uint32_t crc);
+
+static std::array<uint32_t, 256> MakeCrcTable() {
+  std::array<uint32_t, 256> table;
+  for (uint32_t i = 0; i < 256; i++) {
+    uint32_t c = i;
+    for (int k = 0; k < 8; k++) {
+      c = c & 1 ? 0xedb88320 ^ (c >> 1) : c >> 1;
+    }
+    table[i] = c;
+  }
+  return table;
+}
+
+static const std::array<uint32_t, 256> kCrcTable = MakeCrcTable();
+
+static uint32_t Crc32Table(const uint8_t *data, size_t size, uint32_t crc) {
+  for (size_t i = 0; i < size; i++) {
+    crc = kCrcTable[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+  }
+  return crc;
+}
+
+static inline __m128i Load(const uint8_t *p) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+}
+
+// x * k folded onto the next 16 bytes.
+CRC_TARGET("sse4.1,pclmul")
+static inline __m128i Fold(__m128i x, __m128i k, __m128i next) {
+  __m128i lo = _mm_clmulepi64_si128(x, k, 0x00);
+  __m128i hi = _mm_clmulepi64_si128(x, k, 0x11);
+  return _mm_xor_si128(_mm_xor_si128(hi, lo), next);
+}
+
+// Folds 64 bytes per step with carry-less multiplies, then Barrett reduces
+// to 32 bits, see Intel's "Fast CRC Computation for Generic Polynomials
+// Using PCLMULQDQ Instruction". Constants are for the bit reflected
+// polynomial 0xedb88320.
+CRC_TARGET("sse4.1,pclmul")
+static uint32_t Crc32Pclmul(const uint8_t *data, size_t size, uint32_t crc) {
+  if (size < 64) return Crc32Table(data, size, crc);
+
+  alignas(16) static const uint64_t k1k2[] = {0x0154442bd4, 0x01c6e41596};
+  alignas(16) static const uint64_t k3k4[] = {0x01751997d0, 0x00ccaa009e};
+  alignas(16) static const uint64_t k5k0[] = {0x0163cd6124, 0x0000000000};
+  alignas(16) static const uint64_t poly[] = {0x01db710641, 0x01f7011641};
+
+  __m128i x1 = _mm_xor_si128(Load(data), _mm_cvtsi32_si128(crc));
+  __m128i x2 = Load(data + 0x10);
+  __m128i x3 = Load(data + 0x20);
+  __m128i x4 = Load(data + 0x30);
+  data += 64;
+  size -= 64;
+
+  __m128i k = _mm_load_si128(reinterpret_cast<const __m128i *>(k1k2));
+  while (size >= 64) {
+    x1 = Fold(x1, k, Load(data));
+    x2 = Fold(x2, k, Load(data + 0x10));
+    x3 = Fold(x3, k, Load(data + 0x20));
+    x4 = Fold(x4, k, Load(data + 0x30));
+    data += 64;
+    size -= 64;
+  }
+
+  k = _mm_load_si128(reinterpret_cast<const __m128i *>(k3k4));
+  x1 = Fold(x1, k, x2);
+  x1 = Fold(x1, k, x3);
+  x1 = Fold(x1, k, x4);
+  while (size >= 16) {
+    x1 = Fold(x1, k, Load(data));
+    data += 16;
+    size -= 16;
+  }
+
+  // 128 to 64 bits.
+  __m128i mask = _mm_setr_epi32(~0, 0, ~0, 0);
+  x2 = _mm_clmulepi64_si128(x1, k, 0x10);
+  x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+  k = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(k5k0));
+  x2 = _mm_srli_si128(x1, 4);
+  x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), k, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+
+  // Barrett reduction to 32 bits.
+  k = _mm_load_si128(reinterpret_cast<const __m128i *>(poly));
+  x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), k, 0x10);
+  x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask), k, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+
+  return Crc32Table(data, size,
+                    static_cast<uint32_t>(_mm_extract_epi32(x1, 1)));
+}
+
+static Crc32Fn SelectCrc32() {
+#if defined(_MSC_VER) && !defined(__clang__)
+  int info[4];
+  __cpuid(info, 1);
+  bool pclmul = info[2] & (1 << 1);
+  bool sse41 = info[2] & (1 << 19);
+  return pclmul && sse41 ? Crc32Pclmul : Crc32Table;
+#else
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1")) {
+    return Crc32Pclmul;
+  }
+  return Crc32Table;
+#endif
+}
+
+static const Crc32Fn kCrc32 = SelectCrc32();
+
+uint32_t Crc32(const uint8_t *data, size_t size, uint32_t crc) {
+  return ~kCrc32(data, size, ~crc);
+}
+
+RomVerifier::RomVerifier(std::filesystem::path cache_path)
+    : cache_path_(std::move(cache_path)),
+      cache_dirty_(false),
+      next_job_(0),
+      running_(true) {
+  LoadCache();
+
+  // Hashing is mostly bound by the disk, a few threads are enough.
+  uint32_t threads =
+      std::clamp(std::thread::hardware_concurrency(), 1u, 4u);
+  for (uint32_t i = 0; i < threads; i++) {
+    workers_.emplace_back(&RomVerifier::Worker, this);
+  }
+}
+
+RomVerifier::~RomVerifier() {
+  {
+    std::lock_guard lock(mutex_);
+    running_ = false;
+  }
+  cv_.notify_all();
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+  SaveCache();
+}
+
+uint32_t RomVerifier::Add(const std::filesystem::path &path, uint32_t crc) {
+  uint32_t id;
+  {
+    std::lock_guard lock(mutex_);
+    id = static_cast<uint32_t>(jobs_.size());
+    jobs_.push_back({path, crc, kPending});
+  }
+  cv_.notify_one();
+  return id;
+}
+
+RomVerifier::Status RomVerifier::GetStatus(uint32_t id) {
+  std::lock_guard lock(mutex_);
+  return id < jobs_.size() ? jobs_[id].status : kMissing;
+}
+
+void RomVerifier::Worker() {
+  while (true) {
+    size_t id;
+    Job job;
+    {
+      std::unique_lock lock(mutex_);
+      cv_.wait(lock,
+               [this] { return next_job_ < jobs_.size() || !running_; });
+      if (!running_) break;
+      id = next_job_++;
+      job = jobs_[id];
+    }
+
+    Status status = Check(job);
+
+    std::lock_guard lock(mutex_);
+    jobs_[id].status = status;
+  }
+}
+
+RomVerifier::Status RomVerifier::Check(const Job &job) {
+  std::error_code ec;
+  uint64_t size = std::filesystem::file_size(job.path, ec);
+  if (ec) return kMissing;
+  int64_t mtime = std::filesystem::last_write_time(job.path, ec)
+                      .time_since_epoch()
+                      .count();
+  std::string key = job.path.string();
+
+  {
+    std::lock_guard lock(mutex_);
+    auto it = cache_.find(key);
+    if (it != cache_.end() && it->second.size == size &&
+        it->second.mtime == mtime) {
+      return it->second.crc == job.crc ? kGood : kBad;
+    }
+  }
+
+  uint32_t crc = 0;
+  if (size != 0) {
+    MappedFile file;
+    if (!file.Open(job.path)) return kMissing;
+
+    // Chunked so shutdown doesn't wait for a whole NAND image.
+    constexpr size_t kChunk = 0x400000;
+    for (size_t pos = 0; pos < file.GetSize(); pos += kChunk) {
+      if (!running_) return kPending;
+      crc = Crc32(file.GetData() + pos,
+                  std::min(kChunk, file.GetSize() - pos), crc);
+    }
+  }
+
+  std::lock_guard lock(mutex_);
+  cache_[key] = {size, mtime, crc};
+  cache_dirty_ = true;
+  return crc == job.crc ? kGood : kBad;
+}
+
+void RomVerifier::LoadCache() {
+  std::ifstream file(cache_path_);
+  std::string line;
+  while (std::getline(file, line)) {
+    std::istringstream in(line);
+    CacheEntry entry;
+    std::string path;
+    if (in >> std::hex >> entry.crc >> std::dec >> entry.size >>
+        entry.mtime && in.get() == ' ' && std::getline(in, path)) {
+      cache_[path] = entry;
+    }
+  }
+}
+
+void RomVerifier::SaveCache() {
+  if (!cache_dirty_) return;
+
+  std::ofstream file(cache_path_, std::ios::trunc);
+  for (const auto &[path, entry] : cache_) {
+    file << std::hex << entry.crc << std::dec << " " << entry.size << " "
+         << entry.mtime << " " << path << "\n";
+  }
+}
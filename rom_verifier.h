@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// CRC-32 as used by zip and the ROM_LOAD hashes, crc continues a previous
+// call.
+uint32_t Crc32(const uint8_t *data, size_t size, uint32_t crc = 0);
+
+// Checks rom files against their expected CRC on a pool of worker threads.
+// Results are kept by path, size and mtime in a cache file, so unchanged
+// files are only hashed once.
+class RomVerifier {
+ public:
+  enum Status : uint32_t { kPending, kGood, kBad, kMissing };
+
+  explicit RomVerifier(std::filesystem::path cache_path);
+  ~RomVerifier();
+
+  // Queues a file, the returned id is passed to GetStatus().
+  uint32_t Add(const std::filesystem::path &path, uint32_t crc);
+  Status GetStatus(uint32_t id);
+
+ private:
+  struct Job {
+    std::filesystem::path path;
+    uint32_t crc;
+    Status status;
+  };
+
+  struct CacheEntry {
+    uint64_t size;
+    int64_t mtime;
+    uint32_t crc;
+  };
+
+  std::filesystem::path cache_path_;
+  std::unordered_map<std::string, CacheEntry> cache_;
+  bool cache_dirty_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<Job> jobs_;
+  size_t next_job_;
+  std::atomic<bool> running_;
+  std::vector<std::thread> workers_;
+
+  void Worker();
+  Status Check(const Job &job);
+  void LoadCache();
+  void SaveCache();
+};
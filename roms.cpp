@@ -1,6 +1,10 @@
 
 #include "roms.h"
 
+#include <algorithm>
+
+#include "rom_copy.h"
+
 uint32_t GetRomHash(uint32_t crc) { return crc; }
 uint32_t GetRomHash(uint32_t crc, const char *sha1) { return crc; }
 
@@ -60,11 +64,24 @@ bool GamesList::Load(RomEntry *rom_entry, std::filesystem::path path,
         sub_path = path / rom_entry->name;
         if (std::filesystem::exists(sub_path)) {
           if (open) {
-            rom_entry->file = new std::fstream(
-                sub_path, std::ios_base::in | std::ios_base::binary);
-            if (!rom_entry->file->is_open()) {
+            auto file = std::make_unique<MappedFile>();
+            if (!file->Open(sub_path)) {
               error = true;
+              break;
             }
+            uint32_t length = static_cast<uint32_t>(std::min<size_t>(
+                rom_entry->length, file->GetSize()));
+            regions_.push_back({rom_entry->offset, length, file->GetData(),
+                                rom_entry->type == RomEntryLoadXwordSwap});
+            files_.push_back(std::move(file));
+
+            std::error_code ec;
+            auto mtime = std::filesystem::last_write_time(sub_path, ec);
+            rom_key_ += std::string(rom_entry->name) + ":" +
+                        std::to_string(rom_entry->crc) + ":" +
+                        std::to_string(files_.back()->GetSize()) + ":" +
+                        std::to_string(mtime.time_since_epoch().count()) +
+                        ";";
           }
         } else {
           error = true;
@@ -78,6 +95,9 @@ bool GamesList::Load(RomEntry *rom_entry, std::filesystem::path path,
     return false;
   }
 
+  std::sort(
+      regions_.begin(), regions_.end(),
+      [](const Region &a, const Region &b) { return a.offset < b.offset; });
   return true;
 }
 
@@ -99,9 +119,7 @@ bool GamesList::LoadGame(uint32_t idx, std::string path, bool open) {
   }
 
   if (open) {
-    for (int i = 0; i < 0x21000; i++) {
-      nand_buffer_[i] = GetGameRomValue(0x21000 + i);
-    }
+    ReadGameRom(0x21000, nand_buffer_);
 
     // LoadNANDFile(game->name);
   }
@@ -109,56 +127,85 @@ bool GamesList::LoadGame(uint32_t idx, std::string path, bool open) {
 }
 
 void GamesList::FreeGameRoms() {
-  RomEntry *rom_entry;
-
-  if (game == nullptr) return;
-
-  rom_entry = game->roms;
   game = nullptr;
+  regions_.clear();
+  files_.clear();
+  rom_key_.clear();
+}
 
-  while (rom_entry->type != RomEntryEnd) {
-    switch (rom_entry->type) {
-      case RomEntryLoad:
-      case RomEntryLoadXwordSwap:
-        if (rom_entry->file && rom_entry->file->is_open()) {
-          rom_entry->file->close();
-        }
-        break;
-    }
-    rom_entry++;
-  }
+const GamesList::Region *GamesList::FindRegion(uint32_t offset) const {
+  auto it = std::upper_bound(
+      regions_.begin(), regions_.end(), offset,
+      [](uint32_t offset, const Region &region) {
+        return offset < region.offset;
+      });
+  if (it == regions_.begin()) return nullptr;
+  --it;
+  return offset - it->offset < it->length ? &*it : nullptr;
 }
 
-uint8_t GamesList::GetByte(std::fstream *file, uint32_t ofs, uint32_t rofs) {
-  if ((nand_file_name_.size() != 0) && (ofs >= 0x21000) && (ofs < 0x42000)) {
-    return nand_buffer_[ofs - 0x21000];
-  } else {
-    uint32_t addr = ofs & (~(sector_.size() - 1));
-    if (cursectorloaded != addr) {
-      cursectorloaded = addr;
-      file->seekg(addr - rofs, std::ios::beg);
-      file->read(reinterpret_cast<char *>(&sector_[0]), sector_.size());
-    }
-    return sector_[(ofs - rofs) & (sector_.size() - 1)];
+uint8_t GamesList::GetGameRomValue(uint32_t offset) {
+  if (InNandBuffer(offset, 1)) {
+    return nand_buffer_[offset - 0x21000];
   }
+  const Region *region = FindRegion(offset);
+  if (region == nullptr) return 0;
+  uint32_t pos = offset - region->offset;
+  return region->data[region->swap ? pos ^ 1 : pos];
 }
 
-uint8_t GamesList::GetGameRomValue(uint32_t offset) {
-  RomEntry *romEntry;
-  romEntry = game->roms;
-  while (romEntry->type != RomEntryEnd) {
-    if (offset >= romEntry->offset &&
-        offset < (romEntry->offset + romEntry->length)) {
-      switch (romEntry->type) {
-        case RomEntryLoad:
-          return GetByte(romEntry->file, offset, romEntry->offset);
-        case RomEntryLoadXwordSwap:
-          return GetByte(romEntry->file, offset ^ 1, romEntry->offset);
-      }
+void GamesList::ReadGameRom(uint32_t offset, std::span<uint8_t> dst,
+                            bool reverse) {
+  uint64_t dst_end = static_cast<uint64_t>(offset) + dst.size();
+  uint64_t filled = offset;
+
+  // Where rom byte from lands in dst, reversed reads write backwards from
+  // the returned end.
+  auto out = [&](uint64_t from) {
+    return reverse ? dst.data() + (dst_end - from)
+                   : dst.data() + (from - offset);
+  };
+  auto zero = [&](uint64_t from, uint64_t to) {
+    if (from >= to) return;
+    std::memset(reverse ? out(to) : out(from), 0, to - from);
+  };
+
+  for (const auto &region : regions_) {
+    uint64_t begin = std::max<uint64_t>(offset, region.offset);
+    uint64_t end =
+        std::min<uint64_t>(dst_end, uint64_t{region.offset} + region.length);
+    if (begin >= end) continue;
+
+    zero(filled, begin);
+    uint32_t pos = static_cast<uint32_t>(begin - region.offset);
+    if (region.swap && (pos & 1)) {
+      // Start on a word so the kernels see whole words.
+      *(reverse ? out(begin) - 1 : out(begin)) =
+          region.data[pos ^ 1];
+      begin++;
+      pos++;
     }
-    romEntry++;
+    rom_copy::Copy(out(begin), region.data + pos,
+                   static_cast<size_t>(end - begin), region.swap, reverse);
+    filled = end;
+  }
+  zero(filled, dst_end);
+
+  if (InNandBuffer(offset, static_cast<uint32_t>(dst.size()))) {
+    uint32_t begin = std::max<uint32_t>(offset, 0x21000);
+    uint32_t end = static_cast<uint32_t>(std::min<uint64_t>(dst_end, 0x42000));
+    rom_copy::Copy(out(begin), &nand_buffer_[begin - 0x21000], end - begin,
+                   false, reverse);
   }
-  return 0;
+}
+
+const uint8_t *GamesList::GetGameRomPtr(uint32_t offset, uint32_t size) {
+  if (InNandBuffer(offset, size)) return nullptr;
+  const Region *region = FindRegion(offset);
+  if (region == nullptr || region->swap) return nullptr;
+  uint32_t pos = offset - region->offset;
+  if (size > region->length - pos) return nullptr;
+  return region->data + pos;
 }
 
 void GamesList::SetGameRomValue(uint32_t offset, uint8_t val) {
@@ -5,7 +5,12 @@
 #include <cstdio>
 #include <cstring>
 #include <filesystem>
-#include <fstream>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "mapped_file.h"
 
 enum EGameField {
   eGameFieldName = 0,
@@ -30,7 +35,6 @@ struct RomEntry {
   uint32_t dest;
   uint32_t width;
   uint32_t crc;
-  std::fstream *file;
 };
 
 struct GameEntry {
@@ -45,14 +49,13 @@ struct GameEntry {
 
 #define ROM_START(name) static RomEntry roms_##name[] = {
 #define ROM_LOAD(name, offset, length, hash) \
-  {RomEntryLoad, name, offset, length, 0, 0, GetRomHash(hash), nullptr},
+  {RomEntryLoad, name, offset, length, 0, 0, GetRomHash(hash)},
 #define ROM_LOADX_WORD_SWAP(name, offset, length, width, hash) \
-  {RomEntryLoadXwordSwap, name,   offset, length, 0, width,    \
-   GetRomHash(hash),      nullptr},
+  {RomEntryLoadXwordSwap, name, offset, length, 0, width, GetRomHash(hash)},
 #define ROM_LOAD_SWAP(name, offset, length, hash) \
   ROM_LOADX_WORD_SWAP(name, offset, length, 2, hash)
 #define ROM_RELOAD(offset, length) \
-  {RomEntryReload, nullptr, offset, length, 0, 0, GetRomHash(0), nullptr},
+  {RomEntryReload, nullptr, offset, length, 0, 0, GetRomHash(0)},
 #define ROM_END                                       \
   { RomEntryEnd, nullptr, 0, 0, 0, 0, GetRomHash(0) } \
   }                                                   \
@@ -205,7 +208,19 @@ class GamesList {
   bool LoadGame(uint32_t idx, std::string path, bool open);
   void FreeGameRoms();
   uint8_t GetGameRomValue(uint32_t offset);
+  // Copies dst.size() bytes from offset, bytes outside any rom read as 0.
+  // Reversed reads store the last byte first, the layout of bios_ and ram_.
+  void ReadGameRom(uint32_t offset, std::span<uint8_t> dst,
+                   bool reverse = false);
+  // Direct pointer into a mapped rom, nullptr when the range isn't one
+  // unswapped file.
+  const uint8_t *GetGameRomPtr(uint32_t offset, uint32_t size);
   void SetGameRomValue(uint32_t offset, uint8_t val);
+  // The writable NAND blocks, kept in memory only.
+  std::span<uint8_t> GetNandBuffer() { return nand_buffer_; }
+  // Identifies the loaded rom files: name, expected crc, size and mtime of
+  // each, see RomCache.
+  const std::string &GetRomKey() const { return rom_key_; }
 
  private:
   uint32_t count_;
@@ -215,8 +230,21 @@ class GamesList {
   std::string nand_file_name_;
   std::array<uint8_t, 0x21000> nand_buffer_;
 
-  int32_t cursectorloaded = -1;
-  std::array<uint8_t, 32768> sector_;
-  uint8_t GetByte(std::fstream *file, uint32_t ofs, uint32_t rofs);
+  // A loaded rom file, regions_ is sorted by offset.
+  struct Region {
+    uint32_t offset;
+    uint32_t length;
+    const uint8_t *data;
+    bool swap;
+  };
+  std::vector<Region> regions_;
+  std::vector<std::unique_ptr<MappedFile>> files_;
+  std::string rom_key_;
+
+  const Region *FindRegion(uint32_t offset) const;
+  bool InNandBuffer(uint32_t offset, uint32_t size) const {
+    return !nand_file_name_.empty() && offset < 0x42000 &&
+           offset + size > 0x21000;
+  }
   bool Load(RomEntry *rom_entry, std::filesystem::path path, bool open);
 };
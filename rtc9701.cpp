@@ -1,6 +1,7 @@
 
 #include "rtc9701.h"
 
+#include <algorithm>
 #include <array>
 #include <cstring>
 #include <ctime>
@@ -256,6 +257,41 @@ void Rtc9701::SetClockLine(int state) {
   rtc9701_clock_line = state;
 }
 
+void Rtc9701::SaveState(state::Writer &writer) const {
+  writer.Begin(state::Tag("RTC "), 1);
+  writer.Put(static_cast<uint32_t>(rtc9701_serial_count));
+  writer.Put(rtc9701_serial_buffer);
+  writer.Put(rtc9701_data_bits);
+  writer.Put(rtc9701_send_bits);
+  writer.Put(rtc9701_clock_count);
+  writer.Put(eeprom_);
+  writer.Put(rtc_data);
+  writer.Put(rtc9701_latch);
+  writer.Put(rtc9701_locked);
+  writer.Put(rtc9701_sending);
+  writer.Put(rtc9701_reset_line);
+  writer.Put(rtc9701_clock_line);
+  writer.Put(rtc9701_reset_delay);
+}
+
+void Rtc9701::LoadState(state::Reader &reader) {
+  rtc9701_serial_count =
+      std::min<size_t>(reader.Get<uint32_t>(),
+                       std::size(rtc9701_serial_buffer) - 1);
+  reader.Get(rtc9701_serial_buffer);
+  reader.Get(rtc9701_data_bits);
+  reader.Get(rtc9701_send_bits);
+  reader.Get(rtc9701_clock_count);
+  reader.Get(eeprom_);
+  reader.Get(rtc_data);
+  reader.Get(rtc9701_latch);
+  reader.Get(rtc9701_locked);
+  reader.Get(rtc9701_sending);
+  reader.Get(rtc9701_reset_line);
+  reader.Get(rtc9701_clock_line);
+  reader.Get(rtc9701_reset_delay);
+}
+
 uint8_t Rtc9701::Read8(uint32_t addr) {
   switch (addr & 0xffff) {
     case 0x0001:
@@ -3,6 +3,8 @@
 #include <cstdint>
 #include <cstring>
 
+#include "save_state.h"
+
 struct Rtc9701Interface {
   int address_bits;
   int data_bits;
@@ -22,6 +24,9 @@ class Rtc9701 {
   uint8_t Read8(uint32_t addr);
   void Write8(uint32_t addr, uint8_t value);
 
+  void SaveState(state::Writer &writer) const;
+  void LoadState(state::Reader &reader);
+
  private:
   enum {
     kClearLine = 0,
@@ -0,0 +1,334 @@
+#include "save_state.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <system_error>
+
+#include "lz.h"
+#include "mapped_file.h"
+
+namespace state {
+
+static constexpr uint32_t kMagic = 0x5453434e;  // "NCST"
+static constexpr uint32_t kVersion = 1;
+static constexpr uint32_t kFlagMemory = 1;
+static constexpr size_t kPageSize = 0x10000;
+
+enum PageKind : uint8_t { kPageFill, kPageLz, kPageRaw };
+
+template <typename T>
+static void Put(std::ofstream &file, const T &value) {
+  file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+// Reads a T at pos, false if the file is too short.
+template <typename T>
+static bool Get(const MappedFile &file, size_t &pos, T &value) {
+  if (file.GetSize() - pos < sizeof(T)) return false;
+  std::memcpy(&value, file.GetData() + pos, sizeof(T));
+  pos += sizeof(T);
+  return true;
+}
+
+std::vector<uint8_t> Writer::NewBuffer() {
+  size_t index = chunks_.size();
+  if (index >= spare_.size()) return {};
+  auto buffer = std::move(spare_[index].data);
+  buffer.clear();
+  return buffer;
+}
+
+void Writer::Begin(uint32_t tag, uint32_t version) {
+  chunks_.push_back({tag, version, false, 0, NewBuffer()});
+}
+
+void Writer::Put(const void *data, size_t size) {
+  auto &chunk = chunks_.back();
+  auto bytes = static_cast<const uint8_t *>(data);
+  chunk.data.insert(chunk.data.end(), bytes, bytes + size);
+  chunk.size = chunk.data.size();
+}
+
+static bool IsUniform(const uint8_t *page, size_t size) {
+  uint64_t fill;
+  std::memset(&fill, page[0], sizeof(fill));
+  size_t i = 0;
+  for (; i + sizeof(fill) <= size; i += sizeof(fill)) {
+    uint64_t value;
+    std::memcpy(&value, page + i, sizeof(value));
+    if (value != fill) return false;
+  }
+  for (; i < size; i++) {
+    if (page[i] != page[0]) return false;
+  }
+  return true;
+}
+
+void Writer::PutMemory(uint32_t tag, uint32_t version,
+                       std::span<const uint8_t> memory) {
+  Chunk chunk{tag, version, true, memory.size(), NewBuffer()};
+  auto &out = chunk.data;
+  // Reserving never touches the memory, only copied pages are faulted in.
+  out.reserve(memory.size() + (memory.size() / kPageSize + 1) * 2);
+  for (size_t pos = 0; pos < memory.size(); pos += kPageSize) {
+    const uint8_t *page = memory.data() + pos;
+    size_t size = std::min(kPageSize, memory.size() - pos);
+    if (IsUniform(page, size)) {
+      out.push_back(kPageFill);
+      out.push_back(page[0]);
+    } else {
+      out.push_back(kPageRaw);
+      out.insert(out.end(), page, page + size);
+    }
+  }
+  chunks_.push_back(std::move(chunk));
+}
+
+void Reader::Get(void *data, size_t size) {
+  if (!ok_ || chunk_->data.size() - pos_ < size) {
+    ok_ = false;
+    std::memset(data, 0, size);
+    return;
+  }
+  std::memcpy(data, chunk_->data.data() + pos_, size);
+  pos_ += size;
+}
+
+static bool DecodeMemory(const uint8_t *in, size_t n,
+                         std::span<uint8_t> memory) {
+  size_t pos = 0;
+  for (size_t out = 0; out < memory.size(); out += kPageSize) {
+    uint8_t *page = memory.data() + out;
+    size_t size = std::min(kPageSize, memory.size() - out);
+    if (pos == n) return false;
+    switch (in[pos++]) {
+      case kPageFill:
+        if (pos == n) return false;
+        std::memset(page, in[pos++], size);
+        break;
+      case kPageLz: {
+        uint32_t packed_size;
+        if (n - pos < sizeof(packed_size)) return false;
+        std::memcpy(&packed_size, in + pos, sizeof(packed_size));
+        pos += sizeof(packed_size);
+        if (n - pos < packed_size ||
+            !lz::Decompress(in + pos, packed_size, page, size)) {
+          return false;
+        }
+        pos += packed_size;
+        break;
+      }
+      case kPageRaw:
+        if (n - pos < size) return false;
+        std::memcpy(page, in + pos, size);
+        pos += size;
+        break;
+      default:
+        return false;
+    }
+  }
+  return pos == n;
+}
+
+void Reader::GetMemory(std::span<uint8_t> memory) {
+  if (!ok_ || pos_ != 0 || !chunk_->memory || chunk_->size != memory.size() ||
+      !DecodeMemory(chunk_->data.data(), chunk_->data.size(), memory)) {
+    ok_ = false;
+    return;
+  }
+  pos_ = chunk_->data.size();
+}
+
+// Compresses the raw pages of a page stream, others are copied.
+static void CompressMemory(const std::vector<uint8_t> &in, uint64_t size,
+                           std::vector<uint8_t> &out) {
+  std::vector<uint8_t> packed(lz::GetBound(kPageSize));
+  out.clear();
+  size_t pos = 0;
+  for (uint64_t page = 0; page < size; page += kPageSize) {
+    size_t page_size = std::min<uint64_t>(kPageSize, size - page);
+    if (in[pos] != kPageRaw) {
+      size_t length = 2;
+      if (in[pos] == kPageLz) {
+        uint32_t packed_size;
+        std::memcpy(&packed_size, &in[pos + 1], sizeof(packed_size));
+        length = 1 + sizeof(packed_size) + packed_size;
+      }
+      out.insert(out.end(), &in[pos], &in[pos] + length);
+      pos += length;
+      continue;
+    }
+
+    const uint8_t *raw = &in[pos + 1];
+    pos += 1 + page_size;
+    uint32_t packed_size =
+        static_cast<uint32_t>(lz::Compress(raw, page_size, packed.data()));
+    if (packed_size < page_size) {
+      out.push_back(kPageLz);
+      auto bytes = reinterpret_cast<const uint8_t *>(&packed_size);
+      out.insert(out.end(), bytes, bytes + sizeof(packed_size));
+      out.insert(out.end(), packed.data(), packed.data() + packed_size);
+    } else {
+      out.push_back(kPageRaw);
+      out.insert(out.end(), raw, raw + page_size);
+    }
+  }
+}
+
+bool Save(const std::filesystem::path &path, const std::vector<Chunk> &chunks) {
+  std::error_code ec;
+  if (path.has_parent_path()) {
+    std::filesystem::create_directories(path.parent_path(), ec);
+  }
+
+  // Written aside and renamed so a crash never leaves a partial state.
+  auto tmp_path = path;
+  tmp_path += ".tmp";
+
+  std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) return false;
+
+  Put(file, kMagic);
+  Put(file, kVersion);
+  Put(file, static_cast<uint32_t>(chunks.size()));
+  std::vector<uint8_t> encoded;
+  for (const auto &chunk : chunks) {
+    const std::vector<uint8_t> *stored = &chunk.data;
+    if (chunk.memory) {
+      CompressMemory(chunk.data, chunk.size, encoded);
+      stored = &encoded;
+    }
+    Put(file, chunk.tag);
+    Put(file, chunk.version);
+    Put(file, chunk.memory ? kFlagMemory : 0u);
+    Put(file, chunk.size);
+    Put(file, static_cast<uint64_t>(stored->size()));
+    file.write(reinterpret_cast<const char *>(stored->data()),
+               stored->size());
+  }
+  file.close();
+
+  if (file.fail()) {
+    std::filesystem::remove(tmp_path, ec);
+    return false;
+  }
+  std::filesystem::rename(tmp_path, path, ec);
+  return !ec;
+}
+
+bool Load(const std::filesystem::path &path, std::vector<Chunk> &chunks) {
+  MappedFile file;
+  if (!file.Open(path)) return false;
+
+  size_t pos = 0;
+  uint32_t magic, version, count;
+  if (!Get(file, pos, magic) || !Get(file, pos, version) ||
+      !Get(file, pos, count) || magic != kMagic || version != kVersion) {
+    return false;
+  }
+
+  chunks.clear();
+  for (uint32_t i = 0; i < count; i++) {
+    Chunk chunk;
+    uint32_t flags;
+    uint64_t stored;
+    if (!Get(file, pos, chunk.tag) || !Get(file, pos, chunk.version) ||
+        !Get(file, pos, flags) || !Get(file, pos, chunk.size) ||
+        !Get(file, pos, stored) || file.GetSize() - pos < stored) {
+      return false;
+    }
+    chunk.memory = (flags & kFlagMemory) != 0;
+    if (!chunk.memory && chunk.size != stored) return false;
+
+    const uint8_t *data = file.GetData() + pos;
+    chunk.data.assign(data, data + stored);
+    pos += stored;
+    chunks.push_back(std::move(chunk));
+  }
+  return pos == file.GetSize();
+}
+
+const Chunk *Find(const std::vector<Chunk> &chunks, uint32_t tag) {
+  for (const auto &chunk : chunks) {
+    if (chunk.tag == tag) return &chunk;
+  }
+  return nullptr;
+}
+
+template <typename T>
+static void Put(std::vector<uint8_t> &out, const T &value) {
+  auto bytes = reinterpret_cast<const uint8_t *>(&value);
+  out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+static bool Get(std::span<const uint8_t> in, size_t &pos, T &value) {
+  if (in.size() - pos < sizeof(T)) return false;
+  std::memcpy(&value, in.data() + pos, sizeof(T));
+  pos += sizeof(T);
+  return true;
+}
+
+void Pack(const std::vector<Chunk> &chunks, std::vector<uint8_t> &out) {
+  out.clear();
+  Put(out, static_cast<uint32_t>(chunks.size()));
+  for (const auto &chunk : chunks) {
+    Put(out, chunk.tag);
+    Put(out, chunk.version);
+    Put(out, chunk.memory ? kFlagMemory : 0u);
+    Put(out, chunk.size);
+    Put(out, static_cast<uint64_t>(chunk.data.size()));
+    out.insert(out.end(), chunk.data.begin(), chunk.data.end());
+  }
+}
+
+bool Unpack(std::span<const uint8_t> in, std::vector<Chunk> &chunks) {
+  size_t pos = 0;
+  uint32_t count;
+  if (!Get(in, pos, count)) return false;
+  chunks.clear();
+  for (uint32_t i = 0; i < count; i++) {
+    Chunk chunk;
+    uint32_t flags;
+    uint64_t stored;
+    if (!Get(in, pos, chunk.tag) || !Get(in, pos, chunk.version) ||
+        !Get(in, pos, flags) || !Get(in, pos, chunk.size) ||
+        !Get(in, pos, stored) || in.size() - pos < stored) {
+      return false;
+    }
+    chunk.memory = (flags & kFlagMemory) != 0;
+    chunk.data.assign(in.data() + pos, in.data() + pos + stored);
+    pos += stored;
+    chunks.push_back(std::move(chunk));
+  }
+  return true;
+}
+
+void AsyncSaver::Save(std::filesystem::path path, std::vector<Chunk> chunks) {
+  Wait();
+  done_ = false;
+  spare_ = std::move(chunks);
+  thread_ = std::thread([this, path = std::move(path)]() {
+    written_ = state::Save(path, spare_);
+    if (!written_) {
+      std::cout << "Failed to write state " << path.string() << std::endl;
+    }
+    done_ = true;
+  });
+}
+
+bool AsyncSaver::Wait() {
+  if (thread_.joinable()) thread_.join();
+  return written_;
+}
+
+std::vector<Chunk> AsyncSaver::TakeSpare() {
+  if (thread_.joinable()) {
+    if (!done_) return {};
+    thread_.join();
+  }
+  return std::move(spare_);
+}
+
+}  // namespace state
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+#include <filesystem>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Machine snapshots. A state file is a header followed by chunks, one or
+// more per component, each with its own tag and version so components can
+// change their layout independently. Memory images are stored in 64 KiB
+// pages, each a single fill byte if uniform (memory the game never
+// touched) or LZ4 block compressed.
+//
+// Layout, all fields native:
+//   magic "NCST", version u32, chunk count u32
+//   per chunk: tag u32, version u32, flags u32, size u64, stored size u64,
+//              stored bytes
+//   memory pages: kind u8, then a fill byte, a u32 size and compressed
+//                 bytes, or the raw page
+namespace state {
+
+constexpr uint32_t Tag(const char (&name)[5]) {
+  return static_cast<uint8_t>(name[0]) | static_cast<uint8_t>(name[1]) << 8 |
+         static_cast<uint8_t>(name[2]) << 16 |
+         static_cast<uint32_t>(static_cast<uint8_t>(name[3])) << 24;
+}
+
+struct Chunk {
+  uint32_t tag;
+  uint32_t version;
+  // data holds pages as laid out above, size is the image's.
+  bool memory;
+  uint64_t size;
+  std::vector<uint8_t> data;
+};
+
+// Collects a snapshot on the emulation thread. Values go into the chunk
+// opened by the last Begin(). Memory pages are only checked for a fill
+// byte and copied, Save() compresses them. Buffers of the chunks of an
+// earlier snapshot are reused, saving a fresh allocation's page faults.
+class Writer {
+ public:
+  Writer() = default;
+  explicit Writer(std::vector<Chunk> spare) : spare_(std::move(spare)) {}
+
+  void Begin(uint32_t tag, uint32_t version);
+  void Put(const void *data, size_t size);
+  template <typename T>
+  void Put(const T &value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    Put(&value, sizeof(T));
+  }
+  void PutMemory(uint32_t tag, uint32_t version,
+                 std::span<const uint8_t> memory);
+
+  std::vector<Chunk> &GetChunks() { return chunks_; }
+
+ private:
+  std::vector<Chunk> chunks_;
+  std::vector<Chunk> spare_;
+
+  std::vector<uint8_t> NewBuffer();
+};
+
+// Reads one chunk back. Reading past its end yields zeros and fails the
+// reader, so a component can read everything and check once.
+class Reader {
+ public:
+  explicit Reader(const Chunk *chunk) : chunk_(chunk), ok_(chunk != nullptr) {}
+
+  void Get(void *data, size_t size);
+  template <typename T>
+  void Get(T &value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    Get(&value, sizeof(T));
+  }
+  template <typename T>
+  T Get() {
+    T value;
+    Get(value);
+    return value;
+  }
+  // Unpacks a memory chunk, which must be exactly memory's size.
+  void GetMemory(std::span<uint8_t> memory);
+
+  uint32_t GetVersion() const { return chunk_ ? chunk_->version : 0; }
+  // Everything read was there and, once done, nothing is left over.
+  bool IsDone() const { return ok_ && pos_ == chunk_->data.size(); }
+
+ private:
+  const Chunk *chunk_;
+  size_t pos_ = 0;
+  bool ok_;
+};
+
+// Compresses and writes chunks to path, false on a write error.
+bool Save(const std::filesystem::path &path, const std::vector<Chunk> &chunks);
+// Reads a state file, false if it is missing or malformed. Memory chunks
+// are unpacked by Reader::GetMemory().
+bool Load(const std::filesystem::path &path, std::vector<Chunk> &chunks);
+const Chunk *Find(const std::vector<Chunk> &chunks, uint32_t tag);
+// The chunk layout of a file without its header or compression, for
+// snapshots kept in memory. Unpack() ignores bytes past the last chunk.
+void Pack(const std::vector<Chunk> &chunks, std::vector<uint8_t> &out);
+bool Unpack(std::span<const uint8_t> in, std::vector<Chunk> &chunks);
+
+// Runs Save() on its own thread, so the emulation thread only pays for
+// collecting the snapshot. One save at a time, a new one waits for the
+// last.
+class AsyncSaver {
+ public:
+  ~AsyncSaver() { Wait(); }
+
+  void Save(std::filesystem::path path, std::vector<Chunk> chunks);
+  // Waits for the save being written, false if the last save failed.
+  bool Wait();
+  // The chunks of the last finished save for a Writer to reuse, empty
+  // while it is still being written.
+  std::vector<Chunk> TakeSpare();
+
+ private:
+  std::thread thread_;
+  std::atomic<bool> done_ = false;
+  bool written_ = true;
+  std::vector<Chunk> spare_;
+};
+
+}  // namespace state
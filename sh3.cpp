@@ -5,11 +5,20 @@
 #include <iostream>
 
 #include "sh3_interpreter.h"
+#include "sh3_jit.h"
 
 namespace sh3 {
 
-Cpu::Cpu() : interrupt_imask(0), interrupt_pending(0), interrupt_mask(0) {
+Cpu::Cpu()
+    : interrupt_imask(0),
+      interrupt_pending(0),
+      interrupt_mask(0),
+      jit_enabled(false),
+      sleeping(false),
+      idle_cycles(0),
+      volatile_reads(0) {
   interpreter = new Interpreter(this);
+  jit = new Jit(this);
 
   Reset();
 
@@ -35,6 +44,7 @@ Cpu::Cpu() : interrupt_imask(0), interrupt_pending(0), interrupt_mask(0) {
 
 Cpu::~Cpu() {
   delete interpreter;
+  delete jit;
   delete tmu0;
   delete tmu1;
   delete tmu2;
@@ -102,6 +112,7 @@ void Cpu::Init(std::vector<Map>& map) {
   map.push_back(sh3::Map(0xF5000000, 0x01000000, mem_handler));
   Mmu::Init(map);
 
+  code_regions.clear();
   interpreter->Init();
   Reset();
 }
@@ -109,6 +120,7 @@ void Cpu::Init(std::vector<Map>& map) {
 void Cpu::Reset(bool soft) {
   state.sr.all = 0x700000f0;
   state.pc = state.npc = 0xa0000000;
+  sleeping = false;
 
   std::memset(&regs1[0], 0, sizeof(regs1));
   std::memset(&regs2[0], 0, sizeof(regs2));
@@ -121,8 +133,71 @@ void Cpu::Reset(bool soft) {
   TCNT_2 = 0xFFFFFFFF;
 }
 
+void Cpu::SaveState(state::Writer &writer) const {
+  writer.Begin(state::Tag("CPU "), 1);
+  writer.Put(state);
+  writer.Put(regs1);
+  writer.Put(regs2);
+  writer.Put(interrupt_pending);
+  writer.Put(interrupt_mask);
+  writer.Put(interrupt_bit);
+  writer.Put(sleeping);
+  writer.Put(volatile_reads);
+  SaveTlb(writer);
+
+  Counters::SaveState(writer);
+  for (auto *counter : {tmu0, tmu1, tmu2, dma0, irq}) {
+    SaveCounter(writer, counter);
+  }
+}
+
+void Cpu::LoadState(state::Reader &reader) {
+  reader.Get(state);
+  reader.Get(regs1);
+  reader.Get(regs2);
+  reader.Get(interrupt_pending);
+  reader.Get(interrupt_mask);
+  reader.Get(interrupt_bit);
+  reader.Get(sleeping);
+  reader.Get(volatile_reads);
+  LoadTlb(reader);
+  // Rebuilds the tables derived from the priority registers, the saved
+  // interrupt bits are the ones those registers produced.
+  RecomputeInterrupt();
+
+  Counters::LoadState(reader);
+  for (auto *counter : {tmu0, tmu1, tmu2, dma0, irq}) {
+    LoadCounter(reader, counter);
+  }
+
+  interpreter->Flush();
+  if (jit_enabled) {
+    jit->Flush();
+  }
+}
+
+void Cpu::SetJit(bool enable) {
+  interpreter->Flush();
+  jit_enabled = enable && jit->Init();
+}
+
+void Cpu::InvalidateCodePage(uint32_t addr) {
+  code_pages[(addr & 0x1fffffff) >> kCodePageShift] = 0;
+  if (jit_enabled) {
+    jit->Invalidate(addr);
+  } else {
+    interpreter->Invalidate(addr);
+  }
+}
+
 void Cpu::Run() {
-  interpreter->Run(icount);
+  if (sleeping) {
+    Idle();
+  } else if (jit_enabled) {
+    jit->Run(icount);
+  } else {
+    interpreter->Run(icount);
+  }
   TestCounters();
   TestInterrupt();
 }
@@ -3,6 +3,7 @@
 #include <array>
 #include <cstdint>
 #include <functional>
+#include <utility>
 #include <vector>
 
 #include "sh3_mmu.h"
@@ -61,6 +62,21 @@ class Cpu : public Mmu, public counters::Counters {
   void Run();
 
   void SetClockRate(uint32_t clk) { pclk_rate = clk; }
+  void SetJit(bool enable);
+
+  void AddCodeRegion(uint32_t addr, uint32_t size) {
+    code_regions.push_back({addr, size});
+  }
+
+  bool IsCodeAddress(uint32_t addr) {
+    if (addr >= 0xe0000000) return false;
+
+    uint32_t phys = addr & 0x1fffffff;
+    for (auto &region : code_regions) {
+      if (phys - region.first < region.second) return true;
+    }
+    return false;
+  }
 
   void SetIoRead(int port, std::function<uint8_t()> io_r) {
     io_read[port] = io_r;
@@ -79,9 +95,30 @@ class Cpu : public Mmu, public counters::Counters {
                              : (uint32_t &)regs1[addr & (regs1.size() - 1)];
   }
 
+  // Skips the rest of the current time slice, the next Run() starts at the
+  // next scheduled event.
+  void Idle() {
+    if (icount > 0) {
+      idle_cycles += icount;
+      icount = 0;
+    }
+  }
+
+  // Device reads that move on each time keep a polling loop from idling,
+  // see volatile_reads.
+  void CountVolatileRead() { volatile_reads++; }
+
+  // Cycles skipped by Idle(), not executed by the core.
+  uint64_t GetIdleCycles() const { return idle_cycles; }
+
   void SetInterruptPending(uint32_t intr);
   void ResetInterruptPending(uint32_t intr);
 
+  // Registers, on-chip modules, TLBs and the scheduler with the CPU's own
+  // counters. Loading drops all translated code.
+  void SaveState(state::Writer &writer) const;
+  void LoadState(state::Reader &reader);
+
  private:
   alignas(64) State state;
 
@@ -231,7 +268,20 @@ class Cpu : public Mmu, public counters::Counters {
 
   void SwapBank();
 
+  void InvalidateCodePage(uint32_t addr) override;
+
   Interpreter *interpreter;
+  Jit *jit;
+  bool jit_enabled;
+  bool sleeping;
+  uint64_t idle_cycles;
+
+  // Bumped on every read whose value moves or that changes the device it
+  // reads: TMU counts, NAND and RTC data. Idle loops doing such reads must
+  // not be fast-forwarded.
+  uint32_t volatile_reads;
+
+  std::vector<std::pair<uint32_t, uint32_t>> code_regions;
 
   uint32_t ReadIcAddr(uint32_t addr) { return 0; }
   void WriteIcAddr(uint32_t addr, uint32_t v) {}
@@ -8,9 +8,15 @@
 #include "sh3.h"
 
 namespace sh3 {
-Interpreter::Interpreter(Cpu* c) : cpu(c), delay_slot_(false), branch(false) {
+Interpreter::Interpreter(Cpu* c)
+    : slot_(nullptr),
+      invalidated_(false),
+      cpu(c),
+      delay_slot_(false),
+      branch(false) {
   for (size_t i = 0; i < std::size(opTable); i++) {
     opTable[i] = &Interpreter::Unknown;
+    opFlags[i] = kNone;
   }
 
   for (size_t i = 0; i < std::size(opTemplate); i++) {
@@ -18,27 +24,318 @@ Interpreter::Interpreter(Cpu* c) : cpu(c), delay_slot_(false), branch(false) {
     for (size_t j = 0; j < std::size(opTable); j++) {
       if ((j & op.mask) == op.opcode) {
         opTable[j] = op.op;
+        opFlags[j] = op.flags;
       }
     }
   }
+  lookup_.fill(nullptr);
 }
 
-void Interpreter::Init() {}
+void Interpreter::Init() { Flush(); }
+
+void Interpreter::Flush() {
+  blocks_.clear();
+  page_blocks_.clear();
+  lookup_.fill(nullptr);
+  cpu->code_pages.fill(0);
+}
+
+void Interpreter::Invalidate(uint32_t addr) {
+  uint32_t page = (addr & 0x1fffffff) >> Cpu::kCodePageShift;
+
+  auto it = page_blocks_.find(page);
+  if (it == page_blocks_.end()) return;
+
+  invalidated_ = true;
+  for (uint32_t pc : it->second) {
+    auto& entry = lookup_[(pc >> 1) & (kBlockLookupSize - 1)];
+    if (entry != nullptr && entry->pc == pc) entry = nullptr;
+    blocks_.erase(pc);
+  }
+  page_blocks_.erase(it);
+}
 
 void Interpreter::Run(int32_t& icount) {
   while (true) {
+    Block* block = GetBlock(cpu->state.pc);
+
+    if (block == nullptr) {
+      branch = false;
+      cpu->state.npc = cpu->state.pc + 2;
+      icount -= Step(cpu->state.pc);
+      cpu->state.pc = cpu->state.npc;
+      if (branch && icount <= 0) break;
+      continue;
+    }
+
+    if (RunBlock(block, icount)) break;
+  }
+}
+
+bool Interpreter::RunBlock(Block* block, int32_t& icount) {
+  const Decoded* op = block->ops.data();
+  const Decoded* end = op + block->ops.size();
+
+  // Invalidation frees the block, keep what is needed after the loop.
+  bool idle = block->idle;
+  uint32_t pc = block->pc;
+  uint32_t volatile_reads = cpu->volatile_reads;
+
+  slot_ = block->has_slot ? &block->slot : nullptr;
+  invalidated_ = false;
+  for (; op != end; op++) {
     branch = false;
     cpu->state.npc = cpu->state.pc + 2;
-    icount -= Step(cpu->state.pc);
+    icount -= (this->*op->op)(op->code);
     cpu->state.pc = cpu->state.npc;
-    if (branch && icount <= 0) {
+    // A RAM write may have dropped this block.
+    if (invalidated_) break;
+  }
+  slot_ = nullptr;
+
+  // A polling loop that went around again will keep doing so until the
+  // next event changes what it reads.
+  if (idle && !invalidated_ && (cpu->state.pc & 0x1fffffff) == pc &&
+      cpu->volatile_reads == volatile_reads) {
+    cpu->Idle();
+  }
+
+  return branch && icount <= 0;
+}
+
+Interpreter::Block* Interpreter::GetBlock(uint32_t pc) {
+  uint32_t phys = pc & 0x1fffffff;
+  auto& entry = lookup_[(phys >> 1) & (kBlockLookupSize - 1)];
+  if (entry != nullptr && entry->pc == phys) {
+    return entry;
+  }
+
+  auto it = blocks_.find(phys);
+  if (it != blocks_.end()) {
+    entry = &it->second;
+    return entry;
+  }
+
+  if (!cpu->IsCodeAddress(pc)) {
+    return nullptr;
+  }
+
+  entry = Decode(pc);
+  return entry;
+}
+
+Interpreter::Block* Interpreter::Decode(uint32_t pc) {
+  uint32_t phys = pc & 0x1fffffff;
+  uint32_t start = pc;
+  Block& block = blocks_[phys];
+  block.pc = phys;
+  block.has_slot = false;
+  block.idle = false;
+
+  uint8_t flags = kNone;
+  for (uint32_t i = 0; i < kMaxBlockOps && cpu->IsCodeAddress(pc); i++) {
+    uint32_t code = cpu->Read16(pc);
+    block.ops.push_back({opTable[code], code});
+    flags = opFlags[code];
+    pc += 2;
+    if (flags & kBranch) break;
+  }
+
+  if ((flags & kDelaySlot) && cpu->IsCodeAddress(pc)) {
+    uint32_t code = cpu->Read16(pc);
+    block.slot = {opTable[code], code};
+    block.has_slot = true;
+    pc += 2;
+  }
+
+  if (flags & kBranch) {
+    uint32_t branch_pc = block.has_slot ? pc - 4 : pc - 2;
+    block.idle = IsIdleLoop(start, branch_pc);
+  }
+
+  uint32_t first = phys >> Cpu::kCodePageShift;
+  uint32_t last = ((pc - 2) & 0x1fffffff) >> Cpu::kCodePageShift;
+  for (uint32_t page = first; page <= last; page++) {
+    page_blocks_[page].push_back(phys);
+    cpu->code_pages[page] = 1;
+  }
+
+  return &block;
+}
+
+bool Interpreter::IsIdleLoop(uint32_t start, uint32_t pc) {
+  if (pc < start || (pc - start) / 2 >= kMaxIdleOps) return false;
+
+  uint32_t code = cpu->Read16(pc);
+  uint32_t target;
+  bool slot;
+  switch (code & 0xff00) {
+    case 0x8900:
+    case 0x8b00:
+      target = pc + ((int32_t)(int8_t)code << 1) + 4;
+      slot = false;
       break;
+    case 0x8d00:
+    case 0x8f00:
+      target = pc + ((int32_t)(int8_t)code << 1) + 4;
+      slot = true;
+      break;
+    default:
+      if ((code & 0xf000) != 0xa000) return false;
+      target = pc + ((int32_t)(code << 20) >> 19) + 4;
+      slot = true;
+      break;
+  }
+  if (target != start) return false;
+
+  // Every register the loop writes must be written before it is read, so
+  // one iteration does not depend on the previous one. T is bit 16.
+  uint32_t written = 0;
+  uint32_t carried = 0;
+  uint32_t end = slot ? pc + 2 : pc;
+  for (uint32_t addr = start; addr <= end; addr += 2) {
+    uint32_t reads = 0;
+    uint32_t writes = 0;
+    code = cpu->Read16(addr);
+    if (addr == pc) {
+      reads = (code & 0xf000) == 0xa000 ? 0 : 1 << 16;
+    } else if (!GetLoopOperands(code, reads, writes)) {
+      return false;
     }
+    carried |= reads & ~written;
+    written |= writes;
   }
+
+  return (carried & written) == 0;
+}
+
+// Register usage of the instructions allowed in an idle loop: loads,
+// register moves, logic and compares. Stores and anything touching
+// control registers make the loop non-idle.
+bool Interpreter::GetLoopOperands(uint32_t code, uint32_t& reads,
+                                  uint32_t& writes) {
+  uint32_t n = 1 << ((code >> 8) & 0x0f);
+  uint32_t m = 1 << ((code >> 4) & 0x0f);
+  const uint32_t r0 = 1 << 0;
+  const uint32_t t = 1 << 16;
+
+  if (code == 0x0009) return true;
+
+  switch (code & 0xf000) {
+    case 0x5000:
+      reads = m;
+      writes = n;
+      return true;
+    case 0x9000:
+    case 0xd000:
+    case 0xe000:
+      writes = n;
+      return true;
+  }
+
+  switch (code & 0xff00) {
+    case 0x8400:
+    case 0x8500:
+      reads = m;
+      writes = r0;
+      return true;
+    case 0x8800:
+    case 0xc800:
+      reads = r0;
+      writes = t;
+      return true;
+    case 0xc400:
+    case 0xc500:
+    case 0xc600:
+    case 0xc700:
+      writes = r0;
+      return true;
+    case 0xc900:
+    case 0xca00:
+    case 0xcb00:
+      reads = r0;
+      writes = r0;
+      return true;
+  }
+
+  switch (code & 0xf00f) {
+    case 0x000c:
+    case 0x000d:
+    case 0x000e:
+      reads = r0 | m;
+      writes = n;
+      return true;
+    case 0x2008:
+    case 0x200c:
+    case 0x3000:
+    case 0x3002:
+    case 0x3003:
+    case 0x3006:
+    case 0x3007:
+      reads = n | m;
+      writes = t;
+      return true;
+    case 0x2009:
+    case 0x200a:
+    case 0x200b:
+      reads = n | m;
+      writes = n;
+      return true;
+    case 0x6000:
+    case 0x6001:
+    case 0x6002:
+    case 0x6003:
+    case 0x6007:
+    case 0x6008:
+    case 0x6009:
+    case 0x600c:
+    case 0x600d:
+    case 0x600e:
+    case 0x600f:
+      reads = m;
+      writes = n;
+      return true;
+  }
+
+  switch (code & 0xf0ff) {
+    case 0x4011:
+    case 0x4015:
+      reads = n;
+      writes = t;
+      return true;
+    case 0x4000:
+    case 0x4001:
+    case 0x4020:
+    case 0x4021:
+      reads = n;
+      writes = n | t;
+      return true;
+    case 0x4008:
+    case 0x4009:
+    case 0x4018:
+    case 0x4019:
+    case 0x4028:
+    case 0x4029:
+      reads = n;
+      writes = n;
+      return true;
+  }
+
+  return false;
 }
 
 uint32_t Interpreter::Step(uint32_t pc) {
+  if (slot_ != nullptr) {
+    const Decoded* slot = slot_;
+    slot_ = nullptr;
+    return (this->*slot->op)(slot->code);
+  }
+
   uint32_t code = cpu->Read16(pc);
+  return Execute(code);
+}
+
+uint32_t Interpreter::Execute(uint32_t code) {
   return (this->*opTable[code])(code);
 }
 
@@ -1295,6 +1592,8 @@ uint32_t Interpreter::Shar(uint32_t code) {
 uint32_t Interpreter::Sleep(uint32_t code) {
   IsSlotIllegal();
 
+  cpu->sleeping = true;
+  cpu->Idle();
   branch = true;
 
   return 1;
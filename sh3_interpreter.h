@@ -1,7 +1,10 @@
 
 #pragma once
 
+#include <array>
 #include <cstdint>
+#include <unordered_map>
+#include <vector>
 
 namespace sh3 {
 class Cpu;
@@ -10,10 +13,50 @@ class Interpreter {
   void Init();
   void Run(int32_t &icount);
   uint32_t Step(uint32_t pc);
+  uint32_t Execute(uint32_t code);
+  void Flush();
+  void Invalidate(uint32_t addr);
+  bool IsIdleLoop(uint32_t start, uint32_t pc);
 
   Interpreter(Cpu *c);
 
  private:
+  const static uint32_t kMaxBlockOps = 64;
+  const static uint32_t kBlockLookupSize = 0x1000;
+  const static uint32_t kMaxIdleOps = 16;
+
+  enum OpFlags : uint8_t {
+    kNone = 0,
+    kBranch = 1,
+    kDelaySlot = 2,
+  };
+
+  struct Decoded {
+    uint32_t (Interpreter::*op)(uint32_t code);
+    uint32_t code;
+  };
+
+  // Run of pre-decoded instructions starting at a physical pc. A block ends
+  // at the first branch, whose delay slot is decoded into |slot|.
+  struct Block {
+    uint32_t pc;
+    std::vector<Decoded> ops;
+    Decoded slot;
+    bool has_slot;
+    bool idle;
+  };
+
+  std::unordered_map<uint32_t, Block> blocks_;
+  std::unordered_map<uint32_t, std::vector<uint32_t>> page_blocks_;
+  std::array<Block *, kBlockLookupSize> lookup_;
+  const Decoded *slot_;
+  bool invalidated_;
+
+  Block *GetBlock(uint32_t pc);
+  Block *Decode(uint32_t pc);
+  bool RunBlock(Block *block, int32_t &icount);
+  bool GetLoopOperands(uint32_t code, uint32_t &reads, uint32_t &writes);
+
   void IsPrivilege();
   void IsSlotIllegal();
 
@@ -195,178 +238,180 @@ class Interpreter {
   uint32_t Xtrct(uint32_t code);
 
   uint32_t (Interpreter::*opTable[0x00010000])(uint32_t code);
+  uint8_t opFlags[0x00010000];
 
   struct OpTemplate {
     uint32_t opcode;
     uint32_t mask;
     uint32_t (Interpreter::*op)(uint32_t code);
+    uint8_t flags;
   };
 
   constexpr static OpTemplate opTemplate[] = {
-      {0x300c, 0xf00f, &Interpreter::Add},
-      {0x300e, 0xf00f, &Interpreter::Addc},
-      {0x7000, 0xf000, &Interpreter::Addi},
-      {0x300f, 0xf00f, &Interpreter::Addv},
-      {0x2009, 0xf00f, &Interpreter::And},
-      {0xc900, 0xff00, &Interpreter::Andi},
-      {0xcd00, 0xff00, &Interpreter::Andm},
-      {0x8b00, 0xff00, &Interpreter::Bf},
-      {0x8f00, 0xff00, &Interpreter::Bfs},
-      {0xa000, 0xf000, &Interpreter::Bra},
-      {0x0023, 0xf0ff, &Interpreter::Braf},
-      {0xb000, 0xf000, &Interpreter::Bsr},
-      {0x0003, 0xf0ff, &Interpreter::Bsrf},
-      {0x8900, 0xff00, &Interpreter::Bt},
-      {0x8d00, 0xff00, &Interpreter::Bts},
-      {0x0028, 0xffff, &Interpreter::Clrmac},
-      {0x0048, 0xffff, &Interpreter::Clrs},
-      {0x0008, 0xffff, &Interpreter::Clrt},
-      {0x3000, 0xf00f, &Interpreter::Cmpeq},
-      {0x3003, 0xf00f, &Interpreter::Cmpge},
-      {0x3007, 0xf00f, &Interpreter::Cmpgt},
-      {0x3006, 0xf00f, &Interpreter::Cmphi},
-      {0x3002, 0xf00f, &Interpreter::Cmphs},
-      {0x8800, 0xff00, &Interpreter::Cmpim},
-      {0x4015, 0xf0ff, &Interpreter::Cmppl},
-      {0x4011, 0xf0ff, &Interpreter::Cmppz},
-      {0x200c, 0xf00f, &Interpreter::Cmpstr},
-      {0x2007, 0xf00f, &Interpreter::Div0s},
-      {0x0019, 0xffff, &Interpreter::Div0u},
-      {0x3004, 0xf00f, &Interpreter::Div1},
-      {0x300d, 0xf00f, &Interpreter::Dmuls},
-      {0x3005, 0xf00f, &Interpreter::Dmulu},
-      {0x4010, 0xf0ff, &Interpreter::Dt},
-      {0x600e, 0xf00f, &Interpreter::Extsb},
-      {0x600f, 0xf00f, &Interpreter::Extsw},
-      {0x600c, 0xf00f, &Interpreter::Extub},
-      {0x600d, 0xf00f, &Interpreter::Extuw},
-      {0x402b, 0xf0ff, &Interpreter::Jmp},
-      {0x400b, 0xf0ff, &Interpreter::Jsr},
-      {0x401e, 0xf0ff, &Interpreter::Ldcgbr},
-      {0x4017, 0xf0ff, &Interpreter::Ldcmgbr},
-      {0x4087, 0xf08f, &Interpreter::Ldcmrbank},
-      {0x4047, 0xf0ff, &Interpreter::Ldcmspc},
-      {0x4007, 0xf0ff, &Interpreter::Ldcmsr},
-      {0x4037, 0xf0ff, &Interpreter::Ldcmssr},
-      {0x4027, 0xf0ff, &Interpreter::Ldcmvbr},
-      {0x408e, 0xf08f, &Interpreter::Ldcrbank},
-      {0x404e, 0xf0ff, &Interpreter::Ldcspc},
-      {0x400e, 0xf0ff, &Interpreter::Ldcsr},
-      {0x403e, 0xf0ff, &Interpreter::Ldcssr},
-      {0x402e, 0xf0ff, &Interpreter::Ldcvbr},
-      {0x400a, 0xf0ff, &Interpreter::Ldsmach},
-      {0x401a, 0xf0ff, &Interpreter::Ldsmacl},
-      {0x4006, 0xf0ff, &Interpreter::Ldsmmach},
-      {0x4016, 0xf0ff, &Interpreter::Ldsmmacl},
-      {0x4026, 0xf0ff, &Interpreter::Ldsmpr},
-      {0x402a, 0xf0ff, &Interpreter::Ldspr},
-      {0x0038, 0xffff, &Interpreter::Ldtlb},
-      {0x000f, 0xf00f, &Interpreter::Macl},
-      {0x400f, 0xf00f, &Interpreter::Macw},
-      {0x6003, 0xf00f, &Interpreter::Mov},
-      {0xc700, 0xff00, &Interpreter::Mova},
-      {0x6000, 0xf00f, &Interpreter::Movbl},
-      {0x000c, 0xf00f, &Interpreter::Movbl0},
-      {0x8400, 0xff00, &Interpreter::Movbl4},
-      {0xc400, 0xff00, &Interpreter::Movblg},
-      {0x2004, 0xf00f, &Interpreter::Movbm},
-      {0x6004, 0xf00f, &Interpreter::Movbp},
-      {0x2000, 0xf00f, &Interpreter::Movbs},
-      {0x0004, 0xf00f, &Interpreter::Movbs0},
-      {0x8000, 0xff00, &Interpreter::Movbs4},
-      {0xc000, 0xff00, &Interpreter::Movbsg},
-      {0x00c3, 0xf0ff, &Interpreter::Movcal},
-      {0xe000, 0xf000, &Interpreter::Movi},
-      {0xd000, 0xf000, &Interpreter::Movli},
-      {0x6002, 0xf00f, &Interpreter::Movll},
-      {0x000e, 0xf00f, &Interpreter::Movll0},
-      {0x5000, 0xf000, &Interpreter::Movll4},
-      {0xc600, 0xff00, &Interpreter::Movllg},
-      {0x2006, 0xf00f, &Interpreter::Movlm},
-      {0x6006, 0xf00f, &Interpreter::Movlp},
-      {0x2002, 0xf00f, &Interpreter::Movls},
-      {0x0006, 0xf00f, &Interpreter::Movls0},
-      {0x1000, 0xf000, &Interpreter::Movls4},
-      {0xc200, 0xff00, &Interpreter::Movlsg},
-      {0x0029, 0xf0ff, &Interpreter::Movt},
-      {0x9000, 0xf000, &Interpreter::Movwi},
-      {0x6001, 0xf00f, &Interpreter::Movwl},
-      {0x000d, 0xf00f, &Interpreter::Movwl0},
-      {0x8500, 0xff00, &Interpreter::Movwl4},
-      {0xc500, 0xff00, &Interpreter::Movwlg},
-      {0x2005, 0xf00f, &Interpreter::Movwm},
-      {0x6005, 0xf00f, &Interpreter::Movwp},
-      {0x2001, 0xf00f, &Interpreter::Movws},
-      {0x0005, 0xf00f, &Interpreter::Movws0},
-      {0x8100, 0xff00, &Interpreter::Movws4},
-      {0xc100, 0xff00, &Interpreter::Movwsg},
-      {0x0007, 0xf00f, &Interpreter::Mull},
-      {0x200f, 0xf00f, &Interpreter::Mulsw},
-      {0x200e, 0xf00f, &Interpreter::Mulsu},
-      {0x600b, 0xf00f, &Interpreter::Neg},
-      {0x600a, 0xf00f, &Interpreter::Negc},
-      {0x0009, 0xffff, &Interpreter::Nop},
-      {0x6007, 0xf00f, &Interpreter::Not},
-      {0x0093, 0xf0ff, &Interpreter::Ocbi},
-      {0x00a3, 0xf0ff, &Interpreter::Ocbp},
-      {0x00b3, 0xf0ff, &Interpreter::Ocbwb},
-      {0x200b, 0xf00f, &Interpreter::Or},
-      {0xcb00, 0xff00, &Interpreter::Ori},
-      {0xcf00, 0xff00, &Interpreter::Orm},
-      {0x0083, 0xf0ff, &Interpreter::Pref},
-      {0x4024, 0xf0ff, &Interpreter::Rotcl},
-      {0x4025, 0xf0ff, &Interpreter::Rotcr},
-      {0x4004, 0xf0ff, &Interpreter::Rotl},
-      {0x4005, 0xf0ff, &Interpreter::Rotr},
-      {0x002b, 0xffff, &Interpreter::Rte},
-      {0x000b, 0xffff, &Interpreter::Rts},
-      {0x0058, 0xffff, &Interpreter::Sets},
-      {0x0018, 0xffff, &Interpreter::Sett},
-      {0x400c, 0xf00f, &Interpreter::Shad},
-      {0x4020, 0xf0ff, &Interpreter::Shal},
-      {0x4021, 0xf0ff, &Interpreter::Shar},
-      {0x400d, 0xf00f, &Interpreter::Shld},
-      {0x4000, 0xf0ff, &Interpreter::Shll},
-      {0x4028, 0xf0ff, &Interpreter::Shll16},
-      {0x4008, 0xf0ff, &Interpreter::Shll2},
-      {0x4018, 0xf0ff, &Interpreter::Shll8},
-      {0x4001, 0xf0ff, &Interpreter::Shlr},
-      {0x4029, 0xf0ff, &Interpreter::Shlr16},
-      {0x4009, 0xf0ff, &Interpreter::Shlr2},
-      {0x4019, 0xf0ff, &Interpreter::Shlr8},
-      {0x001b, 0xffff, &Interpreter::Sleep},
-      {0x0012, 0xf0ff, &Interpreter::Stcgbr},
-      {0x4013, 0xf0ff, &Interpreter::Stcmgbr},
-      {0x4083, 0xf08f, &Interpreter::Stcmrbank},
-      {0x4043, 0xf0ff, &Interpreter::Stcmspc},
-      {0x4003, 0xf0ff, &Interpreter::Stcmsr},
-      {0x4033, 0xf0ff, &Interpreter::Stcmssr},
-      {0x4023, 0xf0ff, &Interpreter::Stcmvbr},
-      {0x0082, 0xf08f, &Interpreter::Stcrbank},
-      {0x0042, 0xf0ff, &Interpreter::Stcspc},
-      {0x0002, 0xf0ff, &Interpreter::Stcsr},
-      {0x0032, 0xf0ff, &Interpreter::Stcssr},
-      {0x0022, 0xf0ff, &Interpreter::Stcvbr},
-      {0x000a, 0xf0ff, &Interpreter::Stsmach},
-      {0x001a, 0xf0ff, &Interpreter::Stsmacl},
-      {0x4002, 0xf0ff, &Interpreter::Stsmmach},
-      {0x4012, 0xf0ff, &Interpreter::Stsmmacl},
-      {0x4022, 0xf0ff, &Interpreter::Stsmpr},
-      {0x002a, 0xf0ff, &Interpreter::Stspr},
-      {0x3008, 0xf00f, &Interpreter::Sub},
-      {0x300a, 0xf00f, &Interpreter::Subc},
-      {0x300b, 0xf00f, &Interpreter::Subv},
-      {0x6008, 0xf00f, &Interpreter::Swapb},
-      {0x6009, 0xf00f, &Interpreter::Swapw},
-      {0x401b, 0xf0ff, &Interpreter::Tas},
-      {0xc300, 0xff00, &Interpreter::Trapa},
-      {0x2008, 0xf00f, &Interpreter::Tst},
-      {0xc800, 0xff00, &Interpreter::Tsti},
-      {0xcc00, 0xff00, &Interpreter::Tstm},
-      {0x200a, 0xf00f, &Interpreter::Xor},
-      {0xca00, 0xff00, &Interpreter::Xori},
-      {0xce00, 0xff00, &Interpreter::Xorm},
-      {0x200d, 0xf00f, &Interpreter::Xtrct},
+      {0x300c, 0xf00f, &Interpreter::Add, kNone},
+      {0x300e, 0xf00f, &Interpreter::Addc, kNone},
+      {0x7000, 0xf000, &Interpreter::Addi, kNone},
+      {0x300f, 0xf00f, &Interpreter::Addv, kNone},
+      {0x2009, 0xf00f, &Interpreter::And, kNone},
+      {0xc900, 0xff00, &Interpreter::Andi, kNone},
+      {0xcd00, 0xff00, &Interpreter::Andm, kNone},
+      {0x8b00, 0xff00, &Interpreter::Bf, kBranch},
+      {0x8f00, 0xff00, &Interpreter::Bfs, kBranch | kDelaySlot},
+      {0xa000, 0xf000, &Interpreter::Bra, kBranch | kDelaySlot},
+      {0x0023, 0xf0ff, &Interpreter::Braf, kBranch | kDelaySlot},
+      {0xb000, 0xf000, &Interpreter::Bsr, kBranch | kDelaySlot},
+      {0x0003, 0xf0ff, &Interpreter::Bsrf, kBranch | kDelaySlot},
+      {0x8900, 0xff00, &Interpreter::Bt, kBranch},
+      {0x8d00, 0xff00, &Interpreter::Bts, kBranch | kDelaySlot},
+      {0x0028, 0xffff, &Interpreter::Clrmac, kNone},
+      {0x0048, 0xffff, &Interpreter::Clrs, kNone},
+      {0x0008, 0xffff, &Interpreter::Clrt, kNone},
+      {0x3000, 0xf00f, &Interpreter::Cmpeq, kNone},
+      {0x3003, 0xf00f, &Interpreter::Cmpge, kNone},
+      {0x3007, 0xf00f, &Interpreter::Cmpgt, kNone},
+      {0x3006, 0xf00f, &Interpreter::Cmphi, kNone},
+      {0x3002, 0xf00f, &Interpreter::Cmphs, kNone},
+      {0x8800, 0xff00, &Interpreter::Cmpim, kNone},
+      {0x4015, 0xf0ff, &Interpreter::Cmppl, kNone},
+      {0x4011, 0xf0ff, &Interpreter::Cmppz, kNone},
+      {0x200c, 0xf00f, &Interpreter::Cmpstr, kNone},
+      {0x2007, 0xf00f, &Interpreter::Div0s, kNone},
+      {0x0019, 0xffff, &Interpreter::Div0u, kNone},
+      {0x3004, 0xf00f, &Interpreter::Div1, kNone},
+      {0x300d, 0xf00f, &Interpreter::Dmuls, kNone},
+      {0x3005, 0xf00f, &Interpreter::Dmulu, kNone},
+      {0x4010, 0xf0ff, &Interpreter::Dt, kNone},
+      {0x600e, 0xf00f, &Interpreter::Extsb, kNone},
+      {0x600f, 0xf00f, &Interpreter::Extsw, kNone},
+      {0x600c, 0xf00f, &Interpreter::Extub, kNone},
+      {0x600d, 0xf00f, &Interpreter::Extuw, kNone},
+      {0x402b, 0xf0ff, &Interpreter::Jmp, kBranch | kDelaySlot},
+      {0x400b, 0xf0ff, &Interpreter::Jsr, kBranch | kDelaySlot},
+      {0x401e, 0xf0ff, &Interpreter::Ldcgbr, kNone},
+      {0x4017, 0xf0ff, &Interpreter::Ldcmgbr, kNone},
+      {0x4087, 0xf08f, &Interpreter::Ldcmrbank, kNone},
+      {0x4047, 0xf0ff, &Interpreter::Ldcmspc, kNone},
+      {0x4007, 0xf0ff, &Interpreter::Ldcmsr, kNone},
+      {0x4037, 0xf0ff, &Interpreter::Ldcmssr, kNone},
+      {0x4027, 0xf0ff, &Interpreter::Ldcmvbr, kNone},
+      {0x408e, 0xf08f, &Interpreter::Ldcrbank, kNone},
+      {0x404e, 0xf0ff, &Interpreter::Ldcspc, kNone},
+      {0x400e, 0xf0ff, &Interpreter::Ldcsr, kNone},
+      {0x403e, 0xf0ff, &Interpreter::Ldcssr, kNone},
+      {0x402e, 0xf0ff, &Interpreter::Ldcvbr, kNone},
+      {0x400a, 0xf0ff, &Interpreter::Ldsmach, kNone},
+      {0x401a, 0xf0ff, &Interpreter::Ldsmacl, kNone},
+      {0x4006, 0xf0ff, &Interpreter::Ldsmmach, kNone},
+      {0x4016, 0xf0ff, &Interpreter::Ldsmmacl, kNone},
+      {0x4026, 0xf0ff, &Interpreter::Ldsmpr, kNone},
+      {0x402a, 0xf0ff, &Interpreter::Ldspr, kNone},
+      {0x0038, 0xffff, &Interpreter::Ldtlb, kNone},
+      {0x000f, 0xf00f, &Interpreter::Macl, kNone},
+      {0x400f, 0xf00f, &Interpreter::Macw, kNone},
+      {0x6003, 0xf00f, &Interpreter::Mov, kNone},
+      {0xc700, 0xff00, &Interpreter::Mova, kNone},
+      {0x6000, 0xf00f, &Interpreter::Movbl, kNone},
+      {0x000c, 0xf00f, &Interpreter::Movbl0, kNone},
+      {0x8400, 0xff00, &Interpreter::Movbl4, kNone},
+      {0xc400, 0xff00, &Interpreter::Movblg, kNone},
+      {0x2004, 0xf00f, &Interpreter::Movbm, kNone},
+      {0x6004, 0xf00f, &Interpreter::Movbp, kNone},
+      {0x2000, 0xf00f, &Interpreter::Movbs, kNone},
+      {0x0004, 0xf00f, &Interpreter::Movbs0, kNone},
+      {0x8000, 0xff00, &Interpreter::Movbs4, kNone},
+      {0xc000, 0xff00, &Interpreter::Movbsg, kNone},
+      {0x00c3, 0xf0ff, &Interpreter::Movcal, kNone},
+      {0xe000, 0xf000, &Interpreter::Movi, kNone},
+      {0xd000, 0xf000, &Interpreter::Movli, kNone},
+      {0x6002, 0xf00f, &Interpreter::Movll, kNone},
+      {0x000e, 0xf00f, &Interpreter::Movll0, kNone},
+      {0x5000, 0xf000, &Interpreter::Movll4, kNone},
+      {0xc600, 0xff00, &Interpreter::Movllg, kNone},
+      {0x2006, 0xf00f, &Interpreter::Movlm, kNone},
+      {0x6006, 0xf00f, &Interpreter::Movlp, kNone},
+      {0x2002, 0xf00f, &Interpreter::Movls, kNone},
+      {0x0006, 0xf00f, &Interpreter::Movls0, kNone},
+      {0x1000, 0xf000, &Interpreter::Movls4, kNone},
+      {0xc200, 0xff00, &Interpreter::Movlsg, kNone},
+      {0x0029, 0xf0ff, &Interpreter::Movt, kNone},
+      {0x9000, 0xf000, &Interpreter::Movwi, kNone},
+      {0x6001, 0xf00f, &Interpreter::Movwl, kNone},
+      {0x000d, 0xf00f, &Interpreter::Movwl0, kNone},
+      {0x8500, 0xff00, &Interpreter::Movwl4, kNone},
+      {0xc500, 0xff00, &Interpreter::Movwlg, kNone},
+      {0x2005, 0xf00f, &Interpreter::Movwm, kNone},
+      {0x6005, 0xf00f, &Interpreter::Movwp, kNone},
+      {0x2001, 0xf00f, &Interpreter::Movws, kNone},
+      {0x0005, 0xf00f, &Interpreter::Movws0, kNone},
+      {0x8100, 0xff00, &Interpreter::Movws4, kNone},
+      {0xc100, 0xff00, &Interpreter::Movwsg, kNone},
+      {0x0007, 0xf00f, &Interpreter::Mull, kNone},
+      {0x200f, 0xf00f, &Interpreter::Mulsw, kNone},
+      {0x200e, 0xf00f, &Interpreter::Mulsu, kNone},
+      {0x600b, 0xf00f, &Interpreter::Neg, kNone},
+      {0x600a, 0xf00f, &Interpreter::Negc, kNone},
+      {0x0009, 0xffff, &Interpreter::Nop, kNone},
+      {0x6007, 0xf00f, &Interpreter::Not, kNone},
+      {0x0093, 0xf0ff, &Interpreter::Ocbi, kNone},
+      {0x00a3, 0xf0ff, &Interpreter::Ocbp, kNone},
+      {0x00b3, 0xf0ff, &Interpreter::Ocbwb, kNone},
+      {0x200b, 0xf00f, &Interpreter::Or, kNone},
+      {0xcb00, 0xff00, &Interpreter::Ori, kNone},
+      {0xcf00, 0xff00, &Interpreter::Orm, kNone},
+      {0x0083, 0xf0ff, &Interpreter::Pref, kNone},
+      {0x4024, 0xf0ff, &Interpreter::Rotcl, kNone},
+      {0x4025, 0xf0ff, &Interpreter::Rotcr, kNone},
+      {0x4004, 0xf0ff, &Interpreter::Rotl, kNone},
+      {0x4005, 0xf0ff, &Interpreter::Rotr, kNone},
+      {0x002b, 0xffff, &Interpreter::Rte, kBranch | kDelaySlot},
+      {0x000b, 0xffff, &Interpreter::Rts, kBranch | kDelaySlot},
+      {0x0058, 0xffff, &Interpreter::Sets, kNone},
+      {0x0018, 0xffff, &Interpreter::Sett, kNone},
+      {0x400c, 0xf00f, &Interpreter::Shad, kNone},
+      {0x4020, 0xf0ff, &Interpreter::Shal, kNone},
+      {0x4021, 0xf0ff, &Interpreter::Shar, kNone},
+      {0x400d, 0xf00f, &Interpreter::Shld, kNone},
+      {0x4000, 0xf0ff, &Interpreter::Shll, kNone},
+      {0x4028, 0xf0ff, &Interpreter::Shll16, kNone},
+      {0x4008, 0xf0ff, &Interpreter::Shll2, kNone},
+      {0x4018, 0xf0ff, &Interpreter::Shll8, kNone},
+      {0x4001, 0xf0ff, &Interpreter::Shlr, kNone},
+      {0x4029, 0xf0ff, &Interpreter::Shlr16, kNone},
+      {0x4009, 0xf0ff, &Interpreter::Shlr2, kNone},
+      {0x4019, 0xf0ff, &Interpreter::Shlr8, kNone},
+      {0x001b, 0xffff, &Interpreter::Sleep, kBranch},
+      {0x0012, 0xf0ff, &Interpreter::Stcgbr, kNone},
+      {0x4013, 0xf0ff, &Interpreter::Stcmgbr, kNone},
+      {0x4083, 0xf08f, &Interpreter::Stcmrbank, kNone},
+      {0x4043, 0xf0ff, &Interpreter::Stcmspc, kNone},
+      {0x4003, 0xf0ff, &Interpreter::Stcmsr, kNone},
+      {0x4033, 0xf0ff, &Interpreter::Stcmssr, kNone},
+      {0x4023, 0xf0ff, &Interpreter::Stcmvbr, kNone},
+      {0x0082, 0xf08f, &Interpreter::Stcrbank, kNone},
+      {0x0042, 0xf0ff, &Interpreter::Stcspc, kNone},
+      {0x0002, 0xf0ff, &Interpreter::Stcsr, kNone},
+      {0x0032, 0xf0ff, &Interpreter::Stcssr, kNone},
+      {0x0022, 0xf0ff, &Interpreter::Stcvbr, kNone},
+      {0x000a, 0xf0ff, &Interpreter::Stsmach, kNone},
+      {0x001a, 0xf0ff, &Interpreter::Stsmacl, kNone},
+      {0x4002, 0xf0ff, &Interpreter::Stsmmach, kNone},
+      {0x4012, 0xf0ff, &Interpreter::Stsmmacl, kNone},
+      {0x4022, 0xf0ff, &Interpreter::Stsmpr, kNone},
+      {0x002a, 0xf0ff, &Interpreter::Stspr, kNone},
+      {0x3008, 0xf00f, &Interpreter::Sub, kNone},
+      {0x300a, 0xf00f, &Interpreter::Subc, kNone},
+      {0x300b, 0xf00f, &Interpreter::Subv, kNone},
+      {0x6008, 0xf00f, &Interpreter::Swapb, kNone},
+      {0x6009, 0xf00f, &Interpreter::Swapw, kNone},
+      {0x401b, 0xf0ff, &Interpreter::Tas, kNone},
+      {0xc300, 0xff00, &Interpreter::Trapa, kBranch},
+      {0x2008, 0xf00f, &Interpreter::Tst, kNone},
+      {0xc800, 0xff00, &Interpreter::Tsti, kNone},
+      {0xcc00, 0xff00, &Interpreter::Tstm, kNone},
+      {0x200a, 0xf00f, &Interpreter::Xor, kNone},
+      {0xca00, 0xff00, &Interpreter::Xori, kNone},
+      {0xce00, 0xff00, &Interpreter::Xorm, kNone},
+      {0x200d, 0xf00f, &Interpreter::Xtrct, kNone},
   };
 };
 }  // namespace sh3
\ No newline at end of file
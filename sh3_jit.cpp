@@ -0,0 +1,1734 @@
+#include "sh3_jit.h"
+
+#include <algorithm>
+#include <cstddef>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#include "sh3.h"
+#include "sh3_interpreter.h"
+
+namespace sh3 {
+using namespace x64;
+
+Jit::Jit(Cpu* c) : cpu(c), code_(nullptr), invalidated_(false) {
+  for (size_t i = 0; i < std::size(opTable); i++) {
+    opTable[i] = &Jit::Fallback;
+    opFlags[i] = kNone;
+  }
+
+  for (size_t i = 0; i < std::size(opTemplate); i++) {
+    auto& op = opTemplate[i];
+    for (size_t j = 0; j < std::size(opTable); j++) {
+      if ((j & op.mask) == op.opcode) {
+        opTable[j] = op.op;
+        opFlags[j] = op.flags;
+      }
+    }
+  }
+
+  state_offset_ = static_cast<int32_t>(reinterpret_cast<uint8_t*>(&cpu->state) -
+                                       reinterpret_cast<uint8_t*>(cpu));
+  icount_offset_ =
+      static_cast<int32_t>(reinterpret_cast<uint8_t*>(&cpu->icount) -
+                           reinterpret_cast<uint8_t*>(cpu));
+
+  const x64::Reg regs[kNumHostRegs] = {kRbp, kR12, kR13, kR14};
+  for (int i = 0; i < kNumHostRegs; i++) {
+    host_regs_[i] = {regs[i], -1, false, 0};
+  }
+  lookup_.fill(nullptr);
+}
+
+Jit::~Jit() {
+  if (code_ == nullptr) return;
+#if defined(_WIN32)
+  VirtualFree(code_, 0, MEM_RELEASE);
+#else
+  munmap(code_, kCodeSize);
+#endif
+}
+
+bool Jit::IsSupported() {
+#if defined(__x86_64__) || defined(_M_X64)
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool Jit::Init() {
+  if (!IsSupported()) return false;
+
+  if (code_ == nullptr) {
+#if defined(_WIN32)
+    code_ = static_cast<uint8_t*>(VirtualAlloc(nullptr, kCodeSize,
+                                               MEM_COMMIT | MEM_RESERVE,
+                                               PAGE_EXECUTE_READWRITE));
+#else
+    void* mem = mmap(nullptr, kCodeSize, PROT_READ | PROT_WRITE | PROT_EXEC,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    code_ = mem == MAP_FAILED ? nullptr : static_cast<uint8_t*>(mem);
+#endif
+    if (code_ == nullptr) return false;
+    emitter_.SetBuffer(code_, kCodeSize);
+  }
+
+  Flush();
+  return true;
+}
+
+void Jit::Flush() {
+  blocks_.clear();
+  page_blocks_.clear();
+  lookup_.fill(nullptr);
+  cpu->code_pages.fill(0);
+  emitter_.Reset();
+}
+
+void Jit::Invalidate(uint32_t addr) {
+  uint32_t page = (addr & 0x1fffffff) >> Cpu::kCodePageShift;
+
+  auto it = page_blocks_.find(page);
+  if (it == page_blocks_.end()) return;
+
+  invalidated_ = true;
+  for (uint32_t pc : it->second) {
+    auto& entry = lookup_[(pc >> 1) & (kBlockLookupSize - 1)];
+    if (entry != nullptr && entry->pc == pc) entry = nullptr;
+    blocks_.erase(pc);
+  }
+  page_blocks_.erase(it);
+}
+
+void Jit::Run(int32_t& icount) {
+  while (true) {
+    uint32_t pc = cpu->state.pc;
+    Block* block = GetBlock(pc);
+
+    if (block == nullptr) {
+      cpu->state.npc = pc + 2;
+      icount -= cpu->interpreter->Step(pc);
+      cpu->state.pc = cpu->state.npc;
+      if (icount <= 0) break;
+      continue;
+    }
+
+    // The block may invalidate itself through a RAM write.
+    bool branch = block->branch;
+    bool idle = block->idle;
+    uint32_t volatile_reads = cpu->volatile_reads;
+    block->code(cpu);
+    if (idle && cpu->state.pc == pc && cpu->volatile_reads == volatile_reads) {
+      cpu->Idle();
+    }
+    if (branch && icount <= 0) {
+      break;
+    }
+  }
+}
+
+Jit::Block* Jit::GetBlock(uint32_t pc) {
+  auto& entry = lookup_[(pc >> 1) & (kBlockLookupSize - 1)];
+  if (entry != nullptr && entry->pc == pc) {
+    return entry;
+  }
+
+  auto it = blocks_.find(pc);
+  if (it != blocks_.end()) {
+    entry = &it->second;
+    return entry;
+  }
+
+  if (!cpu->IsCodeAddress(pc)) {
+    return nullptr;
+  }
+
+  entry = Compile(pc);
+  return entry;
+}
+
+void Jit::AddPage(uint32_t addr) {
+  uint32_t page = (addr & 0x1fffffff) >> Cpu::kCodePageShift;
+  for (uint32_t p : pages_) {
+    if (p == page) return;
+  }
+  pages_.push_back(page);
+}
+
+Jit::Block* Jit::Compile(uint32_t pc) {
+  if (emitter_.Left() < kMaxBlockCode) {
+    Flush();
+  }
+
+  auto code = emitter_.Ptr();
+
+  pc_ = pc;
+  cycles_ = 0;
+  block_end_ = false;
+  delay_slot_ = false;
+  pages_.clear();
+  ResetRegs();
+
+  Prologue();
+
+  for (uint32_t i = 0; i < kMaxBlockOps && cpu->IsCodeAddress(pc_); i++) {
+    AddPage(pc_);
+    uint32_t op = cpu->Read16(pc_);
+    cycles_ += (this->*opTable[op])(op);
+    if (block_end_) break;
+    pc_ += 2;
+  }
+
+  // Blocks cut at the op limit or the end of a code region fall through.
+  bool branch = block_end_;
+  if (!branch) {
+    EndBlock(pc_);
+  }
+
+  Block& block = blocks_[pc];
+  block.code = reinterpret_cast<void (*)(Cpu*)>(code);
+  block.pc = pc;
+  block.branch = branch;
+  block.idle = branch && cpu->interpreter->IsIdleLoop(pc, pc_);
+
+  for (uint32_t page : pages_) {
+    page_blocks_[page].push_back(pc);
+    cpu->code_pages[page] = 1;
+  }
+
+  return &block;
+}
+
+int32_t Jit::RegOffset(uint32_t n) {
+  return StateOffset(offsetof(State, r) + n * sizeof(uint32_t));
+}
+
+x64::Reg Jit::Reg(uint32_t n, bool load) {
+  HostReg* victim = nullptr;
+  for (auto& h : host_regs_) {
+    if (h.guest == static_cast<int32_t>(n)) {
+      h.age = ++age_;
+      return h.reg;
+    }
+    if (victim == nullptr || (victim->guest >= 0 &&
+                              (h.guest < 0 || h.age < victim->age))) {
+      victim = &h;
+    }
+  }
+
+  if (victim->guest >= 0 && victim->dirty) {
+    emitter_.Store(kRbx, RegOffset(victim->guest), victim->reg);
+  }
+  victim->guest = n;
+  victim->dirty = false;
+  victim->age = ++age_;
+  if (load) {
+    emitter_.Load(victim->reg, kRbx, RegOffset(n));
+  }
+  return victim->reg;
+}
+
+void Jit::Dirty(uint32_t n) {
+  for (auto& h : host_regs_) {
+    if (h.guest == static_cast<int32_t>(n)) {
+      h.dirty = true;
+    }
+  }
+}
+
+void Jit::FlushRegs() {
+  for (auto& h : host_regs_) {
+    if (h.guest >= 0 && h.dirty) {
+      emitter_.Store(kRbx, RegOffset(h.guest), h.reg);
+      h.dirty = false;
+    }
+  }
+  FlushT();
+}
+
+void Jit::ResetRegs() {
+  for (auto& h : host_regs_) {
+    h.guest = -1;
+    h.dirty = false;
+    h.age = 0;
+  }
+  age_ = 0;
+  t_state_ = kTMem;
+}
+
+void Jit::LoadT() {
+  if (t_state_ == kTMem) {
+    emitter_.Load(kR15, kRbx, StateOffset(offsetof(State, sr)));
+    emitter_.OpImm(kAnd, kR15, 1);
+    t_state_ = kTReg;
+  }
+}
+
+void Jit::SetT(Cond cond) {
+  emitter_.Setcc(cond, kR15);
+  emitter_.Movzx8(kR15, kR15);
+  t_state_ = kTDirty;
+}
+
+void Jit::FlushT() {
+  if (t_state_ == kTDirty) {
+    int32_t sr = StateOffset(offsetof(State, sr));
+    emitter_.Load(kRax, kRbx, sr);
+    emitter_.OpImm(kAnd, kRax, ~1u);
+    emitter_.Op(kOr, kRax, kR15);
+    emitter_.Store(kRbx, sr, kRax);
+    t_state_ = kTReg;
+  }
+}
+
+void Jit::SyncCycles() {
+  if (cycles_ != 0) {
+    emitter_.OpMemImm(kSub, kRbx, icount_offset_, cycles_);
+    cycles_ = 0;
+  }
+}
+
+void Jit::Prologue() {
+  emitter_.Push(kRbx);
+  emitter_.Push(kRbp);
+  emitter_.Push(kR12);
+  emitter_.Push(kR13);
+  emitter_.Push(kR14);
+  emitter_.Push(kR15);
+  emitter_.SubRsp(kShadowSpace + 8);
+  emitter_.Mov64(kRbx, kArg0);
+}
+
+void Jit::Epilogue() {
+  FlushRegs();
+  SyncCycles();
+  emitter_.AddRsp(kShadowSpace + 8);
+  emitter_.Pop(kR15);
+  emitter_.Pop(kR14);
+  emitter_.Pop(kR13);
+  emitter_.Pop(kR12);
+  emitter_.Pop(kRbp);
+  emitter_.Pop(kRbx);
+  emitter_.Ret();
+}
+
+void Jit::EndBlock(uint32_t pc) {
+  emitter_.StoreImm(kRbx, StateOffset(offsetof(State, pc)), pc);
+  Epilogue();
+  block_end_ = true;
+}
+
+void Jit::EndBlockNpc() {
+  emitter_.Load(kRax, kRbx, StateOffset(offsetof(State, npc)));
+  emitter_.Store(kRbx, StateOffset(offsetof(State, pc)), kRax);
+  Epilogue();
+  block_end_ = true;
+}
+
+// Like the interpreter, pc_ keeps pointing at the branch while the slot
+// instruction is compiled.
+uint32_t Jit::DelaySlot() {
+  uint32_t addr = pc_ + 2;
+  AddPage(addr);
+  uint32_t op = cpu->Read16(addr);
+
+  delay_slot_ = true;
+  uint32_t cycles = (opFlags[op] & kBranch) ? Fallback(op)
+                                            : (this->*opTable[op])(op);
+  delay_slot_ = false;
+
+  return cycles;
+}
+
+void Jit::CallRead(int size) {
+  SyncCycles();
+  emitter_.Mov64(kArg0, kRbx);
+  switch (size) {
+    case 1:
+      emitter_.Call(reinterpret_cast<const void*>(&Jit::Read8));
+      break;
+    case 2:
+      emitter_.Call(reinterpret_cast<const void*>(&Jit::Read16));
+      break;
+    default:
+      emitter_.Call(reinterpret_cast<const void*>(&Jit::Read32));
+      break;
+  }
+}
+
+void Jit::CallWrite(int size, uint32_t cycles) {
+  SyncCycles();
+  emitter_.Mov64(kArg0, kRbx);
+  switch (size) {
+    case 1:
+      emitter_.Call(reinterpret_cast<const void*>(&Jit::Write8));
+      break;
+    case 2:
+      emitter_.Call(reinterpret_cast<const void*>(&Jit::Write16));
+      break;
+    default:
+      emitter_.Call(reinterpret_cast<const void*>(&Jit::Write32));
+      break;
+  }
+  ExitIfInvalidated(cycles);
+}
+
+// A store that hit compiled code may have changed the rest of this block, so
+// leave it and let the next lookup recompile from the following instruction.
+void Jit::ExitIfInvalidated(uint32_t cycles) {
+  if (delay_slot_) return;
+
+  emitter_.Test(kRax, kRax);
+  auto label = emitter_.Jcc(kE);
+
+  HostReg regs[kNumHostRegs];
+  std::copy(std::begin(host_regs_), std::end(host_regs_), regs);
+  TState t_state = t_state_;
+  uint32_t pending = cycles_;
+
+  cycles_ += cycles;
+  emitter_.StoreImm(kRbx, StateOffset(offsetof(State, pc)), pc_ + 2);
+  Epilogue();
+
+  std::copy(std::begin(regs), std::end(regs), host_regs_);
+  t_state_ = t_state;
+  cycles_ = pending;
+  emitter_.Bind(label);
+}
+
+void Jit::LoadResult(uint32_t n, int size) {
+  auto rn = Reg(n, false);
+  switch (size) {
+    case 1:
+      emitter_.Movsx8(rn, kRax);
+      break;
+    case 2:
+      emitter_.Movsx16(rn, kRax);
+      break;
+    default:
+      emitter_.Mov(rn, kRax);
+      break;
+  }
+  Dirty(n);
+}
+
+uint32_t Jit::Read8(Cpu* cpu, uint32_t addr) { return cpu->Read8(addr); }
+uint32_t Jit::Read16(Cpu* cpu, uint32_t addr) { return cpu->Read16(addr); }
+uint32_t Jit::Read32(Cpu* cpu, uint32_t addr) { return cpu->Read32(addr); }
+
+uint32_t Jit::Write8(Cpu* cpu, uint32_t addr, uint32_t value) {
+  cpu->jit->invalidated_ = false;
+  cpu->Write8(addr, value);
+  return cpu->jit->invalidated_;
+}
+
+uint32_t Jit::Write16(Cpu* cpu, uint32_t addr, uint32_t value) {
+  cpu->jit->invalidated_ = false;
+  cpu->Write16(addr, value);
+  return cpu->jit->invalidated_;
+}
+
+uint32_t Jit::Write32(Cpu* cpu, uint32_t addr, uint32_t value) {
+  cpu->jit->invalidated_ = false;
+  cpu->Write32(addr, value);
+  return cpu->jit->invalidated_;
+}
+
+void Jit::Interpret(Cpu* cpu, uint32_t code) {
+  cpu->icount -= cpu->interpreter->Execute(code);
+}
+
+uint32_t Jit::Fallback(uint32_t code) {
+  // The handler may touch any register or swap banks.
+  FlushRegs();
+  ResetRegs();
+  SyncCycles();
+
+  emitter_.StoreImm(kRbx, StateOffset(offsetof(State, pc)), pc_);
+  emitter_.Mov64(kArg0, kRbx);
+  emitter_.MovImm(kArg1, code);
+  emitter_.Call(reinterpret_cast<const void*>(&Jit::Interpret));
+
+  return 0;
+}
+
+uint32_t Jit::FallbackBranch(uint32_t code) {
+  emitter_.StoreImm(kRbx, StateOffset(offsetof(State, npc)), pc_ + 2);
+  Fallback(code);
+  EndBlockNpc();
+
+  return 0;
+}
+
+uint32_t Jit::Add(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n);
+  emitter_.Op(kAdd, rn, rm);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Addc(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n);
+  LoadT();
+  emitter_.OpImm(kAdd, kR15, 0xffffffff);
+  emitter_.Op(kAdc, rn, rm);
+  SetT(kB);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Addi(uint32_t code) {
+  uint32_t i = ((code >> 0) & 0xff);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rn = Reg(n);
+  emitter_.OpImm(kAdd, rn, (uint32_t)(int32_t)(int8_t)i);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Addv(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n);
+  emitter_.Op(kAdd, rn, rm);
+  SetT(kO);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::And(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n);
+  emitter_.Op(kAnd, rn, rm);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Andi(uint32_t code) {
+  uint32_t i = ((code >> 0) & 0xff);
+
+  auto r0 = Reg(0);
+  emitter_.OpImm(kAnd, r0, i);
+  Dirty(0);
+
+  return 1;
+}
+
+uint32_t Jit::Bf(uint32_t code) {
+  uint32_t d = ((code >> 0) & 0xff);
+
+  LoadT();
+  emitter_.MovImm(kRax, pc_ + 2);
+  emitter_.MovImm(kRcx, pc_ + (((int32_t)(int8_t)d) << 1) + 4);
+  emitter_.Test(kR15, kR15);
+  emitter_.Cmov(kE, kRax, kRcx);
+  emitter_.Store(kRbx, StateOffset(offsetof(State, pc)), kRax);
+
+  cycles_ += 2;
+  Epilogue();
+  block_end_ = true;
+
+  return 0;
+}
+
+uint32_t Jit::Bfs(uint32_t code) {
+  uint32_t d = ((code >> 0) & 0xff);
+
+  LoadT();
+  emitter_.MovImm(kRax, pc_ + 4);
+  emitter_.MovImm(kRcx, pc_ + (((int32_t)(int8_t)d) << 1) + 4);
+  emitter_.Test(kR15, kR15);
+  emitter_.Cmov(kE, kRax, kRcx);
+  emitter_.Store(kRbx, StateOffset(offsetof(State, npc)), kRax);
+
+  uint32_t cycles = DelaySlot();
+  cycles_ += 2 + cycles;
+  EndBlockNpc();
+
+  return 0;
+}
+
+uint32_t Jit::Bra(uint32_t code) {
+  uint32_t d = ((int32_t)(code << 20) >> 20);
+
+  emitter_.StoreImm(kRbx, StateOffset(offsetof(State, npc)),
+                    pc_ + (d << 1) + 4);
+
+  uint32_t cycles = DelaySlot();
+  cycles_ += 2 + cycles;
+  EndBlockNpc();
+
+  return 0;
+}
+
+uint32_t Jit::Braf(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rn = Reg(n);
+  emitter_.Mov(kRax, rn);
+  emitter_.OpImm(kAdd, kRax, pc_ + 4);
+  emitter_.Store(kRbx, StateOffset(offsetof(State, npc)), kRax);
+
+  uint32_t cycles = DelaySlot();
+  cycles_ += 2 + cycles;
+  EndBlockNpc();
+
+  return 0;
+}
+
+uint32_t Jit::Bsr(uint32_t code) {
+  uint32_t d = ((int32_t)(code << 20) >> 20);
+
+  emitter_.StoreImm(kRbx, StateOffset(offsetof(State, pr)), pc_ + 4);
+  emitter_.StoreImm(kRbx, StateOffset(offsetof(State, npc)),
+                    pc_ + (d << 1) + 4);
+
+  uint32_t cycles = DelaySlot();
+  cycles_ += 2 + cycles;
+  EndBlockNpc();
+
+  return 0;
+}
+
+uint32_t Jit::Bsrf(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rn = Reg(n);
+  emitter_.StoreImm(kRbx, StateOffset(offsetof(State, pr)), pc_ + 4);
+  emitter_.Mov(kRax, rn);
+  emitter_.OpImm(kAdd, kRax, pc_ + 4);
+  emitter_.Store(kRbx, StateOffset(offsetof(State, npc)), kRax);
+
+  uint32_t cycles = DelaySlot();
+  cycles_ += 2 + cycles;
+  EndBlockNpc();
+
+  return 0;
+}
+
+uint32_t Jit::Bt(uint32_t code) {
+  uint32_t d = ((code >> 0) & 0xff);
+
+  LoadT();
+  emitter_.MovImm(kRax, pc_ + 2);
+  emitter_.MovImm(kRcx, pc_ + (((int32_t)(int8_t)d) << 1) + 4);
+  emitter_.Test(kR15, kR15);
+  emitter_.Cmov(kNe, kRax, kRcx);
+  emitter_.Store(kRbx, StateOffset(offsetof(State, pc)), kRax);
+
+  cycles_ += 2;
+  Epilogue();
+  block_end_ = true;
+
+  return 0;
+}
+
+uint32_t Jit::Bts(uint32_t code) {
+  uint32_t d = ((code >> 0) & 0xff);
+
+  LoadT();
+  emitter_.MovImm(kRax, pc_ + 4);
+  emitter_.MovImm(kRcx, pc_ + (((int32_t)(int8_t)d) << 1) + 4);
+  emitter_.Test(kR15, kR15);
+  emitter_.Cmov(kNe, kRax, kRcx);
+  emitter_.Store(kRbx, StateOffset(offsetof(State, npc)), kRax);
+
+  uint32_t cycles = DelaySlot();
+  cycles_ += 2 + cycles;
+  EndBlockNpc();
+
+  return 0;
+}
+
+uint32_t Jit::Clrt(uint32_t code) {
+  emitter_.MovImm(kR15, 0);
+  t_state_ = kTDirty;
+
+  return 1;
+}
+
+uint32_t Jit::Cmpeq(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n);
+  emitter_.Op(kCmp, rn, rm);
+  SetT(kE);
+
+  return 1;
+}
+
+uint32_t Jit::Cmpge(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n);
+  emitter_.Op(kCmp, rn, rm);
+  SetT(kGe);
+
+  return 1;
+}
+
+uint32_t Jit::Cmpgt(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n);
+  emitter_.Op(kCmp, rn, rm);
+  SetT(kG);
+
+  return 1;
+}
+
+uint32_t Jit::Cmphi(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n);
+  emitter_.Op(kCmp, rn, rm);
+  SetT(kA);
+
+  return 1;
+}
+
+uint32_t Jit::Cmphs(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n);
+  emitter_.Op(kCmp, rn, rm);
+  SetT(kAe);
+
+  return 1;
+}
+
+uint32_t Jit::Cmpim(uint32_t code) {
+  uint32_t i = ((code >> 0) & 0xff);
+
+  auto r0 = Reg(0);
+  emitter_.OpImm(kCmp, r0, (uint32_t)(int32_t)(int8_t)i);
+  SetT(kE);
+
+  return 1;
+}
+
+uint32_t Jit::Cmppl(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rn = Reg(n);
+  emitter_.Test(rn, rn);
+  SetT(kG);
+
+  return 1;
+}
+
+uint32_t Jit::Cmppz(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rn = Reg(n);
+  emitter_.Test(rn, rn);
+  SetT(kNs);
+
+  return 1;
+}
+
+uint32_t Jit::Dt(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rn = Reg(n);
+  emitter_.OpImm(kSub, rn, 1);
+  SetT(kE);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Extsb(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n, false);
+  emitter_.Movsx8(rn, rm);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Extsw(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n, false);
+  emitter_.Movsx16(rn, rm);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Extub(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n, false);
+  emitter_.Movzx8(rn, rm);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Extuw(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n, false);
+  emitter_.Movzx16(rn, rm);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Jmp(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rn = Reg(n);
+  emitter_.Store(kRbx, StateOffset(offsetof(State, npc)), rn);
+
+  uint32_t cycles = DelaySlot();
+  cycles_ += 2 + cycles;
+  EndBlockNpc();
+
+  return 0;
+}
+
+uint32_t Jit::Jsr(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rn = Reg(n);
+  emitter_.StoreImm(kRbx, StateOffset(offsetof(State, pr)), pc_ + 4);
+  emitter_.Store(kRbx, StateOffset(offsetof(State, npc)), rn);
+
+  uint32_t cycles = DelaySlot();
+  cycles_ += 2 + cycles;
+  EndBlockNpc();
+
+  return 0;
+}
+
+uint32_t Jit::Ldcgbr(uint32_t code) {
+  uint32_t m = ((code >> 8) & 0x0f);
+
+  emitter_.Store(kRbx, StateOffset(offsetof(State, gbr)), Reg(m));
+
+  return 2;
+}
+
+uint32_t Jit::Ldsmach(uint32_t code) {
+  uint32_t m = ((code >> 8) & 0x0f);
+
+  emitter_.Store(kRbx, StateOffset(offsetof(State, mach)), Reg(m));
+
+  return 1;
+}
+
+uint32_t Jit::Ldsmacl(uint32_t code) {
+  uint32_t m = ((code >> 8) & 0x0f);
+
+  emitter_.Store(kRbx, StateOffset(offsetof(State, macl)), Reg(m));
+
+  return 2;
+}
+
+uint32_t Jit::Ldsmpr(uint32_t code) {
+  uint32_t m = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(m));
+  CallRead(4);
+  emitter_.OpImm(kAdd, Reg(m), 4);
+  Dirty(m);
+  emitter_.Store(kRbx, StateOffset(offsetof(State, pr)), kRax);
+
+  return 2;
+}
+
+uint32_t Jit::Ldspr(uint32_t code) {
+  uint32_t m = ((code >> 8) & 0x0f);
+
+  emitter_.Store(kRbx, StateOffset(offsetof(State, pr)), Reg(m));
+
+  return 2;
+}
+
+uint32_t Jit::Mov(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n, false);
+  emitter_.Mov(rn, rm);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Mova(uint32_t code) {
+  uint32_t d = ((code >> 0) & 0xff);
+
+  auto r0 = Reg(0, false);
+  emitter_.MovImm(r0, (pc_ & 0xfffffffc) + (d << 2) + 4);
+  Dirty(0);
+
+  return 1;
+}
+
+uint32_t Jit::Movbl(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(m));
+  CallRead(1);
+  LoadResult(n, 1);
+
+  return 1;
+}
+
+uint32_t Jit::Movbl0(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(m));
+  emitter_.Op(kAdd, kArg1, Reg(0));
+  CallRead(1);
+  LoadResult(n, 1);
+
+  return 1;
+}
+
+uint32_t Jit::Movbl4(uint32_t code) {
+  uint32_t d = ((code >> 0) & 0x0f);
+  uint32_t m = ((code >> 4) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(m));
+  emitter_.OpImm(kAdd, kArg1, d);
+  CallRead(1);
+  LoadResult(0, 1);
+
+  return 1;
+}
+
+uint32_t Jit::Movblg(uint32_t code) {
+  uint32_t d = ((code >> 0) & 0xff);
+
+  emitter_.Load(kArg1, kRbx, StateOffset(offsetof(State, gbr)));
+  emitter_.OpImm(kAdd, kArg1, d);
+  CallRead(1);
+  LoadResult(0, 1);
+
+  return 1;
+}
+
+uint32_t Jit::Movbm(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(n));
+  emitter_.OpImm(kSub, kArg1, 1);
+  emitter_.Mov(kArg2, Reg(m));
+  emitter_.OpImm(kSub, Reg(n), 1);
+  Dirty(n);
+  CallWrite(1);
+
+  return 1;
+}
+
+uint32_t Jit::Movbp(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(m));
+  CallRead(1);
+  if (n != m) {
+    emitter_.OpImm(kAdd, Reg(m), 1);
+    Dirty(m);
+  }
+  LoadResult(n, 1);
+
+  return 1;
+}
+
+uint32_t Jit::Movbs(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(n));
+  emitter_.Mov(kArg2, Reg(m));
+  CallWrite(1);
+
+  return 1;
+}
+
+uint32_t Jit::Movbs0(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(n));
+  emitter_.Op(kAdd, kArg1, Reg(0));
+  emitter_.Mov(kArg2, Reg(m));
+  CallWrite(1);
+
+  return 1;
+}
+
+uint32_t Jit::Movbs4(uint32_t code) {
+  uint32_t d = ((code >> 0) & 0x0f);
+  uint32_t n = ((code >> 4) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(n));
+  emitter_.OpImm(kAdd, kArg1, d);
+  emitter_.Mov(kArg2, Reg(0));
+  CallWrite(1);
+
+  return 1;
+}
+
+uint32_t Jit::Movbsg(uint32_t code) {
+  uint32_t d = ((code >> 0) & 0xff);
+
+  emitter_.Load(kArg1, kRbx, StateOffset(offsetof(State, gbr)));
+  emitter_.OpImm(kAdd, kArg1, d);
+  emitter_.Mov(kArg2, Reg(0));
+  CallWrite(1);
+
+  return 1;
+}
+
+uint32_t Jit::Movi(uint32_t code) {
+  uint32_t i = ((code >> 0) & 0xff);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rn = Reg(n, false);
+  emitter_.MovImm(rn, (uint32_t)(int32_t)(int8_t)i);
+  Dirty(n);
+
+  return 1;
+}
+
+// PC relative loads from BIOS or RAM are folded into constants, the page
+// holding the literal is tracked like code so a write recompiles the block.
+uint32_t Jit::Movli(uint32_t code) {
+  uint32_t d = ((code >> 0) & 0xff);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  uint32_t addr = (pc_ & 0xfffffffc) + (d << 2) + 4;
+  if (cpu->IsCodeAddress(addr)) {
+    AddPage(addr);
+    auto rn = Reg(n, false);
+    emitter_.MovImm(rn, cpu->Read32(addr));
+    Dirty(n);
+  } else {
+    emitter_.MovImm(kArg1, addr);
+    CallRead(4);
+    LoadResult(n, 4);
+  }
+
+  return 1;
+}
+
+uint32_t Jit::Movll(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(m));
+  CallRead(4);
+  LoadResult(n, 4);
+
+  return 1;
+}
+
+uint32_t Jit::Movll0(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(m));
+  emitter_.Op(kAdd, kArg1, Reg(0));
+  CallRead(4);
+  LoadResult(n, 4);
+
+  return 1;
+}
+
+uint32_t Jit::Movll4(uint32_t code) {
+  uint32_t d = ((code >> 0) & 0x0f);
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(m));
+  emitter_.OpImm(kAdd, kArg1, d << 2);
+  CallRead(4);
+  LoadResult(n, 4);
+
+  return 1;
+}
+
+uint32_t Jit::Movllg(uint32_t code) {
+  uint32_t d = ((code >> 0) & 0xff);
+
+  emitter_.Load(kArg1, kRbx, StateOffset(offsetof(State, gbr)));
+  emitter_.OpImm(kAdd, kArg1, d << 2);
+  CallRead(4);
+  LoadResult(0, 4);
+
+  return 1;
+}
+
+uint32_t Jit::Movlm(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(n));
+  emitter_.OpImm(kSub, kArg1, 4);
+  emitter_.Mov(kArg2, Reg(m));
+  emitter_.OpImm(kSub, Reg(n), 4);
+  Dirty(n);
+  CallWrite(4);
+
+  return 1;
+}
+
+uint32_t Jit::Movlp(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(m));
+  CallRead(4);
+  if (n != m) {
+    emitter_.OpImm(kAdd, Reg(m), 4);
+    Dirty(m);
+  }
+  LoadResult(n, 4);
+
+  return 1;
+}
+
+uint32_t Jit::Movls(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(n));
+  emitter_.Mov(kArg2, Reg(m));
+  CallWrite(4);
+
+  return 1;
+}
+
+uint32_t Jit::Movls0(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(n));
+  emitter_.Op(kAdd, kArg1, Reg(0));
+  emitter_.Mov(kArg2, Reg(m));
+  CallWrite(4);
+
+  return 1;
+}
+
+uint32_t Jit::Movls4(uint32_t code) {
+  uint32_t d = ((code >> 0) & 0x0f);
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(n));
+  emitter_.OpImm(kAdd, kArg1, d << 2);
+  emitter_.Mov(kArg2, Reg(m));
+  CallWrite(4);
+
+  return 1;
+}
+
+uint32_t Jit::Movlsg(uint32_t code) {
+  uint32_t d = ((code >> 0) & 0xff);
+
+  emitter_.Load(kArg1, kRbx, StateOffset(offsetof(State, gbr)));
+  emitter_.OpImm(kAdd, kArg1, d << 2);
+  emitter_.Mov(kArg2, Reg(0));
+  CallWrite(4);
+
+  return 1;
+}
+
+uint32_t Jit::Movt(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  LoadT();
+  auto rn = Reg(n, false);
+  emitter_.Mov(rn, kR15);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Movwi(uint32_t code) {
+  uint32_t d = ((code >> 0) & 0xff);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  uint32_t addr = pc_ + (d << 1) + 4;
+  if (cpu->IsCodeAddress(addr)) {
+    AddPage(addr);
+    auto rn = Reg(n, false);
+    emitter_.MovImm(rn, (uint32_t)(int32_t)(int16_t)cpu->Read16(addr));
+    Dirty(n);
+  } else {
+    emitter_.MovImm(kArg1, addr);
+    CallRead(2);
+    LoadResult(n, 2);
+  }
+
+  return 1;
+}
+
+uint32_t Jit::Movwl(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(m));
+  CallRead(2);
+  LoadResult(n, 2);
+
+  return 1;
+}
+
+uint32_t Jit::Movwl0(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(m));
+  emitter_.Op(kAdd, kArg1, Reg(0));
+  CallRead(2);
+  LoadResult(n, 2);
+
+  return 1;
+}
+
+uint32_t Jit::Movwl4(uint32_t code) {
+  uint32_t d = ((code >> 0) & 0x0f);
+  uint32_t m = ((code >> 4) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(m));
+  emitter_.OpImm(kAdd, kArg1, d << 1);
+  CallRead(2);
+  LoadResult(0, 2);
+
+  return 1;
+}
+
+uint32_t Jit::Movwlg(uint32_t code) {
+  uint32_t d = ((code >> 0) & 0xff);
+
+  emitter_.Load(kArg1, kRbx, StateOffset(offsetof(State, gbr)));
+  emitter_.OpImm(kAdd, kArg1, d << 1);
+  CallRead(2);
+  LoadResult(0, 2);
+
+  return 1;
+}
+
+uint32_t Jit::Movwm(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(n));
+  emitter_.OpImm(kSub, kArg1, 2);
+  emitter_.Mov(kArg2, Reg(m));
+  emitter_.OpImm(kSub, Reg(n), 2);
+  Dirty(n);
+  CallWrite(2);
+
+  return 1;
+}
+
+uint32_t Jit::Movwp(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(m));
+  CallRead(2);
+  if (n != m) {
+    emitter_.OpImm(kAdd, Reg(m), 2);
+    Dirty(m);
+  }
+  LoadResult(n, 2);
+
+  return 1;
+}
+
+uint32_t Jit::Movws(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(n));
+  emitter_.Mov(kArg2, Reg(m));
+  CallWrite(2);
+
+  return 1;
+}
+
+uint32_t Jit::Movws0(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(n));
+  emitter_.Op(kAdd, kArg1, Reg(0));
+  emitter_.Mov(kArg2, Reg(m));
+  CallWrite(2);
+
+  return 1;
+}
+
+uint32_t Jit::Movws4(uint32_t code) {
+  uint32_t d = ((code >> 0) & 0x0f);
+  uint32_t n = ((code >> 4) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(n));
+  emitter_.OpImm(kAdd, kArg1, d << 1);
+  emitter_.Mov(kArg2, Reg(0));
+  CallWrite(2);
+
+  return 1;
+}
+
+uint32_t Jit::Movwsg(uint32_t code) {
+  uint32_t d = ((code >> 0) & 0xff);
+
+  emitter_.Load(kArg1, kRbx, StateOffset(offsetof(State, gbr)));
+  emitter_.OpImm(kAdd, kArg1, d << 1);
+  emitter_.Mov(kArg2, Reg(0));
+  CallWrite(2);
+
+  return 1;
+}
+
+uint32_t Jit::Mull(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n);
+  emitter_.Mov(kRax, rn);
+  emitter_.Imul(kRax, rm);
+  emitter_.Store(kRbx, StateOffset(offsetof(State, macl)), kRax);
+
+  return 5;
+}
+
+uint32_t Jit::Mulsu(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n);
+  emitter_.Movzx16(kRax, rn);
+  emitter_.Movzx16(kRcx, rm);
+  emitter_.Imul(kRax, kRcx);
+  emitter_.Store(kRbx, StateOffset(offsetof(State, macl)), kRax);
+
+  return 5;
+}
+
+uint32_t Jit::Mulsw(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n);
+  emitter_.Movsx16(kRax, rn);
+  emitter_.Movsx16(kRcx, rm);
+  emitter_.Imul(kRax, kRcx);
+  emitter_.Store(kRbx, StateOffset(offsetof(State, macl)), kRax);
+
+  return 5;
+}
+
+uint32_t Jit::Neg(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n, false);
+  emitter_.Mov(rn, rm);
+  emitter_.Neg(rn);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Nop(uint32_t code) { return 1; }
+
+uint32_t Jit::Not(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n, false);
+  emitter_.Mov(rn, rm);
+  emitter_.Not(rn);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Or(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n);
+  emitter_.Op(kOr, rn, rm);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Ori(uint32_t code) {
+  uint32_t i = ((code >> 0) & 0xff);
+
+  auto r0 = Reg(0);
+  emitter_.OpImm(kOr, r0, i);
+  Dirty(0);
+
+  return 1;
+}
+
+uint32_t Jit::Rotcl(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rn = Reg(n);
+  LoadT();
+  emitter_.OpImm(kAdd, kR15, 0xffffffff);
+  emitter_.Sh(kRcl, rn, 1);
+  SetT(kB);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Rotcr(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rn = Reg(n);
+  LoadT();
+  emitter_.OpImm(kAdd, kR15, 0xffffffff);
+  emitter_.Sh(kRcr, rn, 1);
+  SetT(kB);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Rotl(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rn = Reg(n);
+  emitter_.Sh(kRol, rn, 1);
+  SetT(kB);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Rotr(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rn = Reg(n);
+  emitter_.Sh(kRor, rn, 1);
+  SetT(kB);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Rts(uint32_t code) {
+  emitter_.Load(kRax, kRbx, StateOffset(offsetof(State, pr)));
+  emitter_.Store(kRbx, StateOffset(offsetof(State, npc)), kRax);
+
+  uint32_t cycles = DelaySlot();
+  cycles_ += 1 + cycles;
+  EndBlockNpc();
+
+  return 0;
+}
+
+uint32_t Jit::Sett(uint32_t code) {
+  emitter_.MovImm(kR15, 1);
+  t_state_ = kTDirty;
+
+  return 1;
+}
+
+uint32_t Jit::Shal(uint32_t code) { return Shll(code); }
+
+uint32_t Jit::Shar(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rn = Reg(n);
+  emitter_.Sh(kSar, rn, 1);
+  SetT(kB);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Shll(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rn = Reg(n);
+  emitter_.Sh(kShl, rn, 1);
+  SetT(kB);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Shll16(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Sh(kShl, Reg(n), 16);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Shll2(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Sh(kShl, Reg(n), 2);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Shll8(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Sh(kShl, Reg(n), 8);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Shlr(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rn = Reg(n);
+  emitter_.Sh(kShr, rn, 1);
+  SetT(kB);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Shlr16(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Sh(kShr, Reg(n), 16);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Shlr2(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Sh(kShr, Reg(n), 2);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Shlr8(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Sh(kShr, Reg(n), 8);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Stcgbr(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Load(Reg(n, false), kRbx, StateOffset(offsetof(State, gbr)));
+  Dirty(n);
+
+  return 2;
+}
+
+uint32_t Jit::Stsmach(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Load(Reg(n, false), kRbx, StateOffset(offsetof(State, mach)));
+  Dirty(n);
+
+  return 2;
+}
+
+uint32_t Jit::Stsmacl(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Load(Reg(n, false), kRbx, StateOffset(offsetof(State, macl)));
+  Dirty(n);
+
+  return 2;
+}
+
+uint32_t Jit::Stsmpr(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Mov(kArg1, Reg(n));
+  emitter_.OpImm(kSub, kArg1, 4);
+  emitter_.Load(kArg2, kRbx, StateOffset(offsetof(State, pr)));
+  emitter_.OpImm(kSub, Reg(n), 4);
+  Dirty(n);
+  CallWrite(4, 2);
+
+  return 2;
+}
+
+uint32_t Jit::Stspr(uint32_t code) {
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  emitter_.Load(Reg(n, false), kRbx, StateOffset(offsetof(State, pr)));
+  Dirty(n);
+
+  return 2;
+}
+
+uint32_t Jit::Sub(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n);
+  emitter_.Op(kSub, rn, rm);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Swapb(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n, false);
+  emitter_.Mov(rn, rm);
+  emitter_.Rol16(rn, 8);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Swapw(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n, false);
+  emitter_.Mov(rn, rm);
+  emitter_.Sh(kRol, rn, 16);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Tst(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n);
+  emitter_.Test(rn, rm);
+  SetT(kE);
+
+  return 1;
+}
+
+uint32_t Jit::Tsti(uint32_t code) {
+  uint32_t i = ((code >> 0) & 0xff);
+
+  emitter_.TestImm(Reg(0), i);
+  SetT(kE);
+
+  return 1;
+}
+
+uint32_t Jit::Xor(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n);
+  emitter_.Op(kXor, rn, rm);
+  Dirty(n);
+
+  return 1;
+}
+
+uint32_t Jit::Xori(uint32_t code) {
+  uint32_t i = ((code >> 0) & 0xff);
+
+  auto r0 = Reg(0);
+  emitter_.OpImm(kXor, r0, i);
+  Dirty(0);
+
+  return 1;
+}
+
+uint32_t Jit::Xtrct(uint32_t code) {
+  uint32_t m = ((code >> 4) & 0x0f);
+  uint32_t n = ((code >> 8) & 0x0f);
+
+  auto rm = Reg(m);
+  auto rn = Reg(n);
+  emitter_.Mov(kRax, rm);
+  emitter_.Sh(kShl, kRax, 16);
+  emitter_.Sh(kShr, rn, 16);
+  emitter_.Op(kOr, rn, kRax);
+  Dirty(n);
+
+  return 1;
+}
+
+}  // namespace sh3
@@ -0,0 +1,351 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "x64_emitter.h"
+
+namespace sh3 {
+class Cpu;
+class Jit {
+ public:
+  Jit(Cpu *c);
+  ~Jit();
+
+  bool Init();
+  void Run(int32_t &icount);
+  void Flush();
+  void Invalidate(uint32_t addr);
+
+  static bool IsSupported();
+
+ private:
+  const static size_t kCodeSize = 32 * 1024 * 1024;
+  const static size_t kMaxBlockCode = 64 * 1024;
+  const static uint32_t kMaxBlockOps = 64;
+  const static uint32_t kBlockLookupSize = 0x1000;
+  const static int kNumHostRegs = 4;
+
+  enum OpFlags : uint8_t {
+    kNone = 0,
+    kBranch = 1,
+  };
+
+  struct Block {
+    void (*code)(Cpu *cpu);
+    uint32_t pc;
+    bool branch;
+    bool idle;
+  };
+
+  struct HostReg {
+    x64::Reg reg;
+    int32_t guest;
+    bool dirty;
+    uint32_t age;
+  };
+
+  enum TState { kTMem, kTReg, kTDirty };
+
+  Cpu *cpu;
+
+  uint8_t *code_;
+  x64::Emitter emitter_;
+
+  std::unordered_map<uint32_t, Block> blocks_;
+  std::unordered_map<uint32_t, std::vector<uint32_t>> page_blocks_;
+  std::array<Block *, kBlockLookupSize> lookup_;
+
+  int32_t state_offset_;
+  int32_t icount_offset_;
+
+  bool invalidated_;
+
+  uint32_t pc_;
+  uint32_t cycles_;
+  bool block_end_;
+  bool delay_slot_;
+  std::vector<uint32_t> pages_;
+
+  HostReg host_regs_[kNumHostRegs];
+  uint32_t age_;
+  TState t_state_;
+
+  Block *GetBlock(uint32_t pc);
+  Block *Compile(uint32_t pc);
+  void AddPage(uint32_t addr);
+
+  int32_t StateOffset(size_t offset) {
+    return state_offset_ + static_cast<int32_t>(offset);
+  }
+  int32_t RegOffset(uint32_t n);
+
+  x64::Reg Reg(uint32_t n, bool load = true);
+  void Dirty(uint32_t n);
+  void FlushRegs();
+  void ResetRegs();
+
+  void LoadT();
+  void SetT(x64::Cond cond);
+  void FlushT();
+
+  void SyncCycles();
+  void Prologue();
+  void Epilogue();
+  void EndBlock(uint32_t pc);
+  void EndBlockNpc();
+  void ExitIfInvalidated(uint32_t cycles);
+  uint32_t DelaySlot();
+
+  void CallRead(int size);
+  void CallWrite(int size, uint32_t cycles = 1);
+  void LoadResult(uint32_t n, int size);
+
+  static uint32_t Read8(Cpu *cpu, uint32_t addr);
+  static uint32_t Read16(Cpu *cpu, uint32_t addr);
+  static uint32_t Read32(Cpu *cpu, uint32_t addr);
+  static uint32_t Write8(Cpu *cpu, uint32_t addr, uint32_t value);
+  static uint32_t Write16(Cpu *cpu, uint32_t addr, uint32_t value);
+  static uint32_t Write32(Cpu *cpu, uint32_t addr, uint32_t value);
+  static void Interpret(Cpu *cpu, uint32_t code);
+
+  uint32_t Fallback(uint32_t code);
+  uint32_t FallbackBranch(uint32_t code);
+
+  uint32_t Add(uint32_t code);
+  uint32_t Addc(uint32_t code);
+  uint32_t Addi(uint32_t code);
+  uint32_t Addv(uint32_t code);
+  uint32_t And(uint32_t code);
+  uint32_t Andi(uint32_t code);
+  uint32_t Bf(uint32_t code);
+  uint32_t Bfs(uint32_t code);
+  uint32_t Bra(uint32_t code);
+  uint32_t Braf(uint32_t code);
+  uint32_t Bsr(uint32_t code);
+  uint32_t Bsrf(uint32_t code);
+  uint32_t Bt(uint32_t code);
+  uint32_t Bts(uint32_t code);
+  uint32_t Clrt(uint32_t code);
+  uint32_t Cmpeq(uint32_t code);
+  uint32_t Cmpge(uint32_t code);
+  uint32_t Cmpgt(uint32_t code);
+  uint32_t Cmphi(uint32_t code);
+  uint32_t Cmphs(uint32_t code);
+  uint32_t Cmpim(uint32_t code);
+  uint32_t Cmppl(uint32_t code);
+  uint32_t Cmppz(uint32_t code);
+  uint32_t Dt(uint32_t code);
+  uint32_t Extsb(uint32_t code);
+  uint32_t Extsw(uint32_t code);
+  uint32_t Extub(uint32_t code);
+  uint32_t Extuw(uint32_t code);
+  uint32_t Jmp(uint32_t code);
+  uint32_t Jsr(uint32_t code);
+  uint32_t Ldcgbr(uint32_t code);
+  uint32_t Ldsmach(uint32_t code);
+  uint32_t Ldsmacl(uint32_t code);
+  uint32_t Ldsmpr(uint32_t code);
+  uint32_t Ldspr(uint32_t code);
+  uint32_t Mov(uint32_t code);
+  uint32_t Mova(uint32_t code);
+  uint32_t Movbl(uint32_t code);
+  uint32_t Movbl0(uint32_t code);
+  uint32_t Movbl4(uint32_t code);
+  uint32_t Movblg(uint32_t code);
+  uint32_t Movbm(uint32_t code);
+  uint32_t Movbp(uint32_t code);
+  uint32_t Movbs(uint32_t code);
+  uint32_t Movbs0(uint32_t code);
+  uint32_t Movbs4(uint32_t code);
+  uint32_t Movbsg(uint32_t code);
+  uint32_t Movi(uint32_t code);
+  uint32_t Movli(uint32_t code);
+  uint32_t Movll(uint32_t code);
+  uint32_t Movll0(uint32_t code);
+  uint32_t Movll4(uint32_t code);
+  uint32_t Movllg(uint32_t code);
+  uint32_t Movlm(uint32_t code);
+  uint32_t Movlp(uint32_t code);
+  uint32_t Movls(uint32_t code);
+  uint32_t Movls0(uint32_t code);
+  uint32_t Movls4(uint32_t code);
+  uint32_t Movlsg(uint32_t code);
+  uint32_t Movt(uint32_t code);
+  uint32_t Movwi(uint32_t code);
+  uint32_t Movwl(uint32_t code);
+  uint32_t Movwl0(uint32_t code);
+  uint32_t Movwl4(uint32_t code);
+  uint32_t Movwlg(uint32_t code);
+  uint32_t Movwm(uint32_t code);
+  uint32_t Movwp(uint32_t code);
+  uint32_t Movws(uint32_t code);
+  uint32_t Movws0(uint32_t code);
+  uint32_t Movws4(uint32_t code);
+  uint32_t Movwsg(uint32_t code);
+  uint32_t Mull(uint32_t code);
+  uint32_t Mulsu(uint32_t code);
+  uint32_t Mulsw(uint32_t code);
+  uint32_t Neg(uint32_t code);
+  uint32_t Nop(uint32_t code);
+  uint32_t Not(uint32_t code);
+  uint32_t Or(uint32_t code);
+  uint32_t Ori(uint32_t code);
+  uint32_t Rotcl(uint32_t code);
+  uint32_t Rotcr(uint32_t code);
+  uint32_t Rotl(uint32_t code);
+  uint32_t Rotr(uint32_t code);
+  uint32_t Rts(uint32_t code);
+  uint32_t Sett(uint32_t code);
+  uint32_t Shal(uint32_t code);
+  uint32_t Shar(uint32_t code);
+  uint32_t Shll(uint32_t code);
+  uint32_t Shll16(uint32_t code);
+  uint32_t Shll2(uint32_t code);
+  uint32_t Shll8(uint32_t code);
+  uint32_t Shlr(uint32_t code);
+  uint32_t Shlr16(uint32_t code);
+  uint32_t Shlr2(uint32_t code);
+  uint32_t Shlr8(uint32_t code);
+  uint32_t Stcgbr(uint32_t code);
+  uint32_t Stsmach(uint32_t code);
+  uint32_t Stsmacl(uint32_t code);
+  uint32_t Stsmpr(uint32_t code);
+  uint32_t Stspr(uint32_t code);
+  uint32_t Sub(uint32_t code);
+  uint32_t Swapb(uint32_t code);
+  uint32_t Swapw(uint32_t code);
+  uint32_t Tst(uint32_t code);
+  uint32_t Tsti(uint32_t code);
+  uint32_t Xor(uint32_t code);
+  uint32_t Xori(uint32_t code);
+  uint32_t Xtrct(uint32_t code);
+
+  uint32_t (Jit::*opTable[0x00010000])(uint32_t code);
+  uint8_t opFlags[0x00010000];
+
+  struct OpTemplate {
+    uint32_t opcode;
+    uint32_t mask;
+    uint32_t (Jit::*op)(uint32_t code);
+    uint8_t flags;
+  };
+
+  // Opcodes missing from this table are executed through the interpreter.
+  constexpr static OpTemplate opTemplate[] = {
+      {0x300c, 0xf00f, &Jit::Add, kNone},
+      {0x300e, 0xf00f, &Jit::Addc, kNone},
+      {0x7000, 0xf000, &Jit::Addi, kNone},
+      {0x300f, 0xf00f, &Jit::Addv, kNone},
+      {0x2009, 0xf00f, &Jit::And, kNone},
+      {0xc900, 0xff00, &Jit::Andi, kNone},
+      {0x8b00, 0xff00, &Jit::Bf, kBranch},
+      {0x8f00, 0xff00, &Jit::Bfs, kBranch},
+      {0xa000, 0xf000, &Jit::Bra, kBranch},
+      {0x0023, 0xf0ff, &Jit::Braf, kBranch},
+      {0xb000, 0xf000, &Jit::Bsr, kBranch},
+      {0x0003, 0xf0ff, &Jit::Bsrf, kBranch},
+      {0x8900, 0xff00, &Jit::Bt, kBranch},
+      {0x8d00, 0xff00, &Jit::Bts, kBranch},
+      {0x0008, 0xffff, &Jit::Clrt, kNone},
+      {0x3000, 0xf00f, &Jit::Cmpeq, kNone},
+      {0x3003, 0xf00f, &Jit::Cmpge, kNone},
+      {0x3007, 0xf00f, &Jit::Cmpgt, kNone},
+      {0x3006, 0xf00f, &Jit::Cmphi, kNone},
+      {0x3002, 0xf00f, &Jit::Cmphs, kNone},
+      {0x8800, 0xff00, &Jit::Cmpim, kNone},
+      {0x4015, 0xf0ff, &Jit::Cmppl, kNone},
+      {0x4011, 0xf0ff, &Jit::Cmppz, kNone},
+      {0x4010, 0xf0ff, &Jit::Dt, kNone},
+      {0x600e, 0xf00f, &Jit::Extsb, kNone},
+      {0x600f, 0xf00f, &Jit::Extsw, kNone},
+      {0x600c, 0xf00f, &Jit::Extub, kNone},
+      {0x600d, 0xf00f, &Jit::Extuw, kNone},
+      {0x402b, 0xf0ff, &Jit::Jmp, kBranch},
+      {0x400b, 0xf0ff, &Jit::Jsr, kBranch},
+      {0x401e, 0xf0ff, &Jit::Ldcgbr, kNone},
+      {0x400a, 0xf0ff, &Jit::Ldsmach, kNone},
+      {0x401a, 0xf0ff, &Jit::Ldsmacl, kNone},
+      {0x4026, 0xf0ff, &Jit::Ldsmpr, kNone},
+      {0x402a, 0xf0ff, &Jit::Ldspr, kNone},
+      {0x6003, 0xf00f, &Jit::Mov, kNone},
+      {0xc700, 0xff00, &Jit::Mova, kNone},
+      {0x6000, 0xf00f, &Jit::Movbl, kNone},
+      {0x000c, 0xf00f, &Jit::Movbl0, kNone},
+      {0x8400, 0xff00, &Jit::Movbl4, kNone},
+      {0xc400, 0xff00, &Jit::Movblg, kNone},
+      {0x2004, 0xf00f, &Jit::Movbm, kNone},
+      {0x6004, 0xf00f, &Jit::Movbp, kNone},
+      {0x2000, 0xf00f, &Jit::Movbs, kNone},
+      {0x0004, 0xf00f, &Jit::Movbs0, kNone},
+      {0x8000, 0xff00, &Jit::Movbs4, kNone},
+      {0xc000, 0xff00, &Jit::Movbsg, kNone},
+      {0xe000, 0xf000, &Jit::Movi, kNone},
+      {0xd000, 0xf000, &Jit::Movli, kNone},
+      {0x6002, 0xf00f, &Jit::Movll, kNone},
+      {0x000e, 0xf00f, &Jit::Movll0, kNone},
+      {0x5000, 0xf000, &Jit::Movll4, kNone},
+      {0xc600, 0xff00, &Jit::Movllg, kNone},
+      {0x2006, 0xf00f, &Jit::Movlm, kNone},
+      {0x6006, 0xf00f, &Jit::Movlp, kNone},
+      {0x2002, 0xf00f, &Jit::Movls, kNone},
+      {0x0006, 0xf00f, &Jit::Movls0, kNone},
+      {0x1000, 0xf000, &Jit::Movls4, kNone},
+      {0xc200, 0xff00, &Jit::Movlsg, kNone},
+      {0x0029, 0xf0ff, &Jit::Movt, kNone},
+      {0x9000, 0xf000, &Jit::Movwi, kNone},
+      {0x6001, 0xf00f, &Jit::Movwl, kNone},
+      {0x000d, 0xf00f, &Jit::Movwl0, kNone},
+      {0x8500, 0xff00, &Jit::Movwl4, kNone},
+      {0xc500, 0xff00, &Jit::Movwlg, kNone},
+      {0x2005, 0xf00f, &Jit::Movwm, kNone},
+      {0x6005, 0xf00f, &Jit::Movwp, kNone},
+      {0x2001, 0xf00f, &Jit::Movws, kNone},
+      {0x0005, 0xf00f, &Jit::Movws0, kNone},
+      {0x8100, 0xff00, &Jit::Movws4, kNone},
+      {0xc100, 0xff00, &Jit::Movwsg, kNone},
+      {0x0007, 0xf00f, &Jit::Mull, kNone},
+      {0x200f, 0xf00f, &Jit::Mulsw, kNone},
+      {0x200e, 0xf00f, &Jit::Mulsu, kNone},
+      {0x600b, 0xf00f, &Jit::Neg, kNone},
+      {0x0009, 0xffff, &Jit::Nop, kNone},
+      {0x6007, 0xf00f, &Jit::Not, kNone},
+      {0x200b, 0xf00f, &Jit::Or, kNone},
+      {0xcb00, 0xff00, &Jit::Ori, kNone},
+      {0x4024, 0xf0ff, &Jit::Rotcl, kNone},
+      {0x4025, 0xf0ff, &Jit::Rotcr, kNone},
+      {0x4004, 0xf0ff, &Jit::Rotl, kNone},
+      {0x4005, 0xf0ff, &Jit::Rotr, kNone},
+      {0x002b, 0xffff, &Jit::FallbackBranch, kBranch},
+      {0x000b, 0xffff, &Jit::Rts, kBranch},
+      {0x0018, 0xffff, &Jit::Sett, kNone},
+      {0x4020, 0xf0ff, &Jit::Shal, kNone},
+      {0x4021, 0xf0ff, &Jit::Shar, kNone},
+      {0x4000, 0xf0ff, &Jit::Shll, kNone},
+      {0x4028, 0xf0ff, &Jit::Shll16, kNone},
+      {0x4008, 0xf0ff, &Jit::Shll2, kNone},
+      {0x4018, 0xf0ff, &Jit::Shll8, kNone},
+      {0x4001, 0xf0ff, &Jit::Shlr, kNone},
+      {0x4029, 0xf0ff, &Jit::Shlr16, kNone},
+      {0x4009, 0xf0ff, &Jit::Shlr2, kNone},
+      {0x4019, 0xf0ff, &Jit::Shlr8, kNone},
+      {0x001b, 0xffff, &Jit::FallbackBranch, kBranch},
+      {0x0012, 0xf0ff, &Jit::Stcgbr, kNone},
+      {0x000a, 0xf0ff, &Jit::Stsmach, kNone},
+      {0x001a, 0xf0ff, &Jit::Stsmacl, kNone},
+      {0x4022, 0xf0ff, &Jit::Stsmpr, kNone},
+      {0x002a, 0xf0ff, &Jit::Stspr, kNone},
+      {0x3008, 0xf00f, &Jit::Sub, kNone},
+      {0x6008, 0xf00f, &Jit::Swapb, kNone},
+      {0x6009, 0xf00f, &Jit::Swapw, kNone},
+      {0xc300, 0xff00, &Jit::FallbackBranch, kBranch},
+      {0x2008, 0xf00f, &Jit::Tst, kNone},
+      {0xc800, 0xff00, &Jit::Tsti, kNone},
+      {0x200a, 0xf00f, &Jit::Xor, kNone},
+      {0xca00, 0xff00, &Jit::Xori, kNone},
+      {0x200d, 0xf00f, &Jit::Xtrct, kNone},
+  };
+};
+}  // namespace sh3
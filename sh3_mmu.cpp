@@ -10,15 +10,24 @@ namespace sh3 {
 Mmu::Mmu() {
   std::memset(itlb, 0, sizeof(itlb));
   std::memset(utlb, 0, sizeof(utlb));
+  fastmem.fill({nullptr, 0, 0, false, nullptr});
+  code_pages.fill(0);
 }
 
 void Mmu::Init(std::vector<Map>& map) {
   std::memset(mem_regions_priv, 0xffffffff, sizeof(mem_regions_priv));
   std::memset(mem_regions_user, 0xffffffff, sizeof(mem_regions_user));
 
+  memHandlers.clear();
+  fastmem.fill({nullptr, 0, 0, false, nullptr});
+
   for (auto m : map) {
-    SetPrivMemoryRegion(static_cast<uint32_t>(memHandlers.size()), m.addr,
-                        m.size);
+    uint32_t region = static_cast<uint32_t>(memHandlers.size());
+    if (m.host != nullptr) {
+      fastmem[region] = {m.host + m.size, m.size - 1, m.addr, m.writable,
+                         m.dirty};
+    }
+    SetPrivMemoryRegion(region, m.addr, m.size);
     memHandlers.push_back(m.mem_handler);
   }
   mem_regions = mem_regions_priv;
@@ -107,35 +116,22 @@ void Mmu::MemAccess(uint32_t addr, T& value) {
   }
 }
 
-uint8_t Mmu::Read8(uint32_t addr) {
-  uint8_t value;
-  MemAccess<MemoryAccessType::kRead, uint8_t>(addr, value);
-  return value;
-}
-
-uint16_t Mmu::Read16(uint32_t addr) {
-  uint16_t value;
-  MemAccess<MemoryAccessType::kRead, uint16_t>(addr, value);
-  return value;
-}
+template void Mmu::MemAccess<MemoryAccessType::kRead>(uint32_t, uint8_t&);
+template void Mmu::MemAccess<MemoryAccessType::kRead>(uint32_t, uint16_t&);
+template void Mmu::MemAccess<MemoryAccessType::kRead>(uint32_t, uint32_t&);
+template void Mmu::MemAccess<MemoryAccessType::kWrite>(uint32_t, uint8_t&);
+template void Mmu::MemAccess<MemoryAccessType::kWrite>(uint32_t, uint16_t&);
+template void Mmu::MemAccess<MemoryAccessType::kWrite>(uint32_t, uint32_t&);
 
-uint32_t Mmu::Read32(uint32_t addr) {
-  uint32_t value;
-  MemAccess<MemoryAccessType::kRead, uint32_t>(addr, value);
-  return value;
-}
-
-void Mmu::Write8(uint32_t addr, uint8_t value) {
-  MemAccess<MemoryAccessType::kWrite, uint8_t>(addr, value);
-}
+void Mmu::LdTlb() {}
 
-void Mmu::Write16(uint32_t addr, uint16_t value) {
-  MemAccess<MemoryAccessType::kWrite, uint16_t>(addr, value);
+void Mmu::SaveTlb(state::Writer& writer) const {
+  writer.Put(itlb);
+  writer.Put(utlb);
 }
 
-void Mmu::Write32(uint32_t addr, uint32_t value) {
-  MemAccess<MemoryAccessType::kWrite, uint32_t>(addr, value);
+void Mmu::LoadTlb(state::Reader& reader) {
+  reader.Get(itlb);
+  reader.Get(utlb);
 }
-
-void Mmu::LdTlb() {}
 }  // namespace sh3
\ No newline at end of file
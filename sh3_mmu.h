@@ -1,10 +1,13 @@
 
 #pragma once
+#include <array>
 #include <cstdint>
+#include <cstring>
 #include <functional>
 #include <vector>
 
 #include "memory.h"
+#include "save_state.h"
 
 namespace sh3 {
 const uint32_t kLookupShift = 10;
@@ -30,9 +33,24 @@ struct Map {
   uint32_t addr;
   uint32_t size;
   MemHandler mem_handler;
+  uint8_t* host;
+  bool writable;
+  uint8_t* dirty;
 
   Map(uint32_t a, uint32_t s, MemHandler& h)
-      : addr(a), size(s), mem_handler(h) {}
+      : addr(a),
+        size(s),
+        mem_handler(h),
+        host(nullptr),
+        writable(false),
+        dirty(nullptr) {}
+
+  // Plain memory accessed inline by the Mmu. |mem| holds |s| bytes stored
+  // in reverse order, so a host load at the mirrored offset yields the
+  // big-endian value. |s| must be a power of two. If |d| is set, writes
+  // set its byte for the written page of |mem|, see kDirtyPageShift.
+  Map(uint32_t a, uint32_t s, uint8_t* mem, bool w, uint8_t* d = nullptr)
+      : addr(a), size(s), host(mem), writable(w), dirty(d) {}
 };
 
 enum MemoryRegionType : uint8_t { kCached = 0x40, kMmu = 0x80 };
@@ -61,21 +79,55 @@ struct Utlb {
 
 class Mmu {
  public:
+  const static uint32_t kCodePageShift = 12;
+  const static uint32_t kDirtyPageShift = 12;
+
   Mmu();
+  virtual ~Mmu() = default;
 
   void Init(std::vector<Map>& map);
 
   void LdTlb();
 
-  uint8_t Read8(uint32_t adr);
-  uint16_t Read16(uint32_t adr);
-  uint32_t Read32(uint32_t adr);
+  uint8_t Read8(uint32_t adr) { return Read<uint8_t>(adr); }
+  uint16_t Read16(uint32_t adr) { return Read<uint16_t>(adr); }
+  uint32_t Read32(uint32_t adr) { return Read<uint32_t>(adr); }
+
+  void Write8(uint32_t adr, uint8_t v) { Write<uint8_t>(adr, v); }
+  void Write16(uint32_t adr, uint16_t v) { Write<uint16_t>(adr, v); }
+  void Write32(uint32_t adr, uint32_t v) { Write<uint32_t>(adr, v); }
+
+  bool IsCodePage(uint32_t addr) {
+    return code_pages[(addr & 0x1fffffff) >> kCodePageShift] != 0;
+  }
+
+  void InvalidateCode(uint32_t addr) {
+    if (IsCodePage(addr)) {
+      InvalidateCodePage(addr);
+    }
+  }
 
-  void Write8(uint32_t adr, uint8_t v);
-  void Write16(uint32_t adr, uint16_t v);
-  void Write32(uint32_t adr, uint32_t v);
+ protected:
+  std::array<uint8_t, (0x20000000 >> kCodePageShift)> code_pages;
+
+  void SaveTlb(state::Writer& writer) const;
+  void LoadTlb(state::Reader& reader);
+
+  virtual void InvalidateCodePage(uint32_t addr) {}
 
  private:
+  struct FastMem {
+    uint8_t* end;
+    uint32_t mask;
+    uint32_t base;
+    bool writable;
+    uint8_t* dirty;
+  };
+
+  // Indexed by region id. Entry 0x3f is never mapped, so unmapped pages
+  // (0xff in the region table) always take the handler path.
+  std::array<FastMem, 0x40> fastmem;
+
   std::vector<MemHandler> memHandlers;
   uint8_t mem_regions_priv[kLookupSize];
   uint8_t mem_regions_user[kLookupSize];
@@ -88,5 +140,33 @@ class Mmu {
 
   template <MemoryAccessType type, typename T>
   void MemAccess(uint32_t addr, T& value);
+
+  template <typename T>
+  T Read(uint32_t addr) {
+    T value;
+    auto& fast = fastmem[mem_regions[addr >> kLookupShift] & 0x3f];
+    if (fast.end != nullptr) {
+      std::memcpy(&value, fast.end - (addr & fast.mask) - sizeof(T),
+                  sizeof(T));
+      return value;
+    }
+    MemAccess<MemoryAccessType::kRead, T>(addr, value);
+    return value;
+  }
+
+  template <typename T>
+  void Write(uint32_t addr, T value) {
+    auto& fast = fastmem[mem_regions[addr >> kLookupShift] & 0x3f];
+    if (fast.writable) {
+      uint32_t offset = addr & fast.mask;
+      std::memcpy(fast.end - offset - sizeof(T), &value, sizeof(T));
+      if (fast.dirty != nullptr) {
+        fast.dirty[(fast.mask - offset) >> kDirtyPageShift] = 1;
+      }
+      InvalidateCode(fast.base + offset);
+      return;
+    }
+    MemAccess<MemoryAccessType::kWrite, T>(addr, value);
+  }
 };
 }  // namespace sh3
\ No newline at end of file
@@ -90,6 +90,8 @@ void Cpu::TestInterrupt() {
 }
 
 void Cpu::Interrupt(uint32_t intevt) {
+  sleeping = false;
+
   state.spc = state.pc;
   state.ssr = state.sr.all;
 
@@ -177,10 +179,13 @@ uint16_t Cpu::OnchipRead16(uint32_t addr) {
 uint32_t Cpu::OnchipRead32(uint32_t addr) {
   switch (addr) {
     case kTcnt_0:
+      volatile_reads++;
       return ReadCounter(tmu0);
     case kTcnt_1:
+      volatile_reads++;
       return ReadCounter(tmu1);
     case kTcnt_2:
+      volatile_reads++;
       return ReadCounter(tmu2);
     default:
       return OnchipRef32(addr);
@@ -68,6 +68,10 @@ Game* Ui::ShowGameList() {
 
   float total_width = ImGui::GetWindowWidth();
 
+  game_list.Update();
+  if (game_list.IsScanning()) {
+    ImGui::TextDisabled("Scanning...");
+  }
   Game* result = RenderGameList();
   ImGui::End();
 
@@ -90,6 +94,7 @@ Game* Ui::RenderGameList() {
       region_max.x - region_min.x - 2.0f * style.WindowPadding.x;
 
   auto& games = game_list.GetGameList();
+  auto& posters = game_list.GetPosters();
   int item_count = static_cast<int>(games.size());
 
   int tiles_per_row = static_cast<int>(region_width / (tile_size + margin));
@@ -114,13 +119,39 @@ Game* Ui::RenderGameList() {
 
     ImGui::BeginGroup();
     ImGui::PushID(i);
-    if (ImGui::ImageButton("", (ImTextureID)(intptr_t)games[i].poster_id,
-                           ImVec2(tile_size, tile_size))) {
+    auto status = game_list.GetStatus(games[i]);
+    ImVec2 tile(tile_size, tile_size);
+    PosterAtlas::Rect rect;
+    bool clicked;
+    if (posters.GetRect(games[i].poster, rect)) {
+      clicked = ImGui::ImageButton(
+          "", (ImTextureID)(intptr_t)posters.GetTexture(), tile,
+          ImVec2(rect.u0, rect.v0), ImVec2(rect.u1, rect.v1));
+    } else {
+      // Same footprint as the image button until the poster is uploaded.
+      clicked = ImGui::Button("", ImVec2(tile_size + style.FramePadding.x * 2,
+                                         tile_size + style.FramePadding.y * 2));
+    }
+    if (clicked && status != RomVerifier::kMissing) {
       game = &games[i];
     }
     ImGui::PushTextWrapPos(ImGui::GetCursorPosX() + tile_size);
     ImGui::Text(games[i].name.c_str());
     ImGui::PopTextWrapPos();
+    switch (status) {
+      case RomVerifier::kPending:
+        ImGui::TextDisabled("Checking roms...");
+        break;
+      case RomVerifier::kGood:
+        ImGui::TextColored(ImVec4(0.4f, 0.9f, 0.4f, 1.0f), "Good");
+        break;
+      case RomVerifier::kBad:
+        ImGui::TextColored(ImVec4(0.9f, 0.3f, 0.3f, 1.0f), "Bad dump");
+        break;
+      case RomVerifier::kMissing:
+        ImGui::TextColored(ImVec4(0.9f, 0.6f, 0.2f, 1.0f), "Missing files");
+        break;
+    }
     ImGui::PopID();
     ImGui::EndGroup();
   }
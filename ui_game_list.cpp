@@ -2,123 +2,193 @@
 #include "ui_game_list.h"
 
 #include <filesystem>
+#include <fstream>
+#include <sstream>
 
-#include "assets/deathsml.h"
-#include "assets/dfk.h"
-#include "assets/espgal.h"
-#include "assets/futari.h"
-#include "assets/ibara.h"
-#include "assets/mmmbanc.h"
-#include "assets/mmpork.h"
-#include "assets/mushisam.h"
-#include "assets/mushitam.h"
-#include "assets/pinkswts.h"
+namespace ui {
 
-#define STB_IMAGE_IMPLEMENTATION
-#include "stb_image.h"
+UiGameList::UiGameList()
+    : verifier_(kCrcCacheName), scanning_(false), stop_scan_(false) {
+  posters_.Load(kPosterName);
+}
 
-namespace ui {
+UiGameList::~UiGameList() { StopScan(); }
 
-UiGameList::UiGameList() {
-  poster_map_["deathsml"] =
-      std::span<unsigned char>(deathsml, sizeof(deathsml));
-  poster_map_["dthsmlbl"] =
-      std::span<unsigned char>(deathsml, sizeof(deathsml));
-
-  poster_map_["espgal2"] = std::span<unsigned char>(espgal, sizeof(espgal));
-
-  poster_map_["futari10"] = std::span<unsigned char>(futari, sizeof(futari));
-  poster_map_["futari15"] = std::span<unsigned char>(futari, sizeof(futari));
-  poster_map_["futari15a"] = std::span<unsigned char>(futari, sizeof(futari));
-  poster_map_["futariblk"] = std::span<unsigned char>(futari, sizeof(futari));
-
-  poster_map_["ibara"] = std::span<unsigned char>(ibara, sizeof(ibara));
-  poster_map_["ibarablk"] = std::span<unsigned char>(ibara, sizeof(ibara));
-  poster_map_["ibarablka"] = std::span<unsigned char>(ibara, sizeof(ibara));
-
-  poster_map_["mmmbanc"] = std::span<unsigned char>(mmmbanc, sizeof(mmmbanc));
-
-  poster_map_["mmpork"] = std::span<unsigned char>(mmpork, sizeof(mmpork));
-
-  poster_map_["mushisam"] =
-      std::span<unsigned char>(mushisam, sizeof(mushisam));
-  poster_map_["mushisama"] =
-      std::span<unsigned char>(mushisam, sizeof(mushisam));
-  poster_map_["mushisamb"] =
-      std::span<unsigned char>(mushisam, sizeof(mushisam));
-
-  poster_map_["mushitam"] =
-      std::span<unsigned char>(mushitam, sizeof(mushitam));
-  poster_map_["mushitama"] =
-      std::span<unsigned char>(mushitam, sizeof(mushitam));
-
-  poster_map_["pinkswts"] =
-      std::span<unsigned char>(pinkswts, sizeof(pinkswts));
-  poster_map_["pinkswtsa"] =
-      std::span<unsigned char>(pinkswts, sizeof(pinkswts));
-  poster_map_["pinkswtsb"] =
-      std::span<unsigned char>(pinkswts, sizeof(pinkswts));
-  poster_map_["pinkswtsx"] =
-      std::span<unsigned char>(pinkswts, sizeof(pinkswts));
-
-  poster_map_["dfk10"] = std::span<unsigned char>(dfk, sizeof(dfk));
-  poster_map_["dfk15"] = std::span<unsigned char>(dfk, sizeof(dfk));
+// Subdirectories of every directory the last scan walked, reused as long
+// as the directory's mtime hasn't changed.
+struct DirCacheEntry {
+  int64_t mtime;
+  std::vector<std::string> subdirs;
+};
+using DirCache = std::unordered_map<std::string, DirCacheEntry>;
+
+static DirCache LoadDirCache(const char* path) {
+  DirCache cache;
+  DirCacheEntry* entry = nullptr;
+
+  std::ifstream file(path);
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.size() < 2) {
+      continue;
+    }
+    if (line[0] == 'D') {
+      std::istringstream in(line.substr(2));
+      int64_t mtime;
+      std::string dir;
+      if (in >> mtime && in.get() == ' ' && std::getline(in, dir)) {
+        entry = &cache[dir];
+        entry->mtime = mtime;
+        entry->subdirs.clear();
+      } else {
+        entry = nullptr;
+      }
+    } else if (line[0] == 'S' && entry) {
+      entry->subdirs.push_back(line.substr(2));
+    }
+  }
+  return cache;
 }
 
-GLuint UiGameList::LoadPoster(std::string name) {
-  GLuint poster_id;
-
-  auto image = poster_map_[name];
-
-  int width, height, channels;
-  unsigned char* data = stbi_load_from_memory(image.data(), image.size(),
-                                              &width, &height, &channels, 3);
-  if (data) {
-    glGenTextures(1, &poster_id);
-    glBindTexture(GL_TEXTURE_2D, poster_id);
-
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB,
-                 GL_UNSIGNED_BYTE, data);
-    stbi_image_free(data);
+static void SaveDirCache(const char* path, const DirCache& cache) {
+  std::ofstream file(path, std::ios::trunc);
+  for (const auto& [dir, entry] : cache) {
+    file << "D " << entry.mtime << " " << dir << "\n";
+    for (const auto& subdir : entry.subdirs) {
+      file << "S " << subdir << "\n";
+    }
   }
-  return poster_id;
 }
 
 void UiGameList::ScanDirectory(std::string dir, GamesList& game_list) {
-  auto count = game_list.GetCount();
-
-  for (const auto& entry : std::filesystem::recursive_directory_iterator(dir)) {
-    auto path = entry.path();
-    bool found = false;
-    std::string name;
-    std::string game_path;
-    uint32_t idx = 0;
-    for (idx = 0; idx < count; idx++) {
-      name = game_list.GetGameField(idx, eGameFieldName);
-      game_path = path.string();
-      if (path.stem().string() == name) {
-        found = true;
-        break;
-      }
-    }
-    if (!found) {
+  StopScan();
+
+  game_list_.clear();
+  scan_results_.clear();
+
+  stop_scan_ = false;
+  scanning_ = true;
+  scan_thread_ = std::thread(&UiGameList::Scan, this,
+                             std::filesystem::path(dir), &game_list);
+}
+
+void UiGameList::StopScan() {
+  stop_scan_ = true;
+  if (scan_thread_.joinable()) {
+    scan_thread_.join();
+  }
+}
+
+void UiGameList::Scan(std::filesystem::path dir, GamesList* game_list) {
+  std::unordered_map<std::string, uint32_t> names;
+  for (uint32_t idx = 0; idx < game_list->GetCount(); idx++) {
+    names[game_list->GetGameField(idx, eGameFieldName)] = idx;
+  }
+
+  DirCache old_cache = LoadDirCache(kScanCacheName);
+  DirCache cache;
+
+  // Romset directories aren't searched further, they only hold rom files.
+  std::vector<std::filesystem::path> stack = {dir};
+  while (!stack.empty() && !stop_scan_) {
+    auto path = std::move(stack.back());
+    stack.pop_back();
+
+    std::error_code ec;
+    int64_t mtime =
+        std::filesystem::last_write_time(path, ec).time_since_epoch().count();
+    if (ec) {
       continue;
     }
-    if (game_list.LoadGame(idx, path.string(), false)) {
-      Game game;
 
+    std::vector<std::string> subdirs;
+    auto cached = old_cache.find(path.string());
+    if (cached != old_cache.end() && cached->second.mtime == mtime) {
+      subdirs = std::move(cached->second.subdirs);
+    } else {
+      std::filesystem::directory_iterator it(
+          path, std::filesystem::directory_options::skip_permission_denied,
+          ec);
+      for (; !ec && it != std::filesystem::directory_iterator();
+           it.increment(ec)) {
+        if (it->is_directory(ec)) {
+          subdirs.push_back(it->path().filename().string());
+        }
+      }
+    }
+
+    for (const auto& subdir : subdirs) {
+      auto sub_path = path / subdir;
+      auto name = sub_path.stem().string();
+      auto found = names.find(name);
+      if (found == names.end()) {
+        // Symlinked romsets are listed, but links aren't followed any
+        // further so a cycle can't keep the scan going.
+        std::error_code link_ec;
+        if (!std::filesystem::is_symlink(sub_path, link_ec)) {
+          stack.push_back(sub_path);
+        }
+        continue;
+      }
+
+      // Files are checked in the background, see GetStatus.
+      uint32_t idx = found->second;
+      Game game;
       game.game_id = idx;
-      game.path = game_path;
-      game.name = game_list.GetGameField(idx, eGameFieldFullName);
-      game.poster_id = LoadPoster(name);
-      game_list_.push_back(game);
+      game.path = sub_path.string();
+      game.name = game_list->GetGameField(idx, eGameFieldFullName);
+      game.poster = posters_.Find(name);
+      for (const RomEntry* rom = game_list->GetInfo(idx)->roms;
+           rom->type != RomEntryEnd; rom++) {
+        if (rom->type == RomEntryLoad || rom->type == RomEntryLoadXwordSwap) {
+          game.roms.push_back(verifier_.Add(sub_path / rom->name, rom->crc));
+        }
+      }
+
+      std::lock_guard lock(scan_mutex_);
+      scan_results_.push_back(std::move(game));
+    }
+
+    cache[path.string()] = {mtime, std::move(subdirs)};
+  }
+
+  if (!stop_scan_) {
+    SaveDirCache(kScanCacheName, cache);
+  }
+  scanning_ = false;
+}
+
+void UiGameList::Update() {
+  {
+    std::lock_guard lock(scan_mutex_);
+    for (auto& game : scan_results_) {
+      game_list_.push_back(std::move(game));
+    }
+    scan_results_.clear();
+  }
+  posters_.Update();
+}
+
+RomVerifier::Status UiGameList::GetStatus(const Game& game) {
+  bool pending = false;
+  bool bad = false;
+  for (uint32_t id : game.roms) {
+    switch (verifier_.GetStatus(id)) {
+      case RomVerifier::kMissing:
+        return RomVerifier::kMissing;
+      case RomVerifier::kPending:
+        pending = true;
+        break;
+      case RomVerifier::kBad:
+        bad = true;
+        break;
+      default:
+        break;
     }
   }
+  return pending ? RomVerifier::kPending
+         : bad   ? RomVerifier::kBad
+                 : RomVerifier::kGood;
 }
 
 }  // namespace ui
\ No newline at end of file
@@ -1,17 +1,17 @@
 #pragma once
 
-#include <span>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
+#include "rom_verifier.h"
 #include "roms.h"
-
-#if defined(IMGUI_IMPL_OPENGL_ES2)
-#include "SDL3/SDL_opengles2.h"
-#else
-#include "SDL3/SDL_opengl.h"
-#endif
+#include "ui_poster_atlas.h"
 
 namespace ui {
 
@@ -19,21 +19,47 @@ struct Game {
   uint32_t game_id;
   std::string name;
   std::string path;
-  GLuint poster_id = 0;
+  // PosterAtlas slot, -1 without a poster.
+  int32_t poster = -1;
+  // RomVerifier ids of the game's rom files.
+  std::vector<uint32_t> roms;
 };
 
 class UiGameList {
  public:
   UiGameList();
+  ~UiGameList();
+
+  // Starts scanning dir in the background, replacing the current list.
+  // Games show up through Update() as they are found.
   void ScanDirectory(std::string dir, GamesList &game_list);
+  // Moves scanned games into the list, called once per UI frame.
+  void Update();
+  bool IsScanning() const { return scanning_; }
 
   std::vector<Game> &GetGameList() { return game_list_; }
+  PosterAtlas &GetPosters() { return posters_; }
+  // Missing if any rom file is, else pending while any is being checked,
+  // else bad if any CRC differs.
+  RomVerifier::Status GetStatus(const Game &game);
 
  private:
+  constexpr static const char *kCrcCacheName = "rom_crc.txt";
+  constexpr static const char *kScanCacheName = "scan_cache.txt";
+  constexpr static const char *kPosterName = "posters.bin";
+
   std::vector<Game> game_list_;
-  std::unordered_map<std::string, std::span<unsigned char>> poster_map_;
+  RomVerifier verifier_;
+  PosterAtlas posters_;
+
+  std::thread scan_thread_;
+  std::atomic<bool> scanning_;
+  std::atomic<bool> stop_scan_;
+  std::mutex scan_mutex_;
+  std::vector<Game> scan_results_;
 
-  GLuint LoadPoster(std::string name);
+  void Scan(std::filesystem::path dir, GamesList *game_list);
+  void StopScan();
 };
 
 }  // namespace ui
\ No newline at end of file
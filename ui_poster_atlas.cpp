@@ -0,0 +1,99 @@
+#include "ui_poster_atlas.h"
+
+#include <cstring>
+
+namespace ui {
+
+static constexpr uint32_t kMagic = 0x4150434e;  // "NCPA"
+static constexpr uint32_t kVersion = 1;
+
+// Reads a uint32_t at pos, false if the file is too short.
+static bool Get(const MappedFile &file, size_t &pos, uint32_t &value) {
+  if (file.GetSize() - pos < sizeof(value)) return false;
+  std::memcpy(&value, file.GetData() + pos, sizeof(value));
+  pos += sizeof(value);
+  return true;
+}
+
+bool PosterAtlas::Load(const std::filesystem::path &path) {
+  if (!file_.Open(path)) return false;
+
+  size_t pos = 0;
+  uint32_t magic, version, tile_size, columns, rows, count;
+  if (!Get(file_, pos, magic) || !Get(file_, pos, version) ||
+      !Get(file_, pos, tile_size) || !Get(file_, pos, columns) ||
+      !Get(file_, pos, rows) || !Get(file_, pos, count) ||
+      magic != kMagic || version != kVersion) {
+    file_.Close();
+    return false;
+  }
+
+  uint64_t size = uint64_t{tile_size} * tile_size * columns * rows * 2;
+  if (file_.GetSize() - pos < size) {
+    file_.Close();
+    return false;
+  }
+  pixels_ = file_.GetData() + pos;
+  pos += size;
+
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t slot, length;
+    if (!Get(file_, pos, slot) || !Get(file_, pos, length) ||
+        file_.GetSize() - pos < length || slot >= columns * rows) {
+      break;
+    }
+    slots_[std::string(reinterpret_cast<const char *>(file_.GetData() + pos),
+                       length)] = static_cast<int32_t>(slot);
+    pos += length;
+  }
+
+  tile_size_ = static_cast<int>(tile_size);
+  columns_ = static_cast<int>(columns);
+  rows_ = static_cast<int>(rows);
+  return true;
+}
+
+int32_t PosterAtlas::Find(const std::string &name) const {
+  auto it = slots_.find(name);
+  return it != slots_.end() ? it->second : -1;
+}
+
+void PosterAtlas::Update() {
+  if (texture_ != 0 || !pixels_) {
+    return;
+  }
+
+  glGenTextures(1, &texture_);
+  glBindTexture(GL_TEXTURE_2D, texture_);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 2);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, columns_ * tile_size_,
+               rows_ * tile_size_, 0, GL_RGB, GL_UNSIGNED_SHORT_5_6_5,
+               pixels_);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+  // The driver has its own copy now.
+  pixels_ = nullptr;
+  file_.Close();
+}
+
+bool PosterAtlas::GetRect(int32_t slot, Rect &rect) const {
+  if (slot < 0 || texture_ == 0) {
+    return false;
+  }
+  // Inset by half a texel so filtering never reads a neighbouring slot.
+  float width = static_cast<float>(columns_ * tile_size_);
+  float height = static_cast<float>(rows_ * tile_size_);
+  float x = static_cast<float>((slot % columns_) * tile_size_);
+  float y = static_cast<float>((slot / columns_) * tile_size_);
+  rect.u0 = (x + 0.5f) / width;
+  rect.v0 = (y + 0.5f) / height;
+  rect.u1 = (x + tile_size_ - 0.5f) / width;
+  rect.v1 = (y + tile_size_ - 0.5f) / height;
+  return true;
+}
+
+}  // namespace ui
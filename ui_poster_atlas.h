@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+
+#include "mapped_file.h"
+
+#if defined(IMGUI_IMPL_OPENGL_ES2)
+#include "SDL3/SDL_opengles2.h"
+#else
+#include "SDL3/SDL_opengl.h"
+#endif
+
+namespace ui {
+
+// All game posters in one texture, packed at build time by poster_pack.
+// The file already holds the atlas as RGB565 pixels, so it is uploaded as
+// is on the first Update().
+class PosterAtlas {
+ public:
+  struct Rect {
+    float u0, v0, u1, v1;
+  };
+
+  // False if the file is missing or malformed, games then have no poster.
+  bool Load(const std::filesystem::path &path);
+  // Slot of a driver's poster, -1 if it has none.
+  int32_t Find(const std::string &name) const;
+  // Creates the texture, UI thread only.
+  void Update();
+
+  GLuint GetTexture() const { return texture_; }
+  // False until the texture exists.
+  bool GetRect(int32_t slot, Rect &rect) const;
+
+ private:
+  MappedFile file_;
+  const uint8_t *pixels_ = nullptr;
+  std::unordered_map<std::string, int32_t> slots_;
+  int tile_size_ = 0;
+  int columns_ = 0;
+  int rows_ = 0;
+  GLuint texture_ = 0;
+};
+
+}  // namespace ui
@@ -0,0 +1,312 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace x64 {
+enum Reg : uint8_t {
+  kRax = 0,
+  kRcx,
+  kRdx,
+  kRbx,
+  kRsp,
+  kRbp,
+  kRsi,
+  kRdi,
+  kR8,
+  kR9,
+  kR10,
+  kR11,
+  kR12,
+  kR13,
+  kR14,
+  kR15
+};
+
+#if defined(_WIN32)
+const Reg kArg0 = kRcx;
+const Reg kArg1 = kRdx;
+const Reg kArg2 = kR8;
+const uint8_t kShadowSpace = 32;
+#else
+const Reg kArg0 = kRdi;
+const Reg kArg1 = kRsi;
+const Reg kArg2 = kRdx;
+const uint8_t kShadowSpace = 0;
+#endif
+
+enum Cond : uint8_t {
+  kO = 0,
+  kNo,
+  kB,
+  kAe,
+  kE,
+  kNe,
+  kBe,
+  kA,
+  kS,
+  kNs,
+  kP,
+  kNp,
+  kL,
+  kGe,
+  kLe,
+  kG
+};
+
+enum Alu : uint8_t {
+  kAdd = 0,
+  kOr = 1,
+  kAdc = 2,
+  kSbb = 3,
+  kAnd = 4,
+  kSub = 5,
+  kXor = 6,
+  kCmp = 7
+};
+
+enum Shift : uint8_t {
+  kRol = 0,
+  kRor = 1,
+  kRcl = 2,
+  kRcr = 3,
+  kShl = 4,
+  kShr = 5,
+  kSar = 7
+};
+
+// Minimal x86-64 encoder. All register operations are 32 bit unless the
+// name says otherwise, memory operands are always [base + disp32].
+class Emitter {
+ public:
+  void SetBuffer(uint8_t *buffer, size_t size) {
+    begin_ = ptr_ = buffer;
+    end_ = buffer + size;
+  }
+
+  void Reset() { ptr_ = begin_; }
+  uint8_t *Ptr() const { return ptr_; }
+  size_t Left() const { return static_cast<size_t>(end_ - ptr_); }
+
+  void Mov(Reg dst, Reg src) {
+    Rex(false, src, dst);
+    Emit8(0x89);
+    ModRm(src, dst);
+  }
+
+  void Mov64(Reg dst, Reg src) {
+    Rex(true, src, dst);
+    Emit8(0x89);
+    ModRm(src, dst);
+  }
+
+  void MovImm(Reg dst, uint32_t imm) {
+    Rex(false, kRax, dst);
+    Emit8(0xb8 + (dst & 7));
+    Emit32(imm);
+  }
+
+  void MovImm64(Reg dst, uint64_t imm) {
+    Rex(true, kRax, dst);
+    Emit8(0xb8 + (dst & 7));
+    Emit64(imm);
+  }
+
+  void Load(Reg dst, Reg base, int32_t disp) {
+    Rex(false, dst, base);
+    Emit8(0x8b);
+    Mem(dst, base, disp);
+  }
+
+  void Store(Reg base, int32_t disp, Reg src) {
+    Rex(false, src, base);
+    Emit8(0x89);
+    Mem(src, base, disp);
+  }
+
+  void StoreImm(Reg base, int32_t disp, uint32_t imm) {
+    Rex(false, kRax, base);
+    Emit8(0xc7);
+    Mem(kRax, base, disp);
+    Emit32(imm);
+  }
+
+  void Op(Alu op, Reg dst, Reg src) {
+    Rex(false, src, dst);
+    Emit8((op << 3) | 0x01);
+    ModRm(src, dst);
+  }
+
+  void OpImm(Alu op, Reg dst, uint32_t imm) {
+    Rex(false, kRax, dst);
+    if (static_cast<int32_t>(imm) == static_cast<int8_t>(imm)) {
+      Emit8(0x83);
+      ModRm(static_cast<Reg>(op), dst);
+      Emit8(static_cast<uint8_t>(imm));
+    } else {
+      Emit8(0x81);
+      ModRm(static_cast<Reg>(op), dst);
+      Emit32(imm);
+    }
+  }
+
+  void OpMemImm(Alu op, Reg base, int32_t disp, uint32_t imm) {
+    Rex(false, kRax, base);
+    Emit8(0x81);
+    Mem(static_cast<Reg>(op), base, disp);
+    Emit32(imm);
+  }
+
+  void Test(Reg a, Reg b) {
+    Rex(false, b, a);
+    Emit8(0x85);
+    ModRm(b, a);
+  }
+
+  void TestImm(Reg a, uint32_t imm) {
+    Rex(false, kRax, a);
+    Emit8(0xf7);
+    ModRm(kRax, a);
+    Emit32(imm);
+  }
+
+  void Sh(Shift op, Reg dst, uint8_t count) {
+    Rex(false, kRax, dst);
+    if (count == 1) {
+      Emit8(0xd1);
+      ModRm(static_cast<Reg>(op), dst);
+    } else {
+      Emit8(0xc1);
+      ModRm(static_cast<Reg>(op), dst);
+      Emit8(count);
+    }
+  }
+
+  void Rol16(Reg dst, uint8_t count) {
+    Emit8(0x66);
+    Rex(false, kRax, dst);
+    Emit8(0xc1);
+    ModRm(kRax, dst);
+    Emit8(count);
+  }
+
+  void Not(Reg dst) {
+    Rex(false, kRax, dst);
+    Emit8(0xf7);
+    ModRm(static_cast<Reg>(2), dst);
+  }
+
+  void Neg(Reg dst) {
+    Rex(false, kRax, dst);
+    Emit8(0xf7);
+    ModRm(static_cast<Reg>(3), dst);
+  }
+
+  void Imul(Reg dst, Reg src) {
+    Rex(false, dst, src);
+    Emit8(0x0f);
+    Emit8(0xaf);
+    ModRm(dst, src);
+  }
+
+  void Movzx8(Reg dst, Reg src) { Extend(0xb6, dst, src, true); }
+  void Movzx16(Reg dst, Reg src) { Extend(0xb7, dst, src, false); }
+  void Movsx8(Reg dst, Reg src) { Extend(0xbe, dst, src, true); }
+  void Movsx16(Reg dst, Reg src) { Extend(0xbf, dst, src, false); }
+
+  void Setcc(Cond cond, Reg dst) {
+    Rex(false, kRax, dst, dst >= kRsp && dst <= kRdi);
+    Emit8(0x0f);
+    Emit8(0x90 + cond);
+    ModRm(kRax, dst);
+  }
+
+  void Cmov(Cond cond, Reg dst, Reg src) {
+    Rex(false, dst, src);
+    Emit8(0x0f);
+    Emit8(0x40 + cond);
+    ModRm(dst, src);
+  }
+
+  void Push(Reg reg) {
+    if (reg >= kR8) Emit8(0x41);
+    Emit8(0x50 + (reg & 7));
+  }
+
+  void Pop(Reg reg) {
+    if (reg >= kR8) Emit8(0x41);
+    Emit8(0x58 + (reg & 7));
+  }
+
+  void SubRsp(uint8_t size) {
+    Emit8(0x48);
+    Emit8(0x83);
+    Emit8(0xec);
+    Emit8(size);
+  }
+
+  void AddRsp(uint8_t size) {
+    Emit8(0x48);
+    Emit8(0x83);
+    Emit8(0xc4);
+    Emit8(size);
+  }
+
+  void Call(const void *fn) {
+    MovImm64(kRax, reinterpret_cast<uint64_t>(fn));
+    Emit8(0xff);
+    Emit8(0xd0);
+  }
+
+  void Ret() { Emit8(0xc3); }
+
+  // Emits a forward jcc, the returned label is resolved with Bind().
+  uint8_t *Jcc(Cond cond) {
+    Emit8(0x0f);
+    Emit8(0x80 + cond);
+    Emit32(0);
+    return ptr_;
+  }
+
+  void Bind(uint8_t *label) {
+    int32_t rel = static_cast<int32_t>(ptr_ - label);
+    std::memcpy(label - sizeof(rel), &rel, sizeof(rel));
+  }
+
+ private:
+  uint8_t *begin_ = nullptr;
+  uint8_t *ptr_ = nullptr;
+  uint8_t *end_ = nullptr;
+
+  void Emit8(uint8_t v) { *ptr_++ = v; }
+  void Emit32(uint32_t v) {
+    std::memcpy(ptr_, &v, sizeof(v));
+    ptr_ += sizeof(v);
+  }
+  void Emit64(uint64_t v) {
+    std::memcpy(ptr_, &v, sizeof(v));
+    ptr_ += sizeof(v);
+  }
+
+  void Rex(bool w, Reg reg, Reg rm, bool force = false) {
+    uint8_t rex = 0x40 | (w << 3) | ((reg >> 3) << 2) | (rm >> 3);
+    if (rex != 0x40 || force) Emit8(rex);
+  }
+
+  void ModRm(Reg reg, Reg rm) { Emit8(0xc0 | ((reg & 7) << 3) | (rm & 7)); }
+
+  void Mem(Reg reg, Reg base, int32_t disp) {
+    Emit8(0x80 | ((reg & 7) << 3) | (base & 7));
+    if ((base & 7) == kRsp) Emit8(0x24);
+    Emit32(static_cast<uint32_t>(disp));
+  }
+
+  void Extend(uint8_t opcode, Reg dst, Reg src, bool byte) {
+    Rex(false, dst, src, byte && src >= kRsp && src <= kRdi);
+    Emit8(0x0f);
+    Emit8(opcode);
+    ModRm(dst, src);
+  }
+};
+}  // namespace x64
@@ -1,82 +1,428 @@
 
 #include "ymz770.h"
 
+#include <immintrin.h>
+
 #include <algorithm>
 #include <string>
+#include <unordered_map>
 
 Ymz770 ::Ymz770() {
+  spu_.fill(0);
+  std::memset(regs, 0, sizeof(regs));
+  reg_num = 0;
   for (int i = 0; i < kMaxChannels; i++) {
     channel_state_[i] = kStop;
     sequences_[i].state_ = kSeqIdle;
+    UpdateGain(i);
   }
-  spu_.fill(0);
-  std::memset(regs, 0, sizeof(regs));
-  reg_num = 0;
 }
 
+Ymz770::~Ymz770() { StopPredecode(); }
+
 void Ymz770::StartChannel(int i) { channel_state_[i] = kInit; }
 void Ymz770::StopChannel(int i) { channel_state_[i] = kStop; }
 
 void Ymz770::InitChannel(int i) {
-  uint32_t offset = Read(channels_data[i].msn * 4);
-  decoder_.Init(&spu_[offset]);
+  auto &channel = channels_[i];
+  channel.msn = channels_data[i].msn;
+  channel.generation = cache_.GetGeneration();
+  channel.pcm = cache_.IsEnabled() ? cache_.Find(channel.msn) : nullptr;
+  channel.pcm_pos = 0;
+  if (!channel.pcm) {
+    uint32_t offset = Read(channel.msn * 4);
+    channel.decoder.Init(&spu_[offset]);
+  }
+  channel.read = 0;
+  channel.write = 0;
+  channel.ended = false;
+  channel.record.clear();
+  channel.recording = !channel.pcm && cache_.IsEnabled();
   channel_state_[i] = kPlay;
 }
 
-int32_t Ymz770::ReadChannel(int i) {
-  int32_t sample = 0;
+// Decodes whole frames until n samples are buffered or the ring is full.
+// No more than needed, a key on throws away whatever is left.
+void Ymz770::FillChannel(int i, uint32_t n) {
+  constexpr uint32_t kFrame = Amms2Decoder::kFrameSamples;
+  auto &channel = channels_[i];
+  while (!channel.ended && channel.write - channel.read < n &&
+         channel.write - channel.read <= YmzChannel::kRingSize - kFrame) {
+    int16_t *out = &channel.ring[channel.write % YmzChannel::kRingSize];
+    if (channel.decoder.GetFrame(out)) {
+      channel.write += kFrame;
+      if (channel.recording) {
+        if (channel.record.size() + kFrame > cache_.GetMaxSamples()) {
+          channel.recording = false;
+          channel.record.clear();
+          channel.record.shrink_to_fit();
+        } else {
+          channel.record.insert(channel.record.end(), out, out + kFrame);
+        }
+      }
+    } else {
+      channel.ended = true;
+      if (channel.recording) {
+        channel.recording = false;
+        cache_.Insert(channel.msn,
+                      std::make_shared<const PcmCache::Samples>(
+                          std::move(channel.record)),
+                      channel.generation);
+      }
+    }
+  }
+}
+
+// Decodes the key on msn from the start up to pos.
+void Ymz770::SeekChannel(int i, uint32_t pos) {
+  constexpr uint32_t kFrame = Amms2Decoder::kFrameSamples;
+  auto &channel = channels_[i];
+  channel.pcm = nullptr;
+  channel.decoder.Init(&spu_[Read(channel.msn * 4)]);
+  channel.read = 0;
+  channel.write = 0;
+  channel.ended = false;
+  int16_t frame[kFrame];
+  for (uint32_t skip = pos / kFrame; skip; skip--) {
+    if (!channel.decoder.GetFrame(frame)) {
+      channel.ended = true;
+      return;
+    }
+  }
+  FillChannel(i, kFrame);
+  channel.read = std::min(pos % kFrame, channel.write);
+}
 
-  auto &channel = channels_data[i];
+// Copies up to n samples of the playing stream, 0 once it has ended.
+uint32_t Ymz770::ReadSamples(int i, int16_t *out, uint32_t n) {
+  auto &channel = channels_[i];
+  if (channel.pcm) {
+    uint32_t count = static_cast<uint32_t>(
+        std::min<size_t>(n, channel.pcm->size() - channel.pcm_pos));
+    std::memcpy(out, channel.pcm->data() + channel.pcm_pos,
+                count * sizeof(int16_t));
+    channel.pcm_pos += count;
+    return count;
+  }
 
-  if (kInit == channel_state_[i]) {
-    InitChannel(i);
+  if (channel.read == channel.write) {
+    FillChannel(i, n);
   }
-  if (kPlay == channel_state_[i]) {
-    if (!decoder_.GetSample(sample)) {
-      if (!channel.loop) {
+  uint32_t pos = channel.read % YmzChannel::kRingSize;
+  uint32_t count = std::min(
+      {n, channel.write - channel.read, YmzChannel::kRingSize - pos});
+  std::memcpy(out, &channel.ring[pos], count * sizeof(int16_t));
+  channel.read += count;
+  return count;
+}
+
+void Ymz770::ReadChannel(int i, int16_t *out, uint32_t n) {
+  uint32_t done = 0;
+  while (done < n) {
+    if (kInit == channel_state_[i]) {
+      InitChannel(i);
+    }
+    if (kPlay != channel_state_[i]) {
+      break;
+    }
+
+    uint32_t count = ReadSamples(i, out + done, n - done);
+    if (!count) {
+      if (!channels_data[i].loop) {
         StopChannel(i);
-      } else {
-        InitChannel(i);
-        decoder_.GetSample(sample);
+        break;
+      }
+      InitChannel(i);
+      count = ReadSamples(i, out + done, n - done);
+      if (!count) {
+        out[done++] = 0;
+        continue;
       }
     }
+    done += count;
   }
-  return sample * channel.vlm / 128;
+  std::fill(out + done, out + n, 0);
 }
 
-int16_t Ymz770::GetNextSample() {
-  int32_t sample = 0;
+enum ChannelSource : uint8_t { kSourceNone, kSourceCache, kSourceDecoder };
 
-  Sequencer();
+void Ymz770::SaveState(state::Writer &writer) const {
+  writer.Begin(state::Tag("YMZ "), 1);
+  writer.Put(regs);
+  writer.Put(reg_num);
   for (int i = 0; i < kMaxChannels; i++) {
-    sample += ReadChannel(i);
+    const auto &sequence = sequences_[i];
+    SeqState state = sequence.state_;
+    bool running = state == kSeqPlaying || state == kSeqWait;
+    writer.Put(state);
+    writer.Put(sequence.idle_cnt_);
+    writer.Put(static_cast<uint32_t>(
+        running ? reinterpret_cast<const uint8_t *>(sequence.seqptr_) -
+                      spu_.data()
+                : 0));
   }
 
-  sample *= vlma;
-  sample >>= 7 - bsl;
+  for (int i = 0; i < kMaxChannels; i++) {
+    const auto &channel = channels_[i];
+    ChanState state = channel_state_[i];
+    writer.Put(state);
+    writer.Put(channel.msn);
+    if (state != kPlay) {
+      writer.Put(kSourceNone);
+    } else if (channel.pcm) {
+      writer.Put(kSourceCache);
+      writer.Put(channel.pcm_pos);
+    } else {
+      writer.Put(kSourceDecoder);
+      channel.decoder.SaveState(writer, spu_);
+      writer.Put(channel.ring);
+      writer.Put(channel.read);
+      writer.Put(channel.write);
+      writer.Put(channel.ended);
+    }
+  }
+}
 
-  constexpr int32_t clip_max3 = 32768 * 75 / 100;
-  constexpr int32_t clip_max2 = 32768 * 875 / 1000;
-  switch (cpl) {
-    case 3:
-      sample = std::clamp(sample, -clip_max3, clip_max3);
-      break;
-    case 2:
-      sample = std::clamp(sample, -clip_max2, clip_max2);
-      break;
-    case 1:
-      sample = std::clamp(sample, -32768, 32767);
-      break;
+void Ymz770::LoadState(state::Reader &reader) {
+  reader.Get(regs);
+  reader.Get(reg_num);
+  for (int i = 0; i < kMaxChannels; i++) {
+    auto &sequence = sequences_[i];
+    sequence.state_ = reader.Get<SeqState>();
+    reader.Get(sequence.idle_cnt_);
+    uint32_t offset = reader.Get<uint32_t>() & (kSpuSize - 2);
+    sequence.seqptr_ = reinterpret_cast<uint16_t *>(&spu_[offset]);
   }
 
-  if (mute) {
-    sample = 0;
+  for (int i = 0; i < kMaxChannels; i++) {
+    auto &channel = channels_[i];
+    channel_state_[i] = reader.Get<ChanState>();
+    reader.Get(channel.msn);
+    channel.pcm = nullptr;
+    channel.generation = cache_.GetGeneration();
+    channel.record.clear();
+    channel.recording = false;
+    switch (reader.Get<ChannelSource>()) {
+      case kSourceCache: {
+        uint32_t pos = reader.Get<uint32_t>();
+        channel.pcm = cache_.IsEnabled() ? cache_.Find(channel.msn) : nullptr;
+        if (channel.pcm) {
+          channel.pcm_pos = static_cast<uint32_t>(
+              std::min<size_t>(pos, channel.pcm->size()));
+        } else {
+          SeekChannel(i, pos);
+        }
+        break;
+      }
+      case kSourceDecoder:
+        channel.decoder.LoadState(reader, spu_);
+        reader.Get(channel.ring);
+        reader.Get(channel.read);
+        reader.Get(channel.write);
+        reader.Get(channel.ended);
+        break;
+      default:
+        break;
+    }
+    UpdateGain(i);
+  }
+}
+
+void Ymz770::ResetCache(size_t budget) {
+  StopPredecode();
+  cache_.Reset(budget);
+}
+
+void Ymz770::StartPredecode() {
+  StopPredecode();
+  if (cache_.IsEnabled()) {
+    predecode_thread_ =
+        std::thread(&Ymz770::Predecode, this, cache_.GetGeneration());
   }
+}
 
-  return static_cast<int16_t>(sample);
+void Ymz770::StopPredecode() {
+  if (predecode_thread_.joinable()) {
+    predecode_stop_ = true;
+    predecode_thread_.join();
+    predecode_stop_ = false;
+  }
 }
 
-void Ymz770::Sequencer() {
+// Decodes every msn whose stream is short enough. Entries pointing at the
+// same stream share its samples. These only fill space the played samples
+// leave free and are the first to go.
+void Ymz770::Predecode(uint32_t generation) {
+  constexpr uint32_t kFrame = Amms2Decoder::kFrameSamples;
+  auto decoder = std::make_unique<Amms2Decoder>();
+  std::unordered_map<uint32_t, std::shared_ptr<const PcmCache::Samples>>
+      streams;
+  PcmCache::Samples samples;
+  size_t limit = std::min<size_t>(kPredecodeSamples, cache_.GetMaxSamples());
+
+  for (uint32_t msn = 0; msn < 256 && !predecode_stop_; msn++) {
+    uint32_t offset = Read(msn * 4);
+    // Unused entries don't point at a frame header.
+    if (offset > kSpuSize - 2 || spu_[offset] != 0xff ||
+        (spu_[offset + 1] & 0xf0) != 0xf0 || cache_.Contains(msn)) {
+      continue;
+    }
+
+    auto it = streams.find(offset);
+    if (it == streams.end()) {
+      std::shared_ptr<const PcmCache::Samples> pcm;
+      decoder->Init(&spu_[offset]);
+      samples.clear();
+      while (samples.size() <= limit) {
+        int16_t frame[kFrame];
+        if (!decoder->GetFrame(frame)) {
+          pcm = std::make_shared<const PcmCache::Samples>(samples);
+          break;
+        }
+        samples.insert(samples.end(), frame, frame + kFrame);
+      }
+      it = streams.emplace(offset, std::move(pcm)).first;
+    }
+    if (it->second) {
+      cache_.Insert(static_cast<uint8_t>(msn), it->second, generation, false);
+    }
+  }
+}
+
+// pan is 0 to 63 with 32 in the centre, the far side fades out linearly.
+void Ymz770::UpdateGain(int i) {
+  int32_t vlm = channels_data[i].vlm;
+  int32_t pan = channels_data[i].pan;
+  gain_left_[i] = static_cast<int16_t>(vlm * std::min(32, 64 - pan));
+  gain_right_[i] = static_cast<int16_t>(vlm * std::min(32, pan));
+}
+
+void Ymz770::Render(int16_t *out, size_t n) {
+  uint32_t pos = 0;
+  LatchMix();
+  while (n) {
+    // Samples up to a sequencer write that changes a gain or the master
+    // registers are mixed as one block.
+    if (Sequencer()) {
+      if (pos) {
+        Mix(out, pos);
+        out += pos * 2;
+        pos = 0;
+      }
+      LatchMix();
+    }
+    uint32_t max =
+        static_cast<uint32_t>(std::min<size_t>(n, kMixBlock - pos));
+    uint32_t run = 1 + SkipSequencer(max - 1);
+
+    for (int i = 0; i < kMaxChannels; i++) {
+      ReadChannel(i, mix_in_[i] + pos, run);
+    }
+    pos += run;
+    n -= run;
+
+    if (pos == kMixBlock) {
+      Mix(out, pos);
+      out += pos * 2;
+      pos = 0;
+      LatchMix();
+    }
+  }
+  if (pos) {
+    Mix(out, pos);
+  }
+}
+
+void Ymz770::LatchMix() {
+  std::memcpy(mix_.gain_left, gain_left_, sizeof(gain_left_));
+  std::memcpy(mix_.gain_right, gain_right_, sizeof(gain_right_));
+  mix_.mute = mute;
+  mix_.vlma = vlma;
+  mix_.bsl = bsl;
+  mix_.cpl = cpl;
+}
+
+// 32-bit multiply keeping the low half, pmulld is SSE4.1.
+static inline __m128i MulLo32(__m128i a, __m128i b) {
+  __m128i even = _mm_mul_epu32(a, b);
+  __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+  return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, 0x08),
+                            _mm_shuffle_epi32(odd, 0x08));
+}
+
+void Ymz770::Mix(int16_t *out, uint32_t n) {
+  // pmaddwd takes channels in pairs, low half first.
+  __m128i left_gain[kMaxChannels / 2], right_gain[kMaxChannels / 2];
+  for (int i = 0; i < kMaxChannels / 2; i++) {
+    left_gain[i] = _mm_set1_epi32(
+        static_cast<uint16_t>(mix_.gain_left[i * 2]) |
+        static_cast<uint16_t>(mix_.gain_left[i * 2 + 1]) << 16);
+    right_gain[i] = _mm_set1_epi32(
+        static_cast<uint16_t>(mix_.gain_right[i * 2]) |
+        static_cast<uint16_t>(mix_.gain_right[i * 2 + 1]) << 16);
+  }
+
+  __m128i volume = _mm_set1_epi32(mix_.vlma);
+  __m128i shift = _mm_cvtsi32_si128(7 - mix_.bsl);
+  // Limits fit in 16 bits, so clipping is a saturating pack and a clamp.
+  int16_t limit = 32767;
+  if (mix_.cpl == 3) {
+    limit = 32768 * 75 / 100;
+  } else if (mix_.cpl == 2) {
+    limit = 32768 * 875 / 1000;
+  }
+  __m128i max = _mm_set1_epi16(limit);
+  __m128i min = _mm_set1_epi16(mix_.cpl >= 2 ? -limit : -32768);
+
+  auto master = [&](__m128i lo, __m128i hi) {
+    lo = _mm_sra_epi32(MulLo32(_mm_srai_epi32(lo, kGainShift), volume), shift);
+    hi = _mm_sra_epi32(MulLo32(_mm_srai_epi32(hi, kGainShift), volume), shift);
+    if (mix_.cpl == 0) {
+      // No clipping, the output wraps.
+      lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+      hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+    }
+    __m128i x = _mm_packs_epi32(lo, hi);
+    return _mm_max_epi16(_mm_min_epi16(x, max), min);
+  };
+
+  for (uint32_t j = 0; j < n; j += 8) {
+    __m128i left[2] = {_mm_setzero_si128(), _mm_setzero_si128()};
+    __m128i right[2] = {_mm_setzero_si128(), _mm_setzero_si128()};
+    for (int i = 0; i < kMaxChannels / 2; i++) {
+      __m128i a = _mm_load_si128(
+          reinterpret_cast<const __m128i *>(&mix_in_[i * 2][j]));
+      __m128i b = _mm_load_si128(
+          reinterpret_cast<const __m128i *>(&mix_in_[i * 2 + 1][j]));
+      __m128i lo = _mm_unpacklo_epi16(a, b);
+      __m128i hi = _mm_unpackhi_epi16(a, b);
+      left[0] = _mm_add_epi32(left[0], _mm_madd_epi16(lo, left_gain[i]));
+      left[1] = _mm_add_epi32(left[1], _mm_madd_epi16(hi, left_gain[i]));
+      right[0] = _mm_add_epi32(right[0], _mm_madd_epi16(lo, right_gain[i]));
+      right[1] = _mm_add_epi32(right[1], _mm_madd_epi16(hi, right_gain[i]));
+    }
+
+    __m128i l = master(left[0], left[1]);
+    __m128i r = master(right[0], right[1]);
+    if (mix_.mute) {
+      l = r = _mm_setzero_si128();
+    }
+
+    alignas(16) int16_t frames[16];
+    __m128i *dst = reinterpret_cast<__m128i *>(frames);
+    if (n - j >= 8) {
+      dst = reinterpret_cast<__m128i *>(out + j * 2);
+    }
+    _mm_storeu_si128(dst, _mm_unpacklo_epi16(l, r));
+    _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(l, r));
+    if (n - j < 8) {
+      std::memcpy(out + j * 2, frames, (n - j) * 2 * sizeof(int16_t));
+    }
+  }
+}
+
+bool Ymz770::Sequencer() {
+  bool mix_changed = false;
   for (int i = 0; i < kMaxChannels; i++) {
     SeqState state = sequences_[i].state_;
     if (kSeqIdle == state) {
@@ -103,16 +449,45 @@ void Ymz770::Sequencer() {
           sequences_[i].state_ = sequences_data[i].sqlp ? kSeqStart : kSeqIdle;
           break;
         default:
-          RegWrite(seqdata & 0xff, seqdata >> 8);
+          mix_changed |= RegWrite(seqdata & 0xff, seqdata >> 8);
           break;
       }
     }
   }
+  return mix_changed;
+}
+
+// Consumes up to max ticks in which every sequence is idle or waiting,
+// returns how many.
+uint32_t Ymz770::SkipSequencer(uint32_t max) {
+  uint32_t skip = max;
+  for (int i = 0; i < kMaxChannels; i++) {
+    SeqState state = sequences_[i].state_;
+    if (kSeqWait == state) {
+      // The tick that ends the wait is left to Sequencer().
+      skip = std::min(skip, sequences_[i].idle_cnt_ - 1);
+    } else if (kSeqIdle != state) {
+      return 0;
+    }
+  }
+  for (int i = 0; i < kMaxChannels; i++) {
+    if (kSeqWait == sequences_[i].state_) {
+      sequences_[i].idle_cnt_ -= skip;
+    }
+  }
+  return skip;
 }
 
-void Ymz770::RegWrite(uint32_t reg, uint8_t value) {
+// True if the write changed a gain or a master register.
+bool Ymz770::RegWrite(uint32_t reg, uint8_t value) {
   regs[reg] = value;
 
+  bool mix_changed = reg < 3;
+  if ((reg & 0xe3) == 0x41 || (reg & 0xe3) == 0x42) {
+    UpdateGain((reg & 0x1c) >> 2);
+    mix_changed = true;
+  }
+
   if ((reg & 0xe3) == 0x43) {
     uint8_t chan = (reg & 0x1c) >> 2;
 
@@ -127,6 +502,7 @@ void Ymz770::RegWrite(uint32_t reg, uint8_t value) {
     uint8_t sqn = (reg & 0x70) >> 4;
     sequences_[sqn].state_ = (value & 6) ? kSeqStart : kSeqIdle;
   }
+  return mix_changed;
 }
 
 void Ymz770::Write(uint32_t reg, uint8_t value) {
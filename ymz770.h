@@ -1,11 +1,16 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <memory>
+#include <span>
+#include <thread>
 #include <vector>
 
 #include "amms2.h"
+#include "pcm_cache.h"
 
 struct YmzChannelData {
   uint8_t msn;
@@ -31,6 +36,30 @@ struct YmzSequenceData {
 };
 
 enum ChanState : uint32_t { kInit, kPlay, kStop };
+
+// A voice with its own decoder. Whole frames are decoded ahead into ring,
+// the mixer takes one sample per output sample. A sample found in the
+// PcmCache is played from pcm instead.
+struct YmzChannel {
+  static constexpr uint32_t kRingSize = 4 * Amms2Decoder::kFrameSamples;
+
+  Amms2Decoder decoder;
+  std::array<int16_t, kRingSize> ring;
+  uint32_t read;
+  uint32_t write;
+  // The decoder reached the end of the stream.
+  bool ended;
+
+  // The msn at key on, the register may change while it plays.
+  uint8_t msn;
+  std::shared_ptr<const PcmCache::Samples> pcm;
+  uint32_t pcm_pos;
+  // Everything decoded since the key on, cached if the stream ends before
+  // it outgrows the cache.
+  std::vector<int16_t> record;
+  bool recording;
+  uint32_t generation;
+};
 enum SeqState : uint32_t { kSeqIdle, kSeqStart, kSeqPlaying, kSeqWait };
 
 struct YmzSequence {
@@ -43,17 +72,48 @@ class Ymz770 {
  public:
   static const uint32_t kSpuSize = 0x00800000;
 
-  void WriteRom(uint32_t offset, uint8_t v) { spu_[offset] = v; }
+  std::span<uint8_t> GetRom() { return spu_; }
   void Write(uint32_t reg, uint8_t value);
-  int16_t GetNextSample();
+  // Fills out with n interleaved left/right sample pairs.
+  void Render(int16_t *out, size_t n);
+  // Drops decoded samples, call before the rom changes. budget is in bytes,
+  // 0 disables the cache.
+  void ResetCache(size_t budget);
+  // Decodes the short samples into the cache on a background thread, call
+  // once the rom is loaded.
+  void StartPredecode();
+
+  // Registers, sequencers and every voice's decoder. A voice playing from
+  // the cache only keeps its position, it is decoded again if the sample
+  // is no longer cached on load.
+  void SaveState(state::Writer &writer) const;
+  void LoadState(state::Reader &reader);
 
   Ymz770();
+  ~Ymz770();
 
  private:
   static const int kMaxChannels = 8;
+  // Channel gains are vlm * pan, vlm is 1.7 and pan 1.5 fixed point.
+  static const int kGainShift = 7 + 5;
+  // Samples mixed per pass, a multiple of the 8 lanes the mixer works on.
+  static const uint32_t kMixBlock = 256;
+  // Samples up to two seconds long are pre-decoded.
+  static const uint32_t kPredecodeSamples = 2 * 16000;
 
   std::array<uint8_t, kSpuSize> spu_;
-  Amms2Decoder decoder_;
+  YmzChannel channels_[kMaxChannels];
+  alignas(16) int16_t gain_left_[kMaxChannels];
+  alignas(16) int16_t gain_right_[kMaxChannels];
+  // Channel output for the block being mixed.
+  alignas(16) int16_t mix_in_[kMaxChannels][kMixBlock];
+  // Gains and master registers the block is mixed with, latched when it
+  // starts.
+  struct MixParams {
+    alignas(16) int16_t gain_left[kMaxChannels];
+    alignas(16) int16_t gain_right[kMaxChannels];
+    uint8_t mute, vlma, bsl, cpl;
+  } mix_;
 
   uint32_t Read(uint32_t addr) {
     addr &= spu_.size() - 1;
@@ -83,13 +143,26 @@ class Ymz770 {
 
   YmzSequence sequences_[kMaxChannels];
 
-  void Sequencer();
-  void RegWrite(uint32_t reg, uint8_t value);
+  PcmCache cache_;
+  std::thread predecode_thread_;
+  std::atomic<bool> predecode_stop_ = false;
+
+  bool Sequencer();
+  uint32_t SkipSequencer(uint32_t max);
+  bool RegWrite(uint32_t reg, uint8_t value);
 
   void InitChannel(int i);
   void StartChannel(int i);
   void StopChannel(int i);
-  int32_t ReadChannel(int i);
+  void FillChannel(int i, uint32_t n);
+  void SeekChannel(int i, uint32_t pos);
+  uint32_t ReadSamples(int i, int16_t *out, uint32_t n);
+  void ReadChannel(int i, int16_t *out, uint32_t n);
+  void UpdateGain(int i);
+  void LatchMix();
+  void Mix(int16_t *out, uint32_t n);
+  void Predecode(uint32_t generation);
+  void StopPredecode();
 
   std::atomic<ChanState> channel_state_[kMaxChannels];
 };